@@ -0,0 +1,56 @@
+#pragma once
+
+#include "spl/result/result.hpp"
+
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+#include <memory>
+
+namespace spl::simulator {
+
+    /**
+     * @brief Installs a self-signed certificate for localhost, with a key generated at every startup, only meant for
+     * local load tests. The feeder clients do not verify the peer, so any certificate is accepted; pass --certificate
+     * and --key to serve your own.
+     */
+    [[nodiscard]] inline auto self_signed(SSL_CTX* context) -> spl::result<void> {
+        auto const key = std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)>{EVP_EC_gen("P-256"), &EVP_PKEY_free};
+        if (key == nullptr) [[unlikely]] {
+            return spl::failure("simulator: unable to generate a private key");
+        }
+
+        auto const certificate = std::unique_ptr<X509, decltype(&X509_free)>{X509_new(), &X509_free};
+        auto* const name       = certificate != nullptr ? X509_get_subject_name(certificate.get()) : nullptr;
+        if (name == nullptr or X509_set_version(certificate.get(), X509_VERSION_3) != 1 or
+            ASN1_INTEGER_set(X509_get_serialNumber(certificate.get()), 1) != 1 or
+            X509_gmtime_adj(X509_getm_notBefore(certificate.get()), 0) == nullptr or
+            X509_gmtime_adj(X509_getm_notAfter(certificate.get()), 365L * 24 * 60 * 60) == nullptr or
+            X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<unsigned char const*>("localhost"),
+                                       -1, -1, 0) != 1 or
+            X509_set_issuer_name(certificate.get(), name) != 1 or X509_set_pubkey(certificate.get(), key.get()) != 1)
+            [[unlikely]] {
+            return spl::failure("simulator: unable to fill the certificate");
+        }
+
+        auto extension_context = X509V3_CTX{};
+        X509V3_set_ctx_nodb(&extension_context);
+        X509V3_set_ctx(&extension_context, certificate.get(), certificate.get(), nullptr, nullptr, 0);
+        auto const names = std::unique_ptr<X509_EXTENSION, decltype(&X509_EXTENSION_free)>{
+            X509V3_EXT_conf_nid(nullptr, &extension_context, NID_subject_alt_name, "DNS:localhost,IP:127.0.0.1"),
+            &X509_EXTENSION_free};
+        if (names == nullptr or X509_add_ext(certificate.get(), names.get(), -1) != 1 or
+            X509_sign(certificate.get(), key.get(), EVP_sha256()) == 0) [[unlikely]] {
+            return spl::failure("simulator: unable to sign the certificate");
+        }
+
+        if (SSL_CTX_use_certificate(context, certificate.get()) != 1 or
+            SSL_CTX_use_PrivateKey(context, key.get()) != 1) [[unlikely]] {
+            return spl::failure("simulator: unable to install the self-signed certificate");
+        }
+        return spl::success();
+    }
+
+} // namespace spl::simulator
@@ -0,0 +1,182 @@
+#include "certificate.hpp"
+#include "server.hpp"
+#include "venue.hpp"
+
+#include "generator.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/reflect/reflect.hpp"
+
+#include <CLI/CLI.hpp>
+
+#include <atomic>
+#include <csignal>
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace {
+    std::atomic<bool> interrupted{false};
+
+    auto on_signal(int) -> void {
+        interrupted.store(true, std::memory_order_relaxed);
+    }
+} // namespace
+
+enum class trade_profile : std::uint8_t {
+    low,
+    medium,
+    high,
+    ultra,
+};
+
+struct arguments {
+    spl::protocol::common::exchange_id exchange_id{spl::protocol::common::exchange_id::coinbase};
+    spl::simulator::configuration configuration{.instrument = "BTC-USDT"};
+    trade_profile profile{trade_profile::high};
+    std::uint32_t seed{42};
+    std::optional<std::filesystem::path> certificate{};
+    std::optional<std::filesystem::path> key{};
+
+    [[nodiscard]] static auto from(int argc, char** argv) noexcept -> spl::result<arguments> {
+        CLI::App app{"Sparkland Exchange Simulator - Local websocket venue for end-to-end load tests"};
+
+        auto args        = arguments{};
+        auto exchange    = std::string(spl::reflect::enum_to_string(args.exchange_id));
+        auto profile_str = std::string(spl::reflect::enum_to_string(args.profile));
+        auto rate        = -1.0;
+        auto certificate = std::string{};
+        auto key         = std::string{};
+        auto plain       = false;
+
+        app.add_option("-e,--exchange", exchange, "Exchange protocol to speak (bybit, coinbase)")
+            ->default_val(exchange)
+            ->check(CLI::IsMember({"bybit", "coinbase"}));
+
+        app.add_option("-i,--instrument", args.configuration.instrument, "Instrument printed in the trades")
+            ->default_val(args.configuration.instrument);
+
+        app.add_option("-p,--port", args.configuration.port, "Listening port (9443 for bybit, 9444 for coinbase)");
+
+        app.add_option("--profile", profile_str, "Trade generator profile (low, medium, high, ultra)")
+            ->default_val(profile_str)
+            ->check(CLI::IsMember({"low", "medium", "high", "ultra"}));
+
+        app.add_option("-r,--rate", rate, "Mean trades per second per connection, 0 sends back to back")
+            ->check(CLI::NonNegativeNumber);
+
+        app.add_option("-b,--burst", args.configuration.burst, "Trades released back to back in every burst")
+            ->default_val(args.configuration.burst)
+            ->check(CLI::PositiveNumber);
+
+        app.add_option("--batch", args.configuration.batch, "Trades per message, where the protocol allows it")
+            ->default_val(args.configuration.batch)
+            ->check(CLI::PositiveNumber);
+
+        app.add_option("-n,--count", args.configuration.count, "Trades sent per connection, 0 streams until closed")
+            ->default_val(args.configuration.count);
+
+        app.add_option("--seed", args.seed, "Seed of the trade generator")->default_val(args.seed);
+
+        app.add_flag("--plain", plain, "Serve plain ws:// instead of wss://");
+
+        app.add_flag("--deflate", args.configuration.deflate, "Accept permessage-deflate when offered");
+
+        auto* chain = app.add_option("--certificate", certificate, "PEM certificate chain, self-signed otherwise");
+
+        chain->needs(app.add_option("--key", key, "PEM private key of the certificate")->needs(chain));
+
+        try {
+            app.parse(argc, argv);
+        } catch (const CLI::ParseError& e) {
+            std::ignore = app.exit(e);
+            return spl::failure("Failed to parse command-line arguments: {}", e.what());
+        }
+
+        args.exchange_id       = spl::reflect::enum_from_string<spl::protocol::common::exchange_id>(exchange);
+        args.profile           = spl::reflect::enum_from_string<trade_profile>(profile_str);
+        args.configuration.tls = not plain;
+        if (not std::empty(certificate)) {
+            args.certificate = std::filesystem::path{certificate};
+            args.key         = std::filesystem::path{key};
+        }
+
+        auto const generator    = args.generator();
+        args.configuration.rate = rate < 0.0 ? generator.events_per_second : rate;
+        return args;
+    }
+
+    [[nodiscard]] auto generator() const noexcept -> spl::metrics::benchmark::trade_generator::config {
+        auto config = [&]() {
+            switch (profile) {
+                case trade_profile::low:
+                    return spl::metrics::benchmark::configs::low_frequency();
+                case trade_profile::medium:
+                    return spl::metrics::benchmark::configs::medium_frequency();
+                case trade_profile::ultra:
+                    return spl::metrics::benchmark::configs::ultra_high_frequency();
+                default:
+                    return spl::metrics::benchmark::configs::high_frequency();
+            }
+        }();
+        config.seed     = seed;
+        config.exchange = exchange_id;
+        return config;
+    }
+};
+
+[[nodiscard]] auto load(arguments const& args, boost::asio::ssl::context& context) -> spl::result<void> {
+    if (not args.certificate) {
+        return spl::simulator::self_signed(context.native_handle());
+    }
+
+    auto error  = boost::system::error_code{};
+    std::ignore = context.use_certificate_chain_file(args.certificate->string(), error);
+    std::ignore = context.use_private_key_file(args.key->string(), boost::asio::ssl::context::pem, error);
+    if (error) [[unlikely]] {
+        return spl::failure("Unable to load the TLS certificate ({})", error.message());
+    }
+    return spl::success();
+}
+
+template <typename VenueT>
+[[nodiscard]] auto execute(arguments const& args) -> spl::result<void> {
+    auto context = boost::asio::ssl::context{boost::asio::ssl::context::tlsv12_server};
+    if (args.configuration.tls) {
+        err_return(load(args, context));
+    }
+
+    auto generator = spl::metrics::benchmark::trade_generator(args.generator());
+    auto server    = spl::simulator::server<VenueT>(args.configuration, generator.generate(), context);
+    return server.run(interrupted);
+}
+
+[[nodiscard]] auto execute(arguments const& args) -> spl::result<void> {
+    switch (args.exchange_id) {
+        case spl::protocol::common::exchange_id::bybit:
+            return execute<spl::simulator::bybit>(args);
+        case spl::protocol::common::exchange_id::coinbase:
+            return execute<spl::simulator::coinbase>(args);
+        default:
+            return spl::failure("Unsupported exchange ID");
+    }
+}
+
+[[nodiscard]] auto execute(int argc, char** argv) -> spl::result<void> {
+    auto const args = arguments::from(argc, argv);
+    if (spl::failed(args)) {
+        return spl::success();
+    }
+    return execute(args.value());
+}
+
+auto main(int argc, char** argv) -> int {
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
+    std::signal(SIGPIPE, SIG_IGN);
+    if (auto const result = execute(argc, argv); spl::failed(result)) {
+        spl::logger::error("Application error: {}", result.error().message().data());
+        return -1;
+    }
+    return 0;
+}
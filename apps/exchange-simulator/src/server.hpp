@@ -0,0 +1,296 @@
+#pragma once
+
+#define BOOST_ASIO_SSL_USE_OPENSSL_3
+
+#include "venue.hpp"
+
+#include "spl/logger/logger.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/result/result.hpp"
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/ssl/context.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/ssl/ssl_stream.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace spl::simulator {
+
+    /**
+     * @brief How a connection is fed once it subscribes.
+     */
+    struct configuration {
+        std::string instrument{};     ///< Symbol printed in every message, whatever the client subscribed to.
+        std::uint16_t port{0};        ///< Listening port, zero picks the default port of the venue.
+        std::size_t count{0};         ///< Trades sent per connection, zero streams until the client leaves.
+        double rate{0.0};             ///< Mean trades per second, zero sends back to back.
+        std::size_t burst{1};         ///< Trades released together, bursts are spaced to keep the mean rate.
+        std::size_t batch{1};         ///< Trades per message, capped by what the venue allows.
+        bool tls{true};               ///< Serve wss:// (what the feeder contracts connect to) or plain ws://.
+        bool deflate{false};          ///< Accept permessage-deflate when the client offers it.
+    };
+
+    /**
+     * @brief Websocket server impersonating a venue, one thread per connection.
+     *
+     * Every connection replays the same generated trades from the start, re-sequenced and stamped with the wall
+     * clock at send time. With a rate, trades are released following the spacing of the generated timestamps
+     * rescaled to that rate, so the arrival jitter of the generator is kept; bursts release several trades back to
+     * back. Writes block on a slow client, so the rate a connection reports is the rate the client sustained.
+     *
+     * @tparam VenueT Message layout, spl::simulator::bybit or spl::simulator::coinbase.
+     */
+    template <typename VenueT>
+    class server {
+        using clock_type   = std::chrono::steady_clock;
+        using tcp_type     = boost::asio::ip::tcp;
+        using plain_stream = boost::beast::websocket::stream<boost::beast::tcp_stream>;
+        using tls_stream   = boost::beast::websocket::stream<boost::beast::ssl_stream<boost::beast::tcp_stream>>;
+        using trade_type   = spl::protocol::feeder::trade::trade_summary;
+
+        /**
+         * @brief Thread of a connection, and the descriptor it owns until it is done.
+         */
+        struct session {
+            int handle{-1};
+            std::mutex mutex{};
+            bool done{false}; ///< Set before the descriptor is closed, so that a live handle is never a reused one.
+            std::jthread thread{};
+        };
+
+        /**
+         * @brief Marks the session done when destroyed, declared after the stream so that it runs before the close.
+         */
+        struct release {
+            session& owner;
+
+            ~release() {
+                auto const lock = std::scoped_lock{owner.mutex};
+                owner.done      = true;
+            }
+        };
+
+    public:
+        server(spl::simulator::configuration configuration, std::vector<trade_type> trades,
+               boost::asio::ssl::context& ssl_context) :
+            configuration_(std::move(configuration)), trades_(std::move(trades)), ssl_context_(ssl_context) {
+            configuration_.port  = configuration_.port == 0 ? VenueT::port : configuration_.port;
+            configuration_.batch = std::clamp<std::size_t>(configuration_.batch, 1, VenueT::batch);
+            configuration_.burst = std::max<std::size_t>(configuration_.burst, configuration_.batch);
+        }
+
+        /**
+         * @brief Accepts connections until interrupted, then waits for the connections to finish.
+         */
+        [[nodiscard]] auto run(std::atomic<bool> const& interrupted) -> spl::result<void> {
+            if (std::empty(trades_)) [[unlikely]] {
+                return spl::failure("simulator: no trades to send");
+            }
+
+            auto context  = boost::asio::io_context{};
+            auto error    = boost::system::error_code{};
+            auto endpoint = tcp_type::endpoint{tcp_type::v4(), configuration_.port};
+            auto acceptor = tcp_type::acceptor{context};
+            std::ignore   = acceptor.open(endpoint.protocol(), error);
+            std::ignore   = acceptor.set_option(boost::asio::socket_base::reuse_address(true), error);
+            std::ignore   = acceptor.bind(endpoint, error);
+            if (error) [[unlikely]] {
+                return spl::failure("simulator: unable to bind port {} ({})", configuration_.port, error.message());
+            }
+            std::ignore = acceptor.listen(boost::asio::socket_base::max_listen_connections, error);
+            std::ignore = acceptor.non_blocking(true, error);
+            if (error) [[unlikely]] {
+                return spl::failure("simulator: unable to listen on port {} ({})", configuration_.port,
+                                    error.message());
+            }
+
+            logger::info("Simulating {} on {}://localhost:{} ({} trades/s, bursts of {}, {} trades per message)",
+                         VenueT::exchange, configuration_.tls ? "wss" : "ws", configuration_.port, configuration_.rate,
+                         configuration_.burst, configuration_.batch);
+
+            auto connections = std::list<session>{};
+            for (auto connection = std::size_t{1}; not interrupted.load(std::memory_order_relaxed);) {
+                // Joins the connections that ended, their descriptors are closed already
+                connections.remove_if([](session& session) {
+                    auto const lock = std::scoped_lock{session.mutex};
+                    return session.done;
+                });
+
+                auto socket = acceptor.accept(error);
+                if (error == boost::asio::error::would_block or error == boost::asio::error::try_again) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                    continue;
+                }
+                if (error) [[unlikely]] {
+                    logger::warn("Simulator: unable to accept a connection ({})", error.message());
+                    continue;
+                }
+                std::ignore    = socket.non_blocking(false, error);
+                std::ignore    = socket.set_option(tcp_type::no_delay(true), error);
+                auto& session  = connections.emplace_back();
+                session.handle = socket.native_handle();
+                session.thread = std::jthread{[this, &interrupted, &session, id = connection++,
+                                               socket = std::move(socket)]() mutable {
+                    serve(id, std::move(socket), session, interrupted);
+                }};
+            }
+
+            // Wakes up the connections blocked on a silent client, a session holds its descriptor open until it is done
+            for (auto& session : connections) {
+                auto const lock = std::scoped_lock{session.mutex};
+                if (not session.done) {
+                    std::ignore = ::shutdown(session.handle, SHUT_RDWR);
+                }
+            }
+            return spl::success();
+        }
+
+    private:
+        auto serve(std::size_t id, tcp_type::socket socket, session& session, std::atomic<bool> const& interrupted)
+            -> void {
+            auto error        = boost::system::error_code{};
+            auto const remote = socket.remote_endpoint(error);
+            logger::info("Connection {}: accepted from {}", id, remote.address().to_string());
+            if (not configuration_.tls) {
+                auto stream         = plain_stream{std::move(socket)};
+                auto const released = release{session};
+                return serve(id, stream, interrupted);
+            }
+
+            auto stream         = tls_stream{std::move(socket), ssl_context_.get()};
+            auto const released = release{session};
+            stream.next_layer().handshake(boost::asio::ssl::stream_base::server, error);
+            if (error) [[unlikely]] {
+                logger::warn("Connection {}: TLS handshake failed ({})", id, error.message());
+                return;
+            }
+            serve(id, stream, interrupted);
+        }
+
+        template <typename StreamT>
+        auto serve(std::size_t id, StreamT& stream, std::atomic<bool> const& interrupted) -> void {
+            auto error   = boost::system::error_code{};
+            auto deflate = boost::beast::websocket::permessage_deflate{};
+
+            deflate.server_enable = configuration_.deflate;
+            stream.set_option(deflate);
+            stream.text(true);
+            stream.accept(error);
+            if (error) [[unlikely]] {
+                logger::warn("Connection {}: websocket handshake failed ({})", id, error.message());
+                return;
+            }
+
+            auto buffer = boost::beast::flat_buffer{};
+            auto frame  = std::string{};
+            std::ignore = stream.read(buffer, error);
+            if (error) [[unlikely]] {
+                logger::warn("Connection {}: closed before subscribing ({})", id, error.message());
+                return;
+            }
+            VenueT::subscribed(frame);
+            std::ignore = stream.write(boost::asio::buffer(frame), error);
+
+            auto const& origin   = trades_.front().timestamp;
+            auto const span      = (trades_.back().timestamp - origin) / static_cast<std::int64_t>(std::size(trades_));
+            auto const spacing   = std::max(span, decltype(span){1});
+            auto const period    = trades_.back().timestamp - origin + spacing;
+            auto const scale     = configuration_.rate > 0.0 ? 1e9 / (configuration_.rate * spacing.count()) : 0.0;
+            auto const start     = clock_type::now();
+            auto const remaining = [&](std::size_t sent) -> std::size_t {
+                if (configuration_.count == 0) {
+                    return std::numeric_limits<std::size_t>::max();
+                }
+                return configuration_.count - sent;
+            };
+
+            auto sent     = std::size_t{0};
+            auto messages = std::size_t{0};
+            auto bytes    = std::size_t{0};
+            auto report   = start + std::chrono::seconds{1};
+            auto reported = std::size_t{0};
+            while (not error and not interrupted.load(std::memory_order_relaxed) and remaining(sent) != 0) {
+                if (scale != 0.0) {
+                    auto const index  = sent % std::size(trades_);
+                    auto const cycle  = static_cast<std::int64_t>(sent / std::size(trades_));
+                    auto const offset = (trades_[index].timestamp - origin + cycle * period) * scale;
+                    auto const due    = start + std::chrono::duration_cast<clock_type::duration>(offset);
+                    while (clock_type::now() < due and not interrupted.load(std::memory_order_relaxed)) {
+                        std::this_thread::sleep_until(std::min(due, clock_type::now() + std::chrono::milliseconds{10}));
+                    }
+                }
+
+                auto const burst = std::min(configuration_.burst, remaining(sent));
+                for (auto released = std::size_t{0}; released < burst and not error;) {
+                    auto const now   = std::chrono::system_clock::now();
+                    auto const batch = std::min(configuration_.batch, burst - released);
+                    frame.clear();
+                    VenueT::open(frame, configuration_.instrument, now);
+                    for (auto item = std::size_t{0}; item < batch; ++item, ++sent) {
+                        auto const& trade = trades_[sent % std::size(trades_)];
+                        VenueT::append(frame, configuration_.instrument, spl::simulator::print{trade, sent + 1, now},
+                                       item == 0);
+                    }
+                    VenueT::close(frame);
+                    bytes += stream.write(boost::asio::buffer(frame), error);
+                    released += batch;
+                    ++messages;
+                }
+                answer(stream, buffer, frame, error);
+
+                if (auto const now = clock_type::now(); now >= report) {
+                    logger::info("Connection {}: {} trades/s, {} messages sent", id, sent - reported, messages);
+                    report   = now + std::chrono::seconds{1};
+                    reported = sent;
+                }
+            }
+
+            auto const elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+            logger::info("Connection {}: sent {} trades in {} messages ({} bytes) over {:.3f}s, {:.0f} trades/s "
+                         "and {:.0f} messages/s{}",
+                         id, sent, messages, bytes, elapsed, sent / elapsed, messages / elapsed,
+                         error ? std::string(", ") + error.message() : std::string{});
+            stream.close(boost::beast::websocket::close_code::normal, error);
+        }
+
+        /**
+         * @brief Answers what the client sent meanwhile (i.e. application-level pings) without blocking the feed.
+         */
+        template <typename StreamT>
+        auto answer(StreamT& stream, boost::beast::flat_buffer& buffer, std::string& frame,
+                    boost::system::error_code& error) -> void {
+            auto& socket = boost::beast::get_lowest_layer(stream).socket();
+            while (not error and socket.available(error) != 0) {
+                buffer.clear();
+                std::ignore       = stream.read(buffer, error);
+                auto const* data  = static_cast<char const*>(buffer.data().data());
+                auto const length = buffer.size();
+                frame.clear();
+                if (not error and VenueT::pong(std::string_view{data, length}, frame)) {
+                    std::ignore = stream.write(boost::asio::buffer(frame), error);
+                }
+            }
+        }
+
+        spl::simulator::configuration configuration_;
+        std::vector<trade_type> trades_;
+        std::reference_wrapper<boost::asio::ssl::context> ssl_context_;
+    };
+
+} // namespace spl::simulator
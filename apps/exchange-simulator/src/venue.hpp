@@ -0,0 +1,126 @@
+#pragma once
+
+#include "spl/protocol/common/aggressor_side.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/types/decimal.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace spl::simulator {
+
+    namespace internal {
+
+        template <typename DecimalT>
+        auto append(std::string& frame, DecimalT const& value) -> void {
+            auto buffer       = std::array<char, 64>{};
+            auto const ending = value.template to_chars<spl::types::decimal_format::trimmed>(std::data(buffer));
+            frame.append(std::data(buffer), ending);
+        }
+
+        [[nodiscard]] constexpr auto milliseconds(std::chrono::system_clock::time_point time) noexcept -> std::int64_t {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count();
+        }
+
+    } // namespace internal
+
+    /**
+     * @brief Trade printed into a venue message: the generated trade, the sequence it is sent with and the wall
+     * clock it is stamped with.
+     */
+    struct print {
+        spl::protocol::feeder::trade::trade_summary const& trade;
+        std::uint64_t sequence;
+        std::chrono::system_clock::time_point time;
+    };
+
+    /**
+     * @brief Bybit v5 public stream: publicTrade snapshots, several trades per message.
+     */
+    struct bybit {
+        constexpr static auto exchange = spl::protocol::common::exchange_id::bybit;
+        constexpr static auto port     = std::uint16_t{9443};
+        constexpr static auto batch    = std::size_t{1024}; ///< Most trades a single message carries.
+
+        static auto subscribed(std::string& frame) -> void {
+            frame.append(R"({"success":true,"ret_msg":"","conn_id":"simulator","req_id":"","op":"subscribe"})");
+        }
+
+        /**
+         * @brief Answers the application-level ping of the client.
+         * @return False when the request is not a ping.
+         */
+        [[nodiscard]] static auto pong(std::string_view request, std::string& frame) -> bool {
+            if (request.find(R"("op":"ping")") == std::string_view::npos) {
+                return false;
+            }
+            frame.append(R"({"success":true,"ret_msg":"pong","conn_id":"simulator","req_id":"","op":"pong"})");
+            return true;
+        }
+
+        static auto open(std::string& frame, std::string_view instrument, std::chrono::system_clock::time_point time)
+            -> void {
+            constexpr auto head = std::string_view{R"({{"topic":"publicTrade.{}","type":"snapshot","ts":{},"data":[)"};
+            std::format_to(std::back_inserter(frame), head, instrument, internal::milliseconds(time));
+        }
+
+        static auto append(std::string& frame, std::string_view instrument, spl::simulator::print const& print,
+                           bool first) -> void {
+            auto const buy = print.trade.side == spl::protocol::common::aggressor_side::buy;
+            std::format_to(std::back_inserter(frame), R"({}{{"i":"{}","T":{},"p":")", first ? "" : ",", print.sequence,
+                           internal::milliseconds(print.time));
+            internal::append(frame, print.trade.price);
+            frame.append(R"(","v":")");
+            internal::append(frame, print.trade.quantity);
+            std::format_to(std::back_inserter(frame), R"(","S":"{}","seq":{},"s":"{}","BT":false,"RPI":false}})",
+                           buy ? "Buy" : "Sell", print.sequence, instrument);
+        }
+
+        static auto close(std::string& frame) -> void {
+            frame.append("]}");
+        }
+    };
+
+    /**
+     * @brief Coinbase Exchange websocket feed: one ticker message per trade.
+     */
+    struct coinbase {
+        constexpr static auto exchange = spl::protocol::common::exchange_id::coinbase;
+        constexpr static auto port     = std::uint16_t{9444};
+        constexpr static auto batch    = std::size_t{1};
+
+        static auto subscribed(std::string& frame) -> void {
+            frame.append(R"({"type":"subscriptions","channels":[{"name":"ticker","product_ids":[]}]})");
+        }
+
+        [[nodiscard]] static auto pong(std::string_view, std::string&) -> bool {
+            return false;
+        }
+
+        static auto open(std::string&, std::string_view, std::chrono::system_clock::time_point) -> void {}
+
+        static auto append(std::string& frame, std::string_view instrument, spl::simulator::print const& print, bool)
+            -> void {
+            auto const buy = print.trade.side == spl::protocol::common::aggressor_side::buy;
+            auto const now = std::chrono::floor<std::chrono::microseconds>(print.time);
+            std::format_to(std::back_inserter(frame), R"({{"type":"ticker","sequence":{},"product_id":"{}","price":")",
+                           print.sequence, instrument);
+            internal::append(frame, print.trade.price);
+            frame.append(R"(","open_24h":"0","volume_24h":"0","low_24h":"0","high_24h":"0","volume_30d":"0",)");
+            frame.append(R"("best_bid":"0","best_bid_size":"0","best_ask":"0","best_ask_size":"0",)");
+            std::format_to(std::back_inserter(frame), R"("side":"{}","time":"{:%FT%T}Z","trade_id":{},"last_size":")",
+                           buy ? "buy" : "sell", now, print.sequence);
+            internal::append(frame, print.trade.quantity);
+            frame.append(R"("})");
+        }
+
+        static auto close(std::string&) -> void {}
+    };
+
+} // namespace spl::simulator
@@ -0,0 +1,7 @@
+target("exchange-simulator")
+    set_kind("binary")
+    set_group("apps")
+    add_files("src/main.cpp")
+    add_deps("network", "metrics-generator", "logger", "protocol-feeder", "reflect")
+    add_packages("cli11")
+target_end()
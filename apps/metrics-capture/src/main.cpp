@@ -1,13 +1,22 @@
+#include "spl/components/feeder/journal.hpp"
+#include "spl/components/feeder/replay.hpp"
+#include "spl/components/publisher/publisher.hpp"
+#include "spl/components/sink/columnar.hpp"
+#include "spl/components/sink/csv.hpp"
+#include "spl/components/sink/writer.hpp"
+#include "spl/components/telemetry/report.hpp"
+#include "spl/container/ring.hpp"
 #include "spl/exchange/factory/feeder.hpp"
+#include "spl/metrics/candles.hpp"
 #include "spl/metrics/multimeter.hpp"
 #include "spl/logger/logger.hpp"
+#include "spl/protocol/feeder/candlestick/candlestick.hpp"
 #include "spl/protocol/feeder/trade/trade_summary.hpp"
 #include "spl/protocol/common/exchange_id.hpp"
 
 #include <CLI/CLI.hpp>
 
 #include <iostream>
-#include <fstream>
 #include <format>
 #include <chrono>
 #include <csignal>
@@ -15,6 +24,31 @@
 #include <string>
 #include <optional>
 #include <filesystem>
+#include <algorithm>
+#include <map>
+#include <variant>
+#include <vector>
+
+namespace {
+    std::atomic<bool> interrupted{false};
+
+    auto on_signal(int) -> void {
+        interrupted.store(true, std::memory_order_relaxed);
+    }
+} // namespace
+
+enum class output_format : std::uint8_t {
+    csv,
+    columnar,
+};
+
+template <std::size_t IntervalsV>
+using candles_type = spl::metrics::candles<spl::protocol::feeder::trade::trade_summary,
+                                           spl::protocol::feeder::candlestick::candlestick, IntervalsV>;
+
+/// Candle builder for the number of intervals requested, none when capturing the metrics.
+using candles_builder = std::variant<std::monostate, candles_type<1>, candles_type<2>, candles_type<3>,
+                                     candles_type<4>>;
 
 struct arguments {
     spl::protocol::common::exchange_id exchange_id{spl::protocol::common::exchange_id::coinbase};
@@ -22,7 +56,19 @@ struct arguments {
     spl::protocol::common::timestamp period{std::chrono::minutes(5)};
     spl::protocol::common::timestamp duration{std::chrono::hours(1)};
     spl::metrics::type type{spl::metrics::type::stream};
+    spl::exchange::common::environment environment{spl::exchange::common::environment::production};
+    std::size_t redundancy{1};
     std::optional<std::filesystem::path> output{};
+    output_format format{output_format::csv};
+    std::optional<std::string> publish{};
+    spl::components::sink::policy flush{};
+    std::optional<std::filesystem::path> record{};
+    std::optional<std::filesystem::path> replay{};
+    spl::components::feeder::pace pace{spl::components::feeder::pace::maximum};
+    std::optional<std::filesystem::path> latency{};
+    std::chrono::seconds latency_interval{10};
+    std::vector<spl::protocol::common::timestamp> candles{};
+    spl::protocol::common::timestamp sample{0};
 
     [[nodiscard]] static auto from(int argc, char** argv) noexcept -> spl::result<arguments> {
         CLI::App app{"Sparkland Metrics Capture - Real-time exchange metrics collector"};
@@ -30,18 +76,41 @@ struct arguments {
         auto args           = arguments{};
         auto exchange_str   = std::string(spl::reflect::enum_to_string(args.exchange_id));
         auto metrics_str    = std::string(spl::reflect::enum_to_string(args.type));
+        auto env_str        = std::string(spl::reflect::enum_to_string(args.environment));
         auto instrument_str = std::string(args.instrument_id);
         auto window         = std::chrono::duration_cast<std::chrono::minutes>(args.period).count();
         auto duration       = std::chrono::duration_cast<std::chrono::minutes>(args.duration).count();
         auto output         = std::string{};
+        auto format_str     = std::string(spl::reflect::enum_to_string(args.format));
+        auto publish        = std::string{};
+        auto flush_interval = args.flush.interval.count();
+        auto flush_size     = args.flush.size / 1024;
+        auto record         = std::string{};
+        auto replay         = std::string{};
+        auto pace_str       = std::string(spl::reflect::enum_to_string(args.pace));
+        auto latency        = std::string{};
+        auto latency_period = args.latency_interval.count();
+        auto candles        = std::vector<std::string>{};
+        auto sample         = std::chrono::duration_cast<std::chrono::milliseconds>(args.sample).count();
+
+        auto const intervals = std::map<std::string, spl::protocol::common::timestamp>{
+            {"1s", std::chrono::seconds(1)},   {"5s", std::chrono::seconds(5)},   {"15s", std::chrono::seconds(15)},
+            {"30s", std::chrono::seconds(30)}, {"1m", std::chrono::minutes(1)},   {"5m", std::chrono::minutes(5)},
+            {"15m", std::chrono::minutes(15)}, {"30m", std::chrono::minutes(30)}, {"1h", std::chrono::hours(1)},
+            {"4h", std::chrono::hours(4)},     {"1d", std::chrono::days(1)},
+        };
 
         app.add_option("-e,--exchange", exchange_str, "Exchange to connect to (bybit, coinbase)")
             ->default_val(exchange_str)
             ->check(CLI::IsMember({"bybit", "coinbase"}));
 
-        app.add_option("-m,--metrics", metrics_str, "Metrics type to use (stream, scan)")
+        app.add_option("--environment", env_str, "Endpoints to connect to (production, sandbox, simulator)")
+            ->default_val(env_str)
+            ->check(CLI::IsMember({"production", "sandbox", "simulator"}));
+
+        app.add_option("-m,--metrics", metrics_str, "Metrics type to use (stream, scan, sketch)")
             ->default_val(metrics_str)
-            ->check(CLI::IsMember({"stream", "scan"}));
+            ->check(CLI::IsMember({"stream", "scan", "sketch"}));
 
         app.add_option("-i,--instrument", instrument_str, "Instrument to track (e.g., BTCUSDT)")
             ->default_val(instrument_str);
@@ -54,7 +123,48 @@ struct arguments {
             ->default_val(60)
             ->check(CLI::PositiveNumber);
 
-        app.add_option("-o,--output", output, "Output CSV file path");
+        app.add_option("-r,--redundancy", args.redundancy, "Number of parallel connections to the exchange")
+            ->default_val(args.redundancy)
+            ->check(CLI::Range(1, 3));
+
+        app.add_option("-o,--output", output, "Output file path");
+
+        app.add_option("-f,--output-format", format_str, "Output file format (csv, columnar)")
+            ->default_val(format_str)
+            ->check(CLI::IsMember({"csv", "columnar"}));
+
+        app.add_option("--flush-interval", flush_interval, "Maximum time in milliseconds a record waits to be written")
+            ->default_val(flush_interval)
+            ->check(CLI::PositiveNumber);
+
+        app.add_option("--flush-size", flush_size, "Pending kilobytes that trigger a write to the output file")
+            ->default_val(flush_size)
+            ->check(CLI::PositiveNumber);
+
+        app.add_option("-p,--publish", publish, "Republish trades and metrics to a multicast group:port[/interface]");
+
+        auto* recording = app.add_option("--record", record, "Record the raw inbound frames into a journal file");
+
+        app.add_option("--replay", replay, "Replay a journal file instead of connecting to the exchange")
+            ->excludes(recording);
+
+        app.add_option("--pace", pace_str, "Replay speed (maximum, original)")
+            ->default_val(pace_str)
+            ->check(CLI::IsMember({"maximum", "original"}));
+
+        app.add_option("--latency", latency, "Append the per-stage latency percentiles to a stats file");
+
+        app.add_option("--latency-interval", latency_period, "Seconds between two latency reports")
+            ->default_val(latency_period)
+            ->check(CLI::PositiveNumber);
+
+        app.add_option("--candles", candles, "Capture candles instead of metrics, over up to four intervals (1s to 1d)")
+            ->expected(1, 4)
+            ->check(CLI::IsMember(intervals));
+
+        app.add_option("--sample", sample, "Milliseconds of trades between two metrics records, 0 for one per trade")
+            ->default_val(sample)
+            ->check(CLI::NonNegativeNumber);
 
         try {
             app.parse(argc, argv);
@@ -65,70 +175,303 @@ struct arguments {
 
         args.exchange_id   = spl::reflect::enum_from_string<spl::protocol::common::exchange_id>(exchange_str);
         args.type          = spl::reflect::enum_from_string<spl::metrics::type>(metrics_str);
+        args.environment   = spl::reflect::enum_from_string<spl::exchange::common::environment>(env_str);
         args.instrument_id = spl::protocol::common::instrument_id{instrument_str};
         args.period        = spl::protocol::common::timestamp{std::chrono::minutes(window)};
         args.duration      = spl::protocol::common::timestamp{std::chrono::minutes(duration)};
         args.output        = not std::empty(output) ? std::make_optional(std::filesystem::path{output}) : std::nullopt;
+        args.format        = spl::reflect::enum_from_string<output_format>(format_str);
+        args.publish       = not std::empty(publish) ? std::make_optional(publish) : std::nullopt;
+        args.record        = not std::empty(record) ? std::make_optional(std::filesystem::path{record}) : std::nullopt;
+        args.replay        = not std::empty(replay) ? std::make_optional(std::filesystem::path{replay}) : std::nullopt;
+        args.pace          = spl::reflect::enum_from_string<spl::components::feeder::pace>(pace_str);
+
+        args.flush.size     = flush_size * 1024;
+        args.flush.interval = std::chrono::milliseconds{flush_interval};
+
+        args.latency          = not std::empty(latency) ? std::make_optional(std::filesystem::path{latency})
+                                                    : std::nullopt;
+        args.latency_interval = std::chrono::seconds{latency_period};
+        args.sample           = std::chrono::milliseconds{sample};
+
+        // Every interval offered is a multiple of the shorter ones, so any of them rolls up from the finest
+        for (auto const& interval : candles) {
+            args.candles.push_back(intervals.at(interval));
+        }
+        std::ranges::sort(args.candles);
+        args.candles.erase(std::ranges::unique(args.candles).begin(), std::end(args.candles));
         return args;
     }
 };
 
-template <spl::protocol::common::exchange_id ExchangeIdV, spl::metrics::type MetricsTypeV,
+template <std::size_t IntervalsV>
+[[nodiscard]] auto make_candles(std::vector<spl::protocol::common::timestamp> const& intervals) -> candles_builder {
+    auto periods = typename candles_type<IntervalsV>::intervals_type{};
+    std::ranges::copy_n(std::begin(intervals), IntervalsV, std::begin(periods));
+    return candles_builder{std::in_place_type<candles_type<IntervalsV>>, periods};
+}
+
+[[nodiscard]] auto make_candles(std::vector<spl::protocol::common::timestamp> const& intervals) -> candles_builder {
+    switch (std::size(intervals)) {
+        case 1:
+            return make_candles<1>(intervals);
+        case 2:
+            return make_candles<2>(intervals);
+        case 3:
+            return make_candles<3>(intervals);
+        case 4:
+            return make_candles<4>(intervals);
+        default:
+            return candles_builder{};
+    }
+}
+
+template <spl::protocol::common::exchange_id ExchangeIdV, spl::metrics::type MetricsTypeV, std::size_t LegsV,
           spl::exchange::common::environment EnvironmentV = spl::exchange::common::environment::production>
 [[nodiscard]] constexpr auto execute(arguments const& args) -> spl::result<void> {
-    using session_type    = spl::exchange::factory::feeder<ExchangeIdV, EnvironmentV>;
-    using trade_summary   = spl::protocol::feeder::trade::trade_summary;
-    using multimeter_type = spl::metrics::multimeter<MetricsTypeV, trade_summary>;
+    using single_type      = spl::exchange::factory::feeder<ExchangeIdV, EnvironmentV>;
+    using redundant_type   = spl::exchange::factory::redundant_feeder<ExchangeIdV, LegsV, EnvironmentV>;
+    using session_type     = std::conditional_t<LegsV == 1, single_type, redundant_type>;
+    using replay_type      = spl::exchange::factory::replay<ExchangeIdV, EnvironmentV>;
+    using trade_summary    = spl::protocol::feeder::trade::trade_summary;
+    using multimeter_type  = spl::metrics::multimeter<MetricsTypeV, trade_summary, spl::container::ring>;
+    using csv_type         = spl::components::sink::writer<spl::components::sink::csv>;
+    using columnar_type    = spl::components::sink::writer<spl::components::sink::columnar<spl::metrics::metrics>>;
+    using candlestick      = spl::protocol::feeder::candlestick::candlestick;
+    using candles_csv      = spl::components::sink::writer<spl::components::sink::candlestick_csv>;
+    using candles_columnar = spl::components::sink::writer<spl::components::sink::columnar<candlestick>>;
 
-    auto output = std::ofstream{};
+    auto csv                = std::optional<csv_type>{};
+    auto columnar           = std::optional<columnar_type>{};
+    auto csv_candles        = std::optional<candles_csv>{};
+    auto columnar_candles   = std::optional<candles_columnar>{};
+    auto candles            = make_candles(args.candles);
+    auto const candlesticks = not std::holds_alternative<std::monostate>(candles);
     if (args.output) {
-        spl::logger::info("Exporting capture data to file: {}", args.output.value().string());
-        output.open(args.output.value(), std::ios::out);
-        if (not output.is_open()) {
-            return spl::failure("Failed to open output file: {}", args.output.value().string());
+        spl::logger::info("Exporting capture data to file: {} ({})", args.output.value().string(), args.format);
+        if (candlesticks and args.format == output_format::columnar) {
+            err_return(columnar_candles.emplace(args.flush).open(args.output.value()));
+        } else if (candlesticks) {
+            err_return(csv_candles.emplace(args.flush).open(args.output.value()));
+        } else if (args.format == output_format::columnar) {
+            err_return(columnar.emplace(args.flush).open(args.output.value()));
+        } else {
+            err_return(csv.emplace(args.flush).open(args.output.value()));
         }
     }
 
+    auto const emit = [&](candlestick const& candle) -> void {
+        if (csv_candles) {
+            std::ignore = csv_candles->push(candle);
+        } else if (columnar_candles) {
+            std::ignore = columnar_candles->push(candle);
+        } else {
+            spl::logger::info("{}", candle);
+        }
+    };
+
+    auto const build = [&](auto&& action) -> void {
+        std::visit(
+            [&]<typename BuilderT>(BuilderT& builder) {
+                if constexpr (not std::is_same_v<BuilderT, std::monostate>) {
+                    action(builder);
+                }
+            },
+            candles);
+    };
+
     auto context    = spl::network::context();
     auto identifier = spl::components::feeder::session_id{"metrics-capture", "exchange"};
-    auto session    = session_type(context, identifier);
     auto multimeter = multimeter_type(args.period);
+    auto publisher  = std::optional<spl::components::publisher::publisher<>>{};
+
+    if (args.publish) {
+        auto const& target   = args.publish.value();
+        auto const separator = target.find(':');
+        if (separator == std::string::npos) {
+            return spl::failure("Invalid publish target, expected group:port[/interface]: {}", target);
+        }
+        auto const slash = target.find('/', separator);
+        auto const group = target.substr(0, separator);
+        auto const port  = target.substr(separator + 1, slash - separator - 1);
+        auto const path  = slash == std::string::npos ? std::string{} : target.substr(slash);
+        spl::logger::info("Republishing trades and metrics to {}", target);
+        publisher.emplace(context);
+        err_return(publisher->connect(group, port, path));
+    }
+
+    auto telemetry = std::optional<spl::components::telemetry::reporter>{};
+    if constexpr (spl::components::telemetry::enabled) {
+        telemetry.emplace();
+        if (args.latency) {
+            spl::logger::info("Appending stage latencies to: {}", args.latency.value().string());
+            err_return(telemetry->open(args.latency.value()));
+        }
+    } else if (args.latency) {
+        spl::logger::warn("Built without telemetry (xmake f --telemetry=y), no latency will be recorded");
+    }
+
+    auto next_report   = std::chrono::steady_clock::now() + args.latency_interval;
+    auto const observe = [&]() -> spl::result<void> {
+        if (not telemetry) [[likely]] {
+            return spl::success();
+        }
+        if (auto const now = std::chrono::steady_clock::now(); now >= next_report) {
+            next_report = now + args.latency_interval;
+            return telemetry->report();
+        }
+        return spl::success();
+    };
 
-    spl::logger::info("Connecting to exchange {}...", ExchangeIdV);
-    err_return(session.connect());
-
-    spl::logger::info("Subscribing to {} trades...", args.instrument_id);
-    err_return(session.send(spl::protocol::feeder::stream::subscribe{
-        .exchange_id   = ExchangeIdV,
-        .instrument_id = args.instrument_id,
-        .channel       = spl::protocol::feeder::stream::channel::trades,
-    }));
-
-    spl::logger::info("Starting to capture metrics...");
-    auto const current_time = std::chrono::system_clock::now();
-    auto const end_time     = current_time + args.duration;
-    while (std::chrono::system_clock::now() < end_time) {
-        err_return(session.poll([&]<typename EventT>(EventT&& event) -> spl::result<void> {
-            if constexpr (requires { multimeter(std::forward<EventT>(event)); }) {
-                auto const metrics = multimeter(std::forward<EventT>(event));
-                if (output.is_open()) {
-                    output << std::format("{},{},{},{},{}\n",        //
-                                          metrics.timestamp.count(), //
-                                          metrics.minimum,           //
-                                          metrics.maximum,           //
-                                          metrics.median,            //
-                                          metrics.mean);
-                    output.flush();
-                    return spl::success();
+    // Every trade updates the metrics, but only the first one of each sampling period reads them into a record
+    auto next_sample  = spl::protocol::common::timestamp::zero();
+    auto const sample = [&](auto&& event) -> std::optional<spl::metrics::metrics> {
+        SPL_TELEMETRY_PROBE(metrics);
+        auto const timestamp = event.timestamp;
+        multimeter.update(std::forward<decltype(event)>(event));
+        if (args.sample != spl::protocol::common::timestamp::zero()) {
+            if (timestamp < next_sample) {
+                return std::nullopt;
+            }
+            next_sample = timestamp - timestamp % args.sample + args.sample;
+        }
+        return multimeter.snapshot();
+    };
+
+    auto const handler = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        if constexpr (requires { multimeter(std::forward<EventT>(event)); }) {
+            [[maybe_unused]] auto const received = event.received;
+            if (publisher) {
+                SPL_TELEMETRY_PROBE(output);
+                err_return((*publisher)(event));
+            }
+            if (candlesticks) {
+                SPL_TELEMETRY_PROBE(metrics);
+                build([&](auto& builder) { builder(event, emit); });
+            } else if (auto const metrics = sample(std::forward<EventT>(event))) {
+                SPL_TELEMETRY_PROBE(output);
+                if (publisher) {
+                    err_return((*publisher)(ExchangeIdV, args.instrument_id, *metrics));
+                }
+                if (csv) {
+                    std::ignore = csv->push(*metrics);
+                } else if (columnar) {
+                    std::ignore = columnar->push(*metrics);
+                } else {
+                    spl::logger::info("{}", *metrics);
                 }
-                spl::logger::info("{}", metrics);
             }
-            return spl::success();
+            // Recorded timestamps of a replay are in the past, only a live session has a meaningful end to end.
+            if constexpr (spl::components::telemetry::enabled) {
+                auto const now = std::chrono::system_clock::now().time_since_epoch();
+                if (not args.replay and now > received) {
+                    SPL_TELEMETRY_RECORD(end_to_end, static_cast<std::uint64_t>((now - received).count()));
+                }
+            }
+        }
+        return spl::success();
+    };
+
+    if (args.replay) {
+        auto replay = replay_type(context, identifier, args.pace);
+        err_return(replay.open(args.replay.value()));
+
+        spl::logger::info("Starting to replay metrics...");
+        while (not interrupted.load(std::memory_order_relaxed) and not replay.exhausted()) {
+            err_return(replay.poll(handler));
+            if (publisher) {
+                err_return(publisher->flush());
+            }
+            err_return(observe());
+        }
+        spl::logger::info("Replayed {} frames", replay.replayed());
+    } else {
+        auto session = session_type(context, identifier);
+        auto journal = spl::components::feeder::journal{};
+        if (args.record) {
+            if constexpr (LegsV != 1) {
+                return spl::failure("Recording a journal requires a single connection (--redundancy 1)");
+            } else {
+                spl::logger::info("Recording inbound frames to: {}", args.record.value().string());
+                err_return(journal.open(args.record.value(), ExchangeIdV));
+                session.record(&journal);
+            }
+        }
+
+        spl::logger::info("Connecting to exchange {}...", ExchangeIdV);
+        err_return(session.connect());
+
+        spl::logger::info("Subscribing to {} trades...", args.instrument_id);
+        err_return(session.send(spl::protocol::feeder::stream::subscribe{
+            .exchange_id   = ExchangeIdV,
+            .instrument_id = args.instrument_id,
+            .channel       = spl::protocol::feeder::stream::channel::trades,
         }));
+
+        spl::logger::info("Starting to capture metrics...");
+        auto const current_time = std::chrono::system_clock::now();
+        auto const end_time     = current_time + args.duration;
+        while (not interrupted.load(std::memory_order_relaxed) and std::chrono::system_clock::now() < end_time) {
+            err_return(session.poll(handler));
+            if (publisher) {
+                err_return(publisher->flush());
+            }
+            // Closes the candles a quiet market leaves open, which no trade would close
+            if (candlesticks) {
+                auto const now = spl::protocol::common::timestamp{std::chrono::system_clock::now().time_since_epoch()};
+                build([&](auto& builder) { builder.close(now, emit); });
+            }
+            err_return(observe());
+        }
+        err_return(journal.close());
+    }
+    if (telemetry) {
+        err_return(telemetry->report());
+    }
+    if (columnar_candles) {
+        return columnar_candles->close();
+    }
+    if (csv_candles) {
+        return csv_candles->close();
+    }
+    if (columnar) {
+        return columnar->close();
+    }
+    if (csv) {
+        return csv->close();
     }
     return spl::success();
 }
 
+template <spl::protocol::common::exchange_id ExchangeIdV, spl::metrics::type MetricsTypeV,
+          spl::exchange::common::environment EnvironmentV>
+[[nodiscard]] constexpr auto execute(arguments const& args) -> spl::result<void> {
+    switch (args.redundancy) {
+        case 1:
+            return execute<ExchangeIdV, MetricsTypeV, 1, EnvironmentV>(args);
+        case 2:
+            return execute<ExchangeIdV, MetricsTypeV, 2, EnvironmentV>(args);
+        case 3:
+            return execute<ExchangeIdV, MetricsTypeV, 3, EnvironmentV>(args);
+        default:
+            return spl::failure("Unsupported redundancy level: {}", args.redundancy);
+    }
+}
+
+template <spl::protocol::common::exchange_id ExchangeIdV, spl::metrics::type MetricsTypeV>
+[[nodiscard]] constexpr auto execute(arguments const& args) -> spl::result<void> {
+    switch (args.environment) {
+        case spl::exchange::common::environment::production:
+            return execute<ExchangeIdV, MetricsTypeV, spl::exchange::common::environment::production>(args);
+        case spl::exchange::common::environment::sandbox:
+            return execute<ExchangeIdV, MetricsTypeV, spl::exchange::common::environment::sandbox>(args);
+        case spl::exchange::common::environment::simulator:
+            return execute<ExchangeIdV, MetricsTypeV, spl::exchange::common::environment::simulator>(args);
+        default:
+            return spl::failure("Unsupported environment");
+    }
+}
+
 template <spl::metrics::type MetricsTypeV>
 [[nodiscard]] constexpr auto execute(arguments const& args) -> spl::result<void> {
     switch (args.exchange_id) {
@@ -147,6 +490,8 @@ template <spl::metrics::type MetricsTypeV>
             return execute<spl::metrics::type::stream>(args);
         case spl::metrics::type::scan:
             return execute<spl::metrics::type::scan>(args);
+        case spl::metrics::type::sketch:
+            return execute<spl::metrics::type::sketch>(args);
         default:
             return spl::failure("Unsupported metrics type");
     }
@@ -161,6 +506,8 @@ template <spl::metrics::type MetricsTypeV>
 }
 
 auto main(int argc, char** argv) -> int {
+    std::signal(SIGINT, on_signal);
+    std::signal(SIGTERM, on_signal);
     if (auto const result = execute(argc, argv); spl::failed(result)) {
         spl::logger::error("Application error: {}", result.error().message().data());
         return -1;
@@ -1 +1,2 @@
 includes("metrics-capture")
+includes("exchange-simulator")
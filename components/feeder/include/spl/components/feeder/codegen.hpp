@@ -1,11 +1,14 @@
 #pragma once
 
 #include "spl/concepts/object.hpp"
+#include "spl/network/client/udp.hpp"
 #include "spl/network/client/wss.hpp"
 #include "spl/core/unused.hpp"
 #include "spl/result/result.hpp"
 #include "spl/components/feeder/session.hpp"
 #include "spl/components/feeder/direction.hpp"
+#include "spl/components/feeder/journal.hpp"
+#include "spl/components/telemetry/probe.hpp"
 #include "spl/protocol/feeder/stream/ping.hpp"
 #include "spl/protocol/feeder/stream/pong.hpp"
 #include "spl/protocol/feeder/stream/heartbeat.hpp"
@@ -23,14 +26,25 @@ namespace spl::components::feeder {
         template <typename ConnectionT>
         struct traits;
 
-        template <>
-        struct traits<spl::network::client::wss> {
+        template <typename SocketT, spl::network::socket::layer::deflate CompressionV>
+        struct traits<spl::network::socket::layer::websocket<SocketT, CompressionV>> {
             template <spl::components::feeder::direction TypeV>
             using buffer_type = std::conditional_t<TypeV == spl::components::feeder::direction::inbound,
                                                    boost::beast::flat_buffer, std::vector<char>>;
             constexpr static auto serializable = true;
         };
 
+        template <typename SocketT, std::size_t BatchV, std::size_t DatagramV>
+        struct traits<spl::network::socket::layer::multicast<SocketT, BatchV, DatagramV>> {
+            using connection_type = spl::network::socket::layer::multicast<SocketT, BatchV, DatagramV>;
+
+            // The inbound buffer is the fixed receive slab: no clear/resize on the hot path, recvmmsg fills it.
+            template <spl::components::feeder::direction TypeV>
+            using buffer_type = std::conditional_t<TypeV == spl::components::feeder::direction::inbound,
+                                                   typename connection_type::slab_type, std::vector<char>>;
+            constexpr static auto serializable = false;
+        };
+
     } // namespace internal
 
     template <typename TraitT>
@@ -127,10 +141,41 @@ namespace spl::components::feeder {
             }
 
             logger::debug("{} <= {}", this->id(), std::string_view(std::data(data), std::size(data)));
-            err_return(decode(data, handler));
+            auto const received = this->received();
+            if (journal_ != nullptr) [[unlikely]] {
+                err_return(journal_->append(received, data));
+            }
+            auto const stamped = [&]<typename EventT>(EventT&& event) -> result<void> {
+                if constexpr (requires { event.received = received; }) {
+                    event.received = received;
+                }
+                return handler(std::forward<EventT>(event));
+            };
+            err_return(decode(data, stamped));
             return base_type::poll(intermediary);
         }
 
+        /**
+         * @brief Arrival time of the last inbound message, as stamped by the kernel when the connection enables
+         * SO_TIMESTAMPING, otherwise the wall clock right after the read.
+         */
+        [[nodiscard]] constexpr auto received() const noexcept -> std::chrono::nanoseconds {
+            if constexpr (requires(connection_type const& connection) { connection.received(); }) {
+                if (auto const kernel = this->connection().received(); kernel.count() != 0) [[likely]] {
+                    return kernel;
+                }
+            }
+            auto const now = std::chrono::system_clock::now().time_since_epoch();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(now);
+        }
+
+        /**
+         * @brief Records every inbound frame, as handed to the decoder, into the journal until detached with nullptr.
+         */
+        constexpr auto record(spl::components::feeder::journal* journal) noexcept -> void {
+            journal_ = journal;
+        }
+
         template <typename InstanceT>
         constexpr auto attach(InstanceT&& instance) noexcept -> void {
             base_type::connector().connection().attach(std::forward<InstanceT>(instance));
@@ -155,8 +200,10 @@ namespace spl::components::feeder {
             auto view = std::span<char const>{std::data(buffer), std::size(buffer)};
             while (not std::empty(view)) {
                 auto const transformation = [&]<typename EventT>(EventT&& event) -> result<void> {
+                    SPL_TELEMETRY_PROBE(transform);
                     return transformer_(std::forward<EventT>(event), handler);
                 };
+                SPL_TELEMETRY_PROBE(decode);
                 auto const processed = err_return(decoder_(view, transformation));
                 view                 = view.subspan(processed);
             }
@@ -168,6 +215,7 @@ namespace spl::components::feeder {
             if (available == 0) [[likely]] {
                 return std::span<char const>{};
             }
+            SPL_TELEMETRY_PROBE(read);
             clear<spl::components::feeder::direction ::inbound>();
             resize<spl::components::feeder::direction ::inbound>(available);
             return read(buffer<spl::components::feeder::direction ::inbound>());
@@ -257,6 +305,7 @@ namespace spl::components::feeder {
         buffer_type<spl::components::feeder::direction::inbound> inbound_buffer_{};
         buffer_type<spl::components::feeder::direction::outbound> outbound_buffer_{};
         transformer_type transformer_{};
+        spl::components::feeder::journal* journal_{nullptr};
     };
 
 } // namespace spl::components::feeder
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "spl/container/flat_unordered_map.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace spl::components::feeder {
+
+    /**
+     * @brief First-arrival filter for trades received over several redundant connections.
+     *
+     * Every trade is reduced to a fingerprint built from the instrument, the exchange sequence and the trade
+     * identifier. The filter remembers the last CapacityV trades in a ring, so the memory footprint is fixed and a
+     * copy is recognised as long as the slowest connection lags less than CapacityV trades behind the fastest one. A
+     * matching fingerprint only drops the trade once the instrument, sequence and trade identifier are confirmed
+     * equal: a different trade sharing the fingerprint is forwarded, without being remembered.
+     *
+     * @tparam CapacityV Number of fingerprints kept in the history.
+     */
+    template <std::size_t CapacityV = 4096>
+    struct deduplicator {
+        static_assert(CapacityV > 0, "deduplicator requires a non-empty history");
+
+        using value_type = spl::protocol::feeder::trade::trade_summary;
+
+        constexpr deduplicator() : history_(CapacityV) {
+            seen_.reserve(CapacityV);
+        }
+
+        /**
+         * @brief Registers the trade and reports whether it is the first copy observed.
+         * @return true if the trade has not been seen before, false if it is a duplicate.
+         */
+        [[nodiscard, gnu::hot]] constexpr auto operator()(value_type const& trade) noexcept -> bool {
+            auto const key = fingerprint(trade);
+            if (auto const found = seen_.find(key); found != std::end(seen_)) {
+                return not history_[found->second].matches(trade);
+            }
+
+            auto& entry = history_[head_];
+            if (size_ == CapacityV) [[likely]] {
+                seen_.erase(entry.fingerprint);
+            } else {
+                ++size_;
+            }
+            entry.fingerprint   = key;
+            entry.instrument_id = trade.instrument_id;
+            entry.sequence      = trade.sequence;
+            entry.trade_id      = trade.trade_id;
+            seen_.emplace(key, head_);
+            head_ = (head_ + 1) % CapacityV;
+            return true;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr static auto capacity() noexcept -> std::size_t {
+            return CapacityV;
+        }
+
+        constexpr auto clear() noexcept -> void {
+            seen_.clear();
+            head_ = 0;
+            size_ = 0;
+        }
+
+    private:
+        /**
+         * @brief Trade remembered in a slot of the history, to confirm a matching fingerprint.
+         */
+        struct entry {
+            std::uint64_t fingerprint{0};
+            spl::protocol::common::instrument_id instrument_id{};
+            spl::protocol::common::sequence sequence{0};
+            spl::protocol::common::trade_id trade_id{};
+
+            [[nodiscard]] constexpr auto matches(value_type const& trade) const noexcept -> bool {
+                return sequence == trade.sequence and trade_id == trade.trade_id and
+                       instrument_id == trade.instrument_id;
+            }
+        };
+
+        [[nodiscard]] constexpr static auto fingerprint(value_type const& trade) noexcept -> std::uint64_t {
+            constexpr auto golden = std::uint64_t{0x9E3779B97F4A7C15};
+            auto const instrument = std::hash<spl::protocol::common::instrument_id>{}(trade.instrument_id);
+            auto const identifier = std::hash<spl::protocol::common::trade_id>{}(trade.trade_id);
+            return (trade.sequence * golden) ^ identifier ^ std::rotl(static_cast<std::uint64_t>(instrument), 32);
+        }
+
+        spl::container::flat_unordered_map<std::uint64_t, std::size_t> seen_{}; ///< Slot of every fingerprint.
+        std::vector<entry> history_;                                             ///< Ring of the last trades.
+        std::size_t head_{0};
+        std::size_t size_{0};
+    };
+
+} // namespace spl::components::feeder
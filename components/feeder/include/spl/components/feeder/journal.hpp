@@ -0,0 +1,320 @@
+#pragma once
+
+#include "spl/logger/logger.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/result/result.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace spl::components::feeder {
+
+    /**
+     * @brief Leading bytes of a journal, followed by the frames back to back.
+     */
+    struct journal_header {
+        constexpr static auto signature = std::uint32_t{0x4A4C5053}; ///< "SPLJ" in little endian.
+        constexpr static auto revision  = std::uint16_t{1};
+
+        std::uint32_t magic;                             ///< Always signature.
+        std::uint16_t version;                           ///< Layout revision.
+        spl::protocol::common::exchange_id exchange_id;  ///< Venue the frames were received from.
+        std::uint8_t reserved;                           ///< Always zero.
+        std::int64_t created;                            ///< Wall clock at creation, in nanoseconds since epoch.
+    };
+
+    /**
+     * @brief Header of a recorded frame, followed by the payload padded to 8 bytes.
+     */
+    struct frame_header {
+        std::uint32_t length;    ///< Payload bytes, a zero length marks the end of the journal.
+        std::uint32_t reserved;  ///< Always zero.
+        std::int64_t received;   ///< Receive timestamp of the frame, in nanoseconds since epoch.
+    };
+
+    static_assert(sizeof(journal_header) == 16, "spl::components::feeder::journal_header must be 16 bytes");
+    static_assert(sizeof(frame_header) == 16, "spl::components::feeder::frame_header must be 16 bytes");
+
+    /**
+     * @brief Append-only recorder of the raw inbound frames of a session.
+     *
+     * The file is grown in segments and mapped, so recording a frame is a copy into the mapping and never a system
+     * call on the read path; the kernel writes the pages back on its own. The file keeps the layout of the mapping,
+     * headers aligned to 8 bytes, so the journal can be mapped back and replayed in place.
+     */
+    class journal {
+    public:
+        constexpr static auto segment = std::size_t{64 * 1024 * 1024};
+
+        constexpr journal() noexcept = default;
+
+        journal(journal const&)                    = delete;
+        auto operator=(journal const&) -> journal& = delete;
+        journal(journal&&)                         = delete;
+        auto operator=(journal&&) -> journal&      = delete;
+
+        ~journal() {
+            std::ignore = close();
+        }
+
+        /**
+         * @brief Creates (or truncates) the journal of the given venue.
+         */
+        [[nodiscard]] auto open(std::filesystem::path const& path, spl::protocol::common::exchange_id exchange_id)
+            -> spl::result<void> {
+            if (descriptor_ != -1) [[unlikely]] {
+                return spl::failure("journal: already recording to a file");
+            }
+
+            descriptor_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (descriptor_ == -1) [[unlikely]] {
+                return spl::failure("journal: unable to open {} ({})", path.string(), std::strerror(errno));
+            }
+            err_return(grow(segment));
+
+            auto const now    = std::chrono::system_clock::now().time_since_epoch();
+            auto const header = spl::components::feeder::journal_header{
+                .magic       = spl::components::feeder::journal_header::signature,
+                .version     = spl::components::feeder::journal_header::revision,
+                .exchange_id = exchange_id,
+                .reserved    = 0,
+                .created     = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count(),
+            };
+            std::memcpy(data_, &header, sizeof(header));
+            size_ = sizeof(header);
+            return spl::success();
+        }
+
+        /**
+         * @brief Records a frame, empty frames are skipped since a zero length ends the journal.
+         */
+        [[nodiscard, gnu::hot]] auto append(std::chrono::nanoseconds received, std::span<char const> frame) noexcept
+            -> spl::result<void> {
+            if (std::empty(frame)) [[unlikely]] {
+                return spl::success();
+            }
+
+            auto const padded   = (std::size(frame) + 7) & ~std::size_t{7};
+            auto const required = size_ + sizeof(frame_header) + padded + sizeof(frame_header);
+            if (required > capacity_) [[unlikely]] {
+                err_return(grow(std::max(required, capacity_ + segment)));
+            }
+
+            auto const header = spl::components::feeder::frame_header{
+                .length   = static_cast<std::uint32_t>(std::size(frame)),
+                .reserved = 0,
+                .received = received.count(),
+            };
+            std::memcpy(data_ + size_, &header, sizeof(header));
+            std::memcpy(data_ + size_ + sizeof(header), std::data(frame), std::size(frame));
+            size_ += sizeof(header) + padded;
+            ++frames_;
+            return spl::success();
+        }
+
+        /**
+         * @brief Unmaps the journal and trims the file to the recorded frames.
+         */
+        [[nodiscard]] auto close() noexcept -> spl::result<void> {
+            if (descriptor_ == -1) {
+                return spl::success();
+            }
+
+            std::ignore       = ::munmap(data_, capacity_);
+            auto const failed = ::ftruncate(descriptor_, static_cast<off_t>(size_)) != 0;
+            std::ignore       = ::close(descriptor_);
+            logger::info("Journal closed with {} frames ({} bytes)", frames_, size_);
+            descriptor_ = -1;
+            data_       = nullptr;
+            capacity_   = 0;
+            if (failed) [[unlikely]] {
+                return spl::failure("journal: unable to trim the file ({})", std::strerror(errno));
+            }
+            return spl::success();
+        }
+
+        [[nodiscard]] constexpr auto frames() const noexcept -> std::size_t {
+            return frames_;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+            return size_;
+        }
+
+    private:
+        [[nodiscard]] auto grow(std::size_t capacity) noexcept -> spl::result<void> {
+            if (::ftruncate(descriptor_, static_cast<off_t>(capacity)) != 0) [[unlikely]] {
+                return spl::failure("journal: unable to grow the file to {} bytes ({})", capacity,
+                                    std::strerror(errno));
+            }
+
+            auto* const mapped = data_ == nullptr
+                                     ? ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor_, 0)
+                                     : ::mremap(data_, capacity_, capacity, MREMAP_MAYMOVE);
+            if (mapped == MAP_FAILED) [[unlikely]] {
+                return spl::failure("journal: unable to map {} bytes ({})", capacity, std::strerror(errno));
+            }
+            data_     = static_cast<char*>(mapped);
+            capacity_ = capacity;
+            return spl::success();
+        }
+
+        int descriptor_{-1};
+        char* data_{nullptr};
+        std::size_t capacity_{0};
+        std::size_t size_{0};
+        std::size_t frames_{0};
+    };
+
+    /**
+     * @brief Read-only mapping of a journal, iterated frame by frame in recording order.
+     *
+     * A journal cut short (i.e. the recorder was killed) ends at the last complete frame, the segment tail is zeroed
+     * by the kernel and a zero length stops the iteration.
+     */
+    class playback {
+    public:
+        struct frame {
+            std::chrono::nanoseconds received;  ///< Receive timestamp recorded with the frame.
+            std::span<char const> payload;      ///< Frame bytes, a view into the mapping.
+        };
+
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = frame;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = frame const*;
+            using reference         = frame const&;
+
+            constexpr iterator() noexcept = default;
+
+            iterator(char const* position, char const* end) noexcept : position_(position), end_(end) {
+                load();
+            }
+
+            [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+                return current_;
+            }
+
+            [[nodiscard]] constexpr auto operator->() const noexcept -> pointer {
+                return &current_;
+            }
+
+            auto operator++() noexcept -> iterator& {
+                position_ += sizeof(frame_header) + ((std::size(current_.payload) + 7) & ~std::size_t{7});
+                load();
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> iterator {
+                auto const previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            [[nodiscard]] constexpr auto operator==(iterator const& other) const noexcept -> bool {
+                return position_ == other.position_;
+            }
+
+        private:
+            auto load() noexcept -> void {
+                if (position_ == nullptr or std::cmp_less(end_ - position_, sizeof(frame_header))) {
+                    position_ = nullptr;
+                    return;
+                }
+                auto const& header = *reinterpret_cast<spl::components::feeder::frame_header const*>(position_);
+                auto const payload = position_ + sizeof(frame_header);
+                if (header.length == 0 or std::cmp_less(end_ - payload, header.length)) {
+                    position_ = nullptr;
+                    return;
+                }
+                current_ = frame{
+                    .received = std::chrono::nanoseconds{header.received},
+                    .payload  = std::span<char const>{payload, header.length},
+                };
+            }
+
+            char const* position_{nullptr};
+            char const* end_{nullptr};
+            frame current_{};
+        };
+
+        constexpr playback() noexcept = default;
+
+        playback(playback const&)                    = delete;
+        auto operator=(playback const&) -> playback& = delete;
+        playback(playback&&)                         = delete;
+        auto operator=(playback&&) -> playback&      = delete;
+
+        ~playback() {
+            close();
+        }
+
+        [[nodiscard]] auto open(std::filesystem::path const& path) -> spl::result<void> {
+            close();
+            auto const descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (descriptor == -1) [[unlikely]] {
+                return spl::failure("journal: unable to open {} ({})", path.string(), std::strerror(errno));
+            }
+
+            struct stat status {};
+            auto const stated = ::fstat(descriptor, &status) == 0;
+            auto const length = stated ? static_cast<std::size_t>(status.st_size) : std::size_t{0};
+            auto* const data  = length >= sizeof(journal_header)
+                                    ? ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0)
+                                    : MAP_FAILED;
+            std::ignore = ::close(descriptor);
+            if (data == MAP_FAILED) [[unlikely]] {
+                return spl::failure("journal: unable to map {}", path.string());
+            }
+            data_       = static_cast<char const*>(data);
+            size_       = length;
+            std::ignore = ::madvise(data, size_, MADV_SEQUENTIAL);
+
+            auto const& header = this->header();
+            if (header.magic != journal_header::signature or header.version != journal_header::revision) [[unlikely]] {
+                close();
+                return spl::failure("journal: {} is not a frame journal", path.string());
+            }
+            return spl::success();
+        }
+
+        auto close() noexcept -> void {
+            if (data_ != nullptr) {
+                std::ignore = ::munmap(const_cast<char*>(data_), size_);
+            }
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        [[nodiscard]] auto header() const noexcept -> spl::components::feeder::journal_header const& {
+            return *reinterpret_cast<spl::components::feeder::journal_header const*>(data_);
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> iterator {
+            return data_ == nullptr ? end() : iterator{data_ + sizeof(journal_header), data_ + size_};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> iterator {
+            return iterator{};
+        }
+
+    private:
+        char const* data_{nullptr};
+        std::size_t size_{0};
+    };
+
+} // namespace spl::components::feeder
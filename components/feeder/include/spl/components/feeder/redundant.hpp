@@ -0,0 +1,188 @@
+#pragma once
+
+#include "spl/components/feeder/codegen.hpp"
+#include "spl/components/feeder/deduplicator.hpp"
+#include "spl/components/feeder/session_id.hpp"
+#include "spl/protocol/feeder/stream/subscribe.hpp"
+#include "spl/protocol/feeder/stream/unsubscribe.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/result/result.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <format>
+#include <utility>
+#include <vector>
+
+namespace spl::components::feeder {
+
+    /**
+     * @brief Warm-standby feeder that keeps LegsV parallel connections to the same endpoint.
+     *
+     * Every leg is an independent codegen session subscribed to the same instruments. Trades are forwarded on first
+     * arrival and the copies delivered by the slower legs are dropped by the deduplicator. A leg that dies keeps
+     * reconnecting through its own connector backoff, while the remaining legs keep feeding the handler, so there
+     * is no gap waiting for the reconnection. Once a leg is back, the active subscriptions are replayed on it.
+     *
+     * @tparam TraitT Exchange contract shared by all the legs.
+     * @tparam LegsV Number of parallel connections.
+     * @tparam DeduplicatorT First-arrival filter applied to the trades.
+     */
+    template <typename TraitT, std::size_t LegsV, typename DeduplicatorT = spl::components::feeder::deduplicator<>>
+    class redundant {
+        static_assert(LegsV > 0, "redundant feeder requires at least one leg");
+
+    public:
+        using contract_type     = std::decay_t<TraitT>;
+        using session_type      = spl::components::feeder::codegen<TraitT>;
+        using deduplicator_type = DeduplicatorT;
+
+        constexpr redundant(spl::network::context& context, spl::components::feeder::session_id const& session_id) :
+            legs_(make(context, session_id, std::make_index_sequence<LegsV>{})) {}
+
+        [[nodiscard]] constexpr auto connect() noexcept -> spl::result<void> {
+            auto connected = std::size_t{0};
+            for (auto index = std::size_t{0}; index < LegsV; ++index) {
+                auto& leg = legs_[index];
+                if (auto const operation = leg.connect(); spl::failed(operation)) [[unlikely]] {
+                    auto const* msg = operation.error().message().data();
+                    logger::warn("Redundant leg {}: unable to connect ({})", leg.id(), msg);
+                    continue;
+                }
+                ready_[index] = leg.ready();
+                connected += ready_[index] ? 1 : 0;
+            }
+
+            if (connected == 0) [[unlikely]] {
+                return spl::failure("redundant feeder failed: none of the {} legs could connect", LegsV);
+            }
+            logger::info("Redundant feeder connected with {}/{} legs", connected, LegsV);
+            return spl::success();
+        }
+
+        [[nodiscard]] constexpr auto configure(std::chrono::nanoseconds heartbeat,
+                                               std::chrono::nanoseconds ping) noexcept -> bool {
+            auto configured = true;
+            for (auto& leg : legs_) {
+                configured = leg.configure(heartbeat, ping) and configured;
+            }
+            return configured;
+        }
+
+        template <spl::concepts::object ObjectT>
+        [[nodiscard]] constexpr auto send(ObjectT const& object) noexcept -> result<void> {
+            remember(object);
+
+            auto delivered = std::size_t{0};
+            for (auto& leg : legs_) {
+                if (not leg.ready()) [[unlikely]] {
+                    continue;
+                }
+                if (auto const operation = leg.send(object); spl::failed(operation)) [[unlikely]] {
+                    logger::warn("Redundant leg {}: unable to send ({})", leg.id(), operation.error().message().data());
+                    continue;
+                }
+                ++delivered;
+            }
+
+            if (delivered == 0) [[unlikely]] {
+                return spl::failure("redundant feeder failed: none of the {} legs accepted the message", LegsV);
+            }
+            return spl::success();
+        }
+
+        template <typename HandlerT>
+        [[nodiscard, gnu::hot]] constexpr auto poll(HandlerT&& handler) noexcept -> result<void> {
+            auto rejected     = false;
+            auto const filter = [&]<typename EventT>(EventT&& event) -> result<void> {
+                if constexpr (std::is_same_v<std::decay_t<EventT>, spl::protocol::feeder::trade::trade_summary>) {
+                    if (not deduplicator_(event)) {
+                        return spl::success();
+                    }
+                }
+                auto forwarded = handler(std::forward<EventT>(event));
+                rejected       = spl::failed(forwarded);
+                return forwarded;
+            };
+
+            auto alive = std::size_t{0};
+            for (auto index = std::size_t{0}; index < LegsV; ++index) {
+                auto& leg = legs_[index];
+                if (auto const operation = leg.poll(filter); spl::failed(operation)) [[unlikely]] {
+                    if (rejected) {
+                        return spl::failure("{}", operation.error().message().data());
+                    }
+                    logger::warn("Redundant leg {}: dropped ({})", leg.id(), operation.error().message().data());
+                    continue;
+                }
+
+                auto const ready = leg.ready();
+                if (ready and not ready_[index]) [[unlikely]] {
+                    err_return(resubscribe(leg));
+                }
+                ready_[index] = ready;
+                ++alive;
+            }
+
+            if (alive == 0) [[unlikely]] {
+                return spl::failure("redundant feeder failed: all the {} legs are exhausted", LegsV);
+            }
+            return spl::success();
+        }
+
+        [[nodiscard]] constexpr auto ready() const noexcept -> bool {
+            return std::ranges::any_of(legs_, [](auto const& leg) { return leg.ready(); });
+        }
+
+        [[nodiscard]] constexpr auto legs() noexcept -> std::array<session_type, LegsV>& {
+            return legs_;
+        }
+
+        [[nodiscard]] constexpr auto legs() const noexcept -> std::array<session_type, LegsV> const& {
+            return legs_;
+        }
+
+        [[nodiscard]] constexpr auto deduplicator() const noexcept -> deduplicator_type const& {
+            return deduplicator_;
+        }
+
+    private:
+        template <std::size_t... IndexV>
+        [[nodiscard]] constexpr static auto make(spl::network::context& context,
+                                                 spl::components::feeder::session_id const& session_id,
+                                                 std::index_sequence<IndexV...>) -> std::array<session_type, LegsV> {
+            return {session_type(context, spl::components::feeder::session_id{
+                                              session_id.initiator(),
+                                              std::format("{}#{}", session_id.acceptor(), IndexV),
+                                          })...};
+        }
+
+        template <typename ObjectT>
+        constexpr auto remember(ObjectT const& object) noexcept -> void {
+            if constexpr (std::is_same_v<ObjectT, spl::protocol::feeder::stream::subscribe>) {
+                subscriptions_.push_back(object);
+            } else if constexpr (std::is_same_v<ObjectT, spl::protocol::feeder::stream::unsubscribe>) {
+                std::erase_if(subscriptions_, [&](auto const& subscription) {
+                    return subscription.instrument_id == object.instrument_id and
+                           subscription.channel == object.channel;
+                });
+            }
+        }
+
+        [[nodiscard]] constexpr auto resubscribe(session_type& leg) noexcept -> result<void> {
+            logger::info("Redundant leg {}: recovered, replaying {} subscriptions", leg.id(), subscriptions_.size());
+            for (auto const& subscription : subscriptions_) {
+                err_return(leg.send(subscription));
+            }
+            return spl::success();
+        }
+
+        std::array<session_type, LegsV> legs_;
+        std::array<bool, LegsV> ready_{};
+        std::vector<spl::protocol::feeder::stream::subscribe> subscriptions_{};
+        deduplicator_type deduplicator_{};
+    };
+
+} // namespace spl::components::feeder
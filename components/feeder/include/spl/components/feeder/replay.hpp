@@ -0,0 +1,116 @@
+#pragma once
+
+#include "spl/components/feeder/codegen.hpp"
+#include "spl/components/feeder/journal.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/result/result.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+
+namespace spl::components::feeder {
+
+    /**
+     * @brief Speed at which a journal is replayed.
+     */
+    enum class pace : std::uint8_t {
+        maximum,  ///< Frames are decoded back to back, as fast as the pipeline goes.
+        original, ///< Frames are released with the spacing they were received with.
+    };
+
+    /**
+     * @brief Feeds the frames of a journal through the decoder and transformer of a contract, without a network.
+     *
+     * Events come out of poll exactly as they would from a live session: decoded by the same codegen::decode and
+     * stamped with the receive timestamp recorded with the frame, so a replay reproduces the output of the session it
+     * was recorded from. Pings recorded in the journal are decoded but never answered.
+     */
+    template <typename TraitT>
+    class replay : public spl::components::feeder::codegen<TraitT> {
+        using base_type = spl::components::feeder::codegen<TraitT>;
+
+    public:
+        using contract_type = typename base_type::contract_type;
+        using clock_type    = std::chrono::steady_clock;
+
+        constexpr replay(spl::network::context& context, spl::components::feeder::session_id const& session_id,
+                         spl::components::feeder::pace pace = spl::components::feeder::pace::maximum) :
+            base_type(context, session_id), pace_(pace) {}
+
+        replay(replay const&)                    = delete;
+        auto operator=(replay const&) -> replay& = delete;
+        replay(replay&&)                         = delete;
+        auto operator=(replay&&) -> replay&      = delete;
+        ~replay()                                = default;
+
+        /**
+         * @brief Maps the journal and rewinds to its first frame.
+         */
+        [[nodiscard]] auto open(std::filesystem::path const& path) -> spl::result<void> {
+            err_return(playback_.open(path));
+            if constexpr (requires { contract_type::exchange; }) {
+                if (playback_.header().exchange_id != contract_type::exchange) [[unlikely]] {
+                    auto const recorded = playback_.header().exchange_id;
+                    playback_.close();
+                    return spl::failure("replay: {} was recorded from {}, expected {}", path.string(), recorded,
+                                        contract_type::exchange);
+                }
+            }
+            logger::info("{}: Replaying {} at {} pace", this->id(), path.string(), pace_);
+            cursor_   = playback_.begin();
+            replayed_ = 0;
+            return spl::success();
+        }
+
+        /**
+         * @brief Decodes the next frame, or nothing when the original pace says it has not arrived yet.
+         */
+        template <typename HandlerT>
+        [[nodiscard, gnu::hot]] auto poll(HandlerT&& handler) noexcept -> spl::result<void> {
+            if (exhausted()) [[unlikely]] {
+                return spl::success();
+            }
+
+            auto const frame = *cursor_;
+            if (pace_ == spl::components::feeder::pace::original) {
+                auto const now = clock_type::now();
+                if (replayed_ == 0) {
+                    origin_ = frame.received;
+                    start_  = now;
+                }
+                if (now - start_ < frame.received - origin_) {
+                    return spl::success();
+                }
+            }
+
+            auto const received = frame.received;
+            auto const stamped  = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+                if constexpr (requires { event.received = received; }) {
+                    event.received = received;
+                }
+                return handler(std::forward<EventT>(event));
+            };
+            ++cursor_;
+            ++replayed_;
+            return this->decode(frame.payload, stamped);
+        }
+
+        [[nodiscard]] auto exhausted() const noexcept -> bool {
+            return cursor_ == playback_.end();
+        }
+
+        [[nodiscard]] constexpr auto replayed() const noexcept -> std::size_t {
+            return replayed_;
+        }
+
+    private:
+        spl::components::feeder::pace pace_;
+        spl::components::feeder::playback playback_{};
+        spl::components::feeder::playback::iterator cursor_{};
+        std::size_t replayed_{0};
+        std::chrono::nanoseconds origin_{0};
+        clock_type::time_point start_{};
+    };
+
+} // namespace spl::components::feeder
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+
+namespace spl::components::feeder {
+
+    /**
+     * @brief Tracks the sequence of a feed that numbers its packets contiguously and classifies every arrival.
+     *
+     * The first sequence observed (or the first one after a reset) synchronizes the tracker. From there on, a
+     * sequence ahead of the expected one opens a gap and resynchronizes on the new sequence, while a sequence behind
+     * it is a late or duplicated packet the caller is expected to drop.
+     */
+    struct sequencer {
+        enum class status : std::uint8_t {
+            in_order,
+            gap,
+            stale,
+        };
+
+        struct range {
+            std::uint64_t first;
+            std::uint64_t last;
+        };
+
+        [[nodiscard, gnu::hot]] constexpr auto operator()(std::uint64_t sequence) noexcept -> status {
+            if (not synchronized_ or sequence == expected_) [[likely]] {
+                synchronized_ = true;
+                expected_     = sequence + 1;
+                return status::in_order;
+            }
+
+            if (sequence < expected_) [[unlikely]] {
+                ++stale_;
+                return status::stale;
+            }
+
+            lost_ += sequence - expected_;
+            ++gaps_;
+
+            missing_  = range{.first = expected_, .last = sequence - 1};
+            expected_ = sequence + 1;
+            return status::gap;
+        }
+
+        /**
+         * @brief Sequences skipped by the last gap reported.
+         */
+        [[nodiscard]] constexpr auto missing() const noexcept -> range {
+            return missing_;
+        }
+
+        [[nodiscard]] constexpr auto expected() const noexcept -> std::uint64_t {
+            return expected_;
+        }
+
+        [[nodiscard]] constexpr auto synchronized() const noexcept -> bool {
+            return synchronized_;
+        }
+
+        [[nodiscard]] constexpr auto gaps() const noexcept -> std::uint64_t {
+            return gaps_;
+        }
+
+        [[nodiscard]] constexpr auto lost() const noexcept -> std::uint64_t {
+            return lost_;
+        }
+
+        [[nodiscard]] constexpr auto stale() const noexcept -> std::uint64_t {
+            return stale_;
+        }
+
+        constexpr auto reset() noexcept -> void {
+            synchronized_ = false;
+            expected_     = 0;
+        }
+
+    private:
+        bool synchronized_{false};
+        std::uint64_t expected_{0};
+        range missing_{};
+        std::uint64_t gaps_{0};
+        std::uint64_t lost_{0};
+        std::uint64_t stale_{0};
+    };
+
+} // namespace spl::components::feeder
@@ -0,0 +1,79 @@
+#include "spl/components/feeder/deduplicator.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace spl::protocol;
+
+static auto make(std::uint64_t sequence, std::string trade_id, std::string instrument_id = "BTCUSDT")
+    -> feeder::trade::trade_summary {
+    return feeder::trade::trade_summary{
+        .instrument_id = std::move(instrument_id),
+        .trade_id      = std::move(trade_id),
+        .sequence      = sequence,
+    };
+}
+
+TEST(DeduplicatorTest, ForwardsFirstArrivalOnly) {
+    auto deduplicator = spl::components::feeder::deduplicator<8>{};
+    EXPECT_TRUE(deduplicator(make(1, "a")));
+    EXPECT_FALSE(deduplicator(make(1, "a")));
+    EXPECT_TRUE(deduplicator(make(2, "b")));
+    EXPECT_FALSE(deduplicator(make(1, "a")));
+    EXPECT_FALSE(deduplicator(make(2, "b")));
+    EXPECT_EQ(deduplicator.size(), 2);
+}
+
+TEST(DeduplicatorTest, DistinguishesTradesSharingSequence) {
+    auto deduplicator = spl::components::feeder::deduplicator<8>{};
+    EXPECT_TRUE(deduplicator(make(7, "first")));
+    EXPECT_TRUE(deduplicator(make(7, "second")));
+    EXPECT_FALSE(deduplicator(make(7, "second")));
+}
+
+TEST(DeduplicatorTest, DistinguishesTradesOfDifferentInstruments) {
+    auto deduplicator = spl::components::feeder::deduplicator<8>{};
+    EXPECT_TRUE(deduplicator(make(7, "1", "BTCUSDT")));
+    EXPECT_TRUE(deduplicator(make(7, "1", "ETHUSDT")));
+    EXPECT_FALSE(deduplicator(make(7, "1", "ETHUSDT")));
+    EXPECT_FALSE(deduplicator(make(7, "1", "BTCUSDT")));
+    EXPECT_EQ(deduplicator.size(), 2);
+}
+
+TEST(DeduplicatorTest, InterleavedLegsDeliverEachTradeOnce) {
+    auto deduplicator = spl::components::feeder::deduplicator<64>{};
+    auto forwarded    = std::vector<std::uint64_t>{};
+    for (auto sequence = std::uint64_t{0}; sequence < 32; ++sequence) {
+        auto const trade = make(sequence, std::to_string(sequence));
+        if (deduplicator(trade)) {
+            forwarded.push_back(trade.sequence);
+        }
+        if (sequence >= 3 and deduplicator(make(sequence - 3, std::to_string(sequence - 3)))) {
+            forwarded.push_back(sequence - 3);
+        }
+    }
+    ASSERT_EQ(forwarded.size(), 32);
+    for (auto index = std::size_t{0}; index < forwarded.size(); ++index) {
+        EXPECT_EQ(forwarded[index], index);
+    }
+}
+
+TEST(DeduplicatorTest, EvictsOldestFingerprintWhenFull) {
+    auto deduplicator = spl::components::feeder::deduplicator<4>{};
+    for (auto sequence = std::uint64_t{0}; sequence < 4; ++sequence) {
+        EXPECT_TRUE(deduplicator(make(sequence, "x")));
+    }
+    EXPECT_EQ(deduplicator.size(), 4);
+    EXPECT_TRUE(deduplicator(make(4, "x")));
+    EXPECT_EQ(deduplicator.size(), 4);
+    EXPECT_TRUE(deduplicator(make(0, "x")));
+    EXPECT_FALSE(deduplicator(make(4, "x")));
+}
+
+TEST(DeduplicatorTest, ClearForgetsHistory) {
+    auto deduplicator = spl::components::feeder::deduplicator<4>{};
+    EXPECT_TRUE(deduplicator(make(1, "a")));
+    deduplicator.clear();
+    EXPECT_EQ(deduplicator.size(), 0);
+    EXPECT_TRUE(deduplicator(make(1, "a")));
+}
@@ -0,0 +1,184 @@
+#include "spl/components/feeder/journal.hpp"
+#include "spl/components/feeder/replay.hpp"
+#include "spl/network/client/wss.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    struct line {
+        std::string_view text;
+        std::chrono::nanoseconds received{0};
+    };
+
+    struct decoder {
+        template <typename HandlerT>
+        [[nodiscard]] auto operator()(std::span<char const> view, HandlerT&& handler) const
+            -> spl::result<std::size_t> {
+            auto const text   = std::string_view{std::data(view), std::size(view)};
+            auto const length = std::min(text.find('\n'), std::size(text));
+            err_return(handler(line{.text = text.substr(0, length)}));
+            return std::min(length + 1, std::size(text));
+        }
+    };
+
+    struct transformer {
+        template <typename EventT, typename HandlerT>
+        [[nodiscard]] auto operator()(EventT&& event, HandlerT&& handler) const -> spl::result<void> {
+            return handler(std::forward<EventT>(event));
+        }
+    };
+
+    struct contract {
+        using decoder_type                = decoder;
+        using encoder_type                = decoder;
+        using transformer_type            = transformer;
+        using connection_type             = spl::network::client::ws;
+        using connector_type              = void;
+        constexpr static auto exchange    = spl::protocol::common::exchange_id::bybit;
+    };
+
+    auto temporary(std::string_view name) -> std::filesystem::path {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    auto record(std::filesystem::path const& path, std::vector<std::string> const& frames) -> void {
+        auto journal = spl::components::feeder::journal{};
+        ASSERT_TRUE(journal.open(path, spl::protocol::common::exchange_id::bybit));
+        for (std::size_t index = 0; index < std::size(frames); ++index) {
+            auto const received = std::chrono::nanoseconds{1'000 * static_cast<std::int64_t>(index + 1)};
+            ASSERT_TRUE(journal.append(received, std::span<char const>{frames[index]}));
+        }
+        ASSERT_TRUE(journal.close());
+    }
+
+} // namespace
+
+TEST(JournalTest, RoundTripsFramesAndTimestamps) {
+    auto const path   = temporary("spl-journal-roundtrip.bin");
+    auto const frames = std::vector<std::string>{"a", "frame of nine", std::string(4096, 'x'), "{}"};
+    record(path, frames);
+
+    auto playback = spl::components::feeder::playback{};
+    ASSERT_TRUE(playback.open(path));
+    EXPECT_EQ(playback.header().exchange_id, spl::protocol::common::exchange_id::bybit);
+
+    auto index = std::size_t{0};
+    for (auto const& frame : playback) {
+        ASSERT_LT(index, std::size(frames));
+        EXPECT_EQ(std::string_view(std::data(frame.payload), std::size(frame.payload)), frames[index]);
+        EXPECT_EQ(frame.received, std::chrono::nanoseconds{1'000 * static_cast<std::int64_t>(index + 1)});
+        ++index;
+    }
+    EXPECT_EQ(index, std::size(frames));
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, GrowsPastTheFirstSegment) {
+    auto const path    = temporary("spl-journal-grow.bin");
+    auto const payload = std::string(1024 * 1024, 'g');
+    auto const count   = spl::components::feeder::journal::segment / std::size(payload) + 4;
+    {
+        auto journal = spl::components::feeder::journal{};
+        ASSERT_TRUE(journal.open(path, spl::protocol::common::exchange_id::coinbase));
+        for (std::size_t index = 0; index < count; ++index) {
+            ASSERT_TRUE(journal.append(1ns, std::span<char const>{payload}));
+        }
+        EXPECT_EQ(journal.frames(), count);
+    }
+    EXPECT_GT(std::filesystem::file_size(path), spl::components::feeder::journal::segment);
+
+    auto playback = spl::components::feeder::playback{};
+    ASSERT_TRUE(playback.open(path));
+    EXPECT_EQ(std::distance(playback.begin(), playback.end()), static_cast<std::ptrdiff_t>(count));
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, StopsAtTruncatedFrame) {
+    auto const path = temporary("spl-journal-truncated.bin");
+    record(path, {"first", "second", "third"});
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+
+    auto playback = spl::components::feeder::playback{};
+    ASSERT_TRUE(playback.open(path));
+    EXPECT_EQ(std::distance(playback.begin(), playback.end()), 2);
+    std::filesystem::remove(path);
+}
+
+TEST(JournalTest, RejectsForeignFiles) {
+    auto const path = temporary("spl-journal-foreign.bin");
+    std::filesystem::remove(path);
+    auto playback = spl::components::feeder::playback{};
+    EXPECT_FALSE(playback.open(path));
+}
+
+TEST(ReplayTest, DecodesFramesWithRecordedTimestamps) {
+    auto const path = temporary("spl-journal-replay.bin");
+    record(path, {"one\ntwo", "three"});
+
+    auto context  = spl::network::context();
+    auto replay   = spl::components::feeder::replay<contract>(context, {"replay", "test"});
+    auto received = std::vector<line>{};
+    ASSERT_TRUE(replay.open(path));
+    while (not replay.exhausted()) {
+        ASSERT_TRUE(replay.poll([&](line const& event) -> spl::result<void> {
+            received.push_back(event);
+            return spl::success();
+        }));
+    }
+
+    ASSERT_EQ(std::size(received), 3);
+    EXPECT_EQ(received[0].text, "one");
+    EXPECT_EQ(received[0].received, 1'000ns);
+    EXPECT_EQ(received[1].text, "two");
+    EXPECT_EQ(received[1].received, 1'000ns);
+    EXPECT_EQ(received[2].text, "three");
+    EXPECT_EQ(received[2].received, 2'000ns);
+    EXPECT_EQ(replay.replayed(), 2);
+    std::filesystem::remove(path);
+}
+
+TEST(ReplayTest, HoldsFramesAtOriginalPace) {
+    auto const path = temporary("spl-journal-pace.bin");
+    {
+        auto journal = spl::components::feeder::journal{};
+        ASSERT_TRUE(journal.open(path, spl::protocol::common::exchange_id::bybit));
+        ASSERT_TRUE(journal.append(0ms, std::span<char const>{std::string_view{"now"}}));
+        ASSERT_TRUE(journal.append(50ms, std::span<char const>{std::string_view{"later"}}));
+    }
+
+    auto context = spl::network::context();
+    auto replay  = spl::components::feeder::replay<contract>(context, {"replay", "test"},
+                                                             spl::components::feeder::pace::original);
+    auto const ignore = [](line const&) -> spl::result<void> { return spl::success(); };
+    ASSERT_TRUE(replay.open(path));
+    auto const start = std::chrono::steady_clock::now();
+    while (not replay.exhausted()) {
+        ASSERT_TRUE(replay.poll(ignore));
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 50ms);
+    EXPECT_EQ(replay.replayed(), 2);
+    std::filesystem::remove(path);
+}
+
+TEST(ReplayTest, RejectsJournalsOfAnotherExchange) {
+    auto const path = temporary("spl-journal-exchange.bin");
+    {
+        auto journal = spl::components::feeder::journal{};
+        ASSERT_TRUE(journal.open(path, spl::protocol::common::exchange_id::coinbase));
+    }
+
+    auto context = spl::network::context();
+    auto replay  = spl::components::feeder::replay<contract>(context, {"replay", "test"});
+    EXPECT_FALSE(replay.open(path));
+    EXPECT_TRUE(replay.exhausted());
+    std::filesystem::remove(path);
+}
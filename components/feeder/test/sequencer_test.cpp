@@ -0,0 +1,46 @@
+#include "spl/components/feeder/sequencer.hpp"
+
+#include <gtest/gtest.h>
+
+using spl::components::feeder::sequencer;
+
+TEST(SequencerTest, SynchronizesOnFirstSequence) {
+    auto tracker = sequencer{};
+    EXPECT_FALSE(tracker.synchronized());
+    EXPECT_EQ(tracker(42), sequencer::status::in_order);
+    EXPECT_TRUE(tracker.synchronized());
+    EXPECT_EQ(tracker.expected(), 43);
+    EXPECT_EQ(tracker(43), sequencer::status::in_order);
+    EXPECT_EQ(tracker.gaps(), 0);
+}
+
+TEST(SequencerTest, ReportsMissingRange) {
+    auto tracker = sequencer{};
+    std::ignore  = tracker(1);
+    EXPECT_EQ(tracker(5), sequencer::status::gap);
+    EXPECT_EQ(tracker.missing().first, 2);
+    EXPECT_EQ(tracker.missing().last, 4);
+    EXPECT_EQ(tracker.expected(), 6);
+    EXPECT_EQ(tracker(6), sequencer::status::in_order);
+    EXPECT_EQ(tracker.gaps(), 1);
+    EXPECT_EQ(tracker.lost(), 3);
+}
+
+TEST(SequencerTest, DropsLateAndDuplicatedPackets) {
+    auto tracker = sequencer{};
+    std::ignore  = tracker(10);
+    std::ignore  = tracker(11);
+    EXPECT_EQ(tracker(11), sequencer::status::stale);
+    EXPECT_EQ(tracker(3), sequencer::status::stale);
+    EXPECT_EQ(tracker.expected(), 12);
+    EXPECT_EQ(tracker.stale(), 2);
+}
+
+TEST(SequencerTest, ResynchronizesAfterReset) {
+    auto tracker = sequencer{};
+    std::ignore  = tracker(100);
+    tracker.reset();
+    EXPECT_EQ(tracker(1), sequencer::status::in_order);
+    EXPECT_EQ(tracker.expected(), 2);
+    EXPECT_EQ(tracker.gaps(), 0);
+}
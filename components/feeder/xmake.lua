@@ -2,7 +2,7 @@ target("components-feeder")
     set_kind("headeronly")
     add_headerfiles("include/spl/components/feeder/*.hpp")
     add_includedirs("include", {public = true})
-    add_deps("network", "components-scheduler", "protocol-feeder", {public = true})
+    add_deps("network", "components-scheduler", "components-telemetry", "protocol-feeder", "container", {public = true})
 target_end()
 
 
@@ -0,0 +1,132 @@
+#include "generator.hpp"
+
+#include "spl/components/publisher/publisher.hpp"
+#include "spl/components/publisher/subscriber.hpp"
+#include "spl/protocol/multicast/decoder.hpp"
+#include "spl/protocol/multicast/writer.hpp"
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+// Configuration
+namespace {
+    constexpr std::size_t FIXED_TRADES = 4096;
+    constexpr std::uint32_t SEED       = 42;
+    constexpr auto GROUP               = "239.255.0.4";
+    constexpr auto PORT                = "30004";
+    constexpr auto INTERFACE           = "/127.0.0.1";
+} // namespace
+
+// Trade generator: normalized BTCUSDT trades as they leave the feeder
+static std::vector<spl::protocol::feeder::trade::trade_summary> generate_trades() {
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.seed              = SEED;
+    config.count             = FIXED_TRADES;
+    config.min_price         = 95'000.0;
+    config.max_price         = 105'000.0;
+    config.events_per_second = 40'000.0;
+    config.min_quantity      = 0.000001;
+    config.max_quantity      = 0.5;
+    config.instrument        = "BTCUSDT";
+    return spl::metrics::benchmark::trade_generator{config}.generate();
+}
+
+// Encoding only: trades appended in place to a datagram buffer, one packet per Arg(trades per packet)
+static void BM_Encode(benchmark::State& state) {
+    auto const trades = generate_trades();
+    auto const batch  = static_cast<std::size_t>(state.range(0));
+    alignas(std::uint64_t) auto buffer = std::array<std::byte, 16 * 1024>{};
+    auto writer                        = spl::protocol::multicast::writer{buffer};
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < std::size(trades); i += batch) {
+            std::ignore = writer.begin(i, 0);
+            for (std::size_t j = i; j < std::min(i + batch, std::size(trades)); ++j) {
+                auto record     = spl::protocol::multicast::trade{};
+                record.sequence = trades[j].sequence;
+                record.price    = trades[j].price.shifted();
+                record.quantity = trades[j].quantity.shifted();
+                spl::protocol::multicast::to_field(trades[j].trade_id, record.trade_id);
+                std::ignore = writer.append(record);
+            }
+            benchmark::DoNotOptimize(writer.finish());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(trades));
+    state.counters["trades_per_packet"] = static_cast<double>(batch);
+}
+
+// Decoding only: records handed to the handler straight from the aligned packet buffer
+static void BM_Decode(benchmark::State& state) {
+    auto const trades = generate_trades();
+    auto const batch  = static_cast<std::size_t>(state.range(0));
+    alignas(std::uint64_t) auto buffer = std::array<std::byte, 16 * 1024>{};
+    auto writer                        = spl::protocol::multicast::writer{buffer};
+    std::ignore                        = writer.begin(1, 0);
+    for (std::size_t j = 0; j < batch; ++j) {
+        std::ignore = writer.append(spl::protocol::multicast::trade{.sequence = trades[j].sequence});
+    }
+    auto const packet = writer.finish();
+    auto const view   = std::span<char const>{reinterpret_cast<char const*>(std::data(packet)), std::size(packet)};
+
+    auto decoder = spl::protocol::multicast::decoder{};
+    auto total   = std::uint64_t{0};
+    auto handler = [&]<typename RecordT>(RecordT const& record) -> spl::result<void> {
+        if constexpr (std::is_same_v<RecordT, spl::protocol::multicast::trade>) {
+            total += record.sequence;
+        }
+        return spl::success();
+    };
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(decoder(view, handler));
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.counters["trades_per_packet"] = static_cast<double>(batch);
+}
+
+// Loopback round trip: publisher flush, kernel multicast loopback, subscriber batch read and decode
+static void BM_Loopback(benchmark::State& state) {
+    auto const trades = generate_trades();
+    auto const batch  = static_cast<std::size_t>(state.range(0));
+
+    auto context    = spl::network::context{};
+    auto subscriber = spl::components::publisher::subscriber<>{context};
+    auto publisher  = spl::components::publisher::publisher<>{context};
+    if (not subscriber.connect(GROUP, PORT, INTERFACE) or not publisher.connect(GROUP, PORT, INTERFACE)) {
+        state.SkipWithError("unable to join the loopback multicast group");
+        return;
+    }
+
+    auto received = std::size_t{0};
+    auto handler  = [&]<typename RecordT>(RecordT const&) -> spl::result<void> {
+        received += std::is_same_v<RecordT, spl::protocol::multicast::trade> ? 1 : 0;
+        return spl::success();
+    };
+
+    auto index = std::size_t{0};
+    for (auto _ : state) {
+        for (std::size_t j = 0; j < batch; ++j, index = (index + 1) % std::size(trades)) {
+            std::ignore = publisher(trades[index]);
+        }
+        std::ignore = publisher.flush();
+        while (received < batch) {
+            std::ignore = subscriber.poll(handler);
+        }
+        received = 0;
+    }
+
+    state.SetItemsProcessed(state.iterations() * batch);
+    state.counters["trades_per_packet"] = static_cast<double>(batch);
+    state.counters["lost_packets"]      = static_cast<double>(subscriber.sequencer().lost());
+}
+
+// Benchmark registrations: Arg(trades per packet)
+BENCHMARK(BM_Encode)->Arg(1)->Arg(4)->Arg(13)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Decode)->Arg(1)->Arg(4)->Arg(13)->Unit(benchmark::kNanosecond);
+BENCHMARK(BM_Loopback)->Arg(1)->Arg(4)->Arg(13)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "spl/logger/logger.hpp"
+#include "spl/metrics/metrics.hpp"
+#include "spl/network/client/udp.hpp"
+#include "spl/network/common/context.hpp"
+#include "spl/network/connector/router.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/protocol/common/instrument_id.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/protocol/multicast/metrics.hpp"
+#include "spl/protocol/multicast/trade.hpp"
+#include "spl/protocol/multicast/writer.hpp"
+#include "spl/result/result.hpp"
+
+#include <boost/asio/ip/multicast.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace spl::components::publisher {
+
+    /**
+     * @brief Republishes normalized trades and metrics to a multicast group in the fixed-layout binary encoding.
+     *
+     * Records are appended in place to a single datagram buffer and sent when it is full or when flush() is called,
+     * so the caller decides the batching: flushing once per feeder poll sends everything decoded from one read in a
+     * single datagram. Every datagram carries the next packet sequence, which is what subscribers use to detect
+     * losses.
+     *
+     * @tparam DatagramV Maximum size of a datagram, kept below the path MTU so the kernel never fragments it.
+     */
+    template <std::size_t DatagramV = 1472>
+    class publisher {
+        constexpr static auto minimum = sizeof(spl::protocol::multicast::header) +
+                                        sizeof(spl::protocol::multicast::frame) +
+                                        sizeof(spl::protocol::multicast::trade);
+        static_assert(DatagramV >= minimum, "publisher datagram must hold at least one trade");
+
+    public:
+        using connection_type = spl::network::client::udp;
+        using router_type     = spl::network::connector::router<connection_type>;
+
+        explicit publisher(spl::network::context& context) noexcept : context_(context), router_(context) {
+            std::ignore = writer_.begin(sequence_, 0);
+        }
+
+        publisher(publisher const&)                    = delete;
+        auto operator=(publisher const&) -> publisher& = delete;
+        publisher(publisher&&)                         = delete;
+        auto operator=(publisher&&) -> publisher&      = delete;
+
+        /**
+         * @brief Connects the datagram socket to the group, a non-empty path ("/10.0.0.1") selects the outbound
+         * interface. Datagrams are looped back so consumers on the same host receive them.
+         */
+        [[nodiscard]] auto connect(std::string const& host, std::string const& port, std::string const& path = {},
+                                   int hops = 1) noexcept -> spl::result<void> {
+            auto const endpoints = router_.resolve(host, port);
+            if (spl::failed(endpoints) or std::empty(endpoints.value())) [[unlikely]] {
+                return spl::failure("publisher: unable to resolve {}:{}", host, port);
+            }
+
+            auto const& candidates = endpoints.value();
+            connection_.emplace(context_);
+            if (spl::failed(connection_->connect(std::begin(candidates), std::end(candidates)))) [[unlikely]] {
+                return spl::failure("publisher: unable to connect to {}:{}", host, port);
+            }
+
+            auto const device = std::string_view(path).substr(path.starts_with('/') ? 1 : 0);
+            if (not std::empty(device)) [[unlikely]] {
+                auto error_code    = spl::network::error_code{};
+                auto const address = boost::asio::ip::make_address_v4(device, error_code);
+                auto const option  = boost::asio::ip::multicast::outbound_interface(address);
+                if (error_code or spl::failed(connection_->set_option(option))) [[unlikely]] {
+                    return spl::failure("publisher: invalid interface \"{}\"", device);
+                }
+            }
+            std::ignore = connection_->set_option(boost::asio::ip::multicast::enable_loopback(true));
+            std::ignore = connection_->set_option(boost::asio::ip::multicast::hops(hops));
+            logger::info("Publisher connected to {}:{} (datagram={} bytes)", host, port, DatagramV);
+            return spl::success();
+        }
+
+        [[nodiscard, gnu::hot]] auto operator()(spl::protocol::feeder::trade::trade_summary const& trade) noexcept
+            -> spl::result<void> {
+            auto record        = spl::protocol::multicast::trade{};
+            record.sequence    = trade.sequence;
+            record.price       = trade.price.shifted();
+            record.quantity    = trade.quantity.shifted();
+            record.timestamp   = trade.timestamp.count();
+            record.exchange_id = trade.exchange_id;
+            record.side        = trade.side;
+            record.condition   = trade.condition;
+            spl::protocol::multicast::to_field(trade.instrument_id, record.instrument_id);
+            spl::protocol::multicast::to_field(trade.trade_id, record.trade_id);
+            return append(record);
+        }
+
+        [[nodiscard, gnu::hot]] auto operator()(spl::protocol::common::exchange_id exchange_id,
+                                                spl::protocol::common::instrument_id const& instrument_id,
+                                                spl::metrics::metrics const& metrics) noexcept -> spl::result<void> {
+            auto record        = spl::protocol::multicast::metrics{};
+            record.minimum     = metrics.minimum.shifted();
+            record.maximum     = metrics.maximum.shifted();
+            record.median      = metrics.median.shifted();
+            record.mean        = metrics.mean.shifted();
+            record.timestamp   = metrics.timestamp.count();
+            record.exchange_id = exchange_id;
+            spl::protocol::multicast::to_field(instrument_id, record.instrument_id);
+            return append(record);
+        }
+
+        /**
+         * @brief Sends the pending records, if any, as one datagram.
+         */
+        [[nodiscard, gnu::hot]] auto flush() noexcept -> spl::result<void> {
+            if (writer_.empty()) [[likely]] {
+                return spl::success();
+            }
+            if (not connection_) [[unlikely]] {
+                return spl::failure("publisher: trying to flush without a connection");
+            }
+
+            auto const packet = writer_.finish(now());
+            auto error_code   = spl::network::error_code{};
+            auto const buffer = boost::asio::buffer(std::data(packet), std::size(packet));
+            std::ignore       = connection_->write_some(buffer, error_code);
+            if (error_code) [[unlikely]] {
+                return spl::failure("publisher: unable to send packet {} ({})", sequence_, error_code.message());
+            }
+
+            ++sequence_;
+            published_ += writer_.count();
+            std::ignore = writer_.begin(sequence_, 0);
+            return spl::success();
+        }
+
+        [[nodiscard]] constexpr auto sequence() const noexcept -> std::uint64_t {
+            return sequence_;
+        }
+
+        [[nodiscard]] constexpr auto published() const noexcept -> std::uint64_t {
+            return published_;
+        }
+
+    private:
+        template <typename RecordT>
+        [[nodiscard, gnu::hot]] auto append(RecordT const& record) noexcept -> spl::result<void> {
+            if (writer_.append(record)) [[likely]] {
+                return spl::success();
+            }
+            err_return(flush());
+            std::ignore = writer_.append(record);
+            return spl::success();
+        }
+
+        [[nodiscard]] static auto now() noexcept -> std::int64_t {
+            auto const elapsed = std::chrono::system_clock::now().time_since_epoch();
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+        }
+
+        std::reference_wrapper<spl::network::context> context_;
+        router_type router_;
+        std::optional<connection_type> connection_{std::nullopt};
+        alignas(std::uint64_t) std::array<std::byte, DatagramV> buffer_{};
+        spl::protocol::multicast::writer writer_{buffer_};
+        std::uint64_t sequence_{1};
+        std::uint64_t published_{0};
+    };
+
+} // namespace spl::components::publisher
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "spl/components/feeder/sequencer.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/network/client/udp.hpp"
+#include "spl/network/common/context.hpp"
+#include "spl/network/connector/router.hpp"
+#include "spl/protocol/multicast/decoder.hpp"
+#include "spl/protocol/multicast/header.hpp"
+#include "spl/result/result.hpp"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+
+namespace spl::components::publisher {
+
+    /**
+     * @brief Consumer side of the publisher: joins the group and hands the binary records to the handler.
+     *
+     * The handler is called with the records as they sit in the receive slab (spl::protocol::multicast::trade and
+     * spl::protocol::multicast::metrics), so a strategy pays neither for JSON nor for the normalized objects. The
+     * packet header is forwarded before its records, which gives access to the publisher timestamp. Lost packets are
+     * reported as a spl::components::feeder::sequencer::range before the packet that revealed them, and late or
+     * duplicated packets are dropped.
+     *
+     * @tparam ConnectionT Multicast connection, sets the batch and slot sizes of the receive slab.
+     */
+    template <typename ConnectionT = spl::network::client::multicast>
+    class subscriber {
+    public:
+        using connection_type = ConnectionT;
+        using router_type     = spl::network::connector::router<connection_type>;
+        using slab_type       = typename connection_type::slab_type;
+
+        explicit subscriber(spl::network::context& context) noexcept : router_(context) {}
+
+        subscriber(subscriber const&)                    = delete;
+        auto operator=(subscriber const&) -> subscriber& = delete;
+        subscriber(subscriber&&)                         = delete;
+        auto operator=(subscriber&&) -> subscriber&      = delete;
+
+        /**
+         * @brief Joins the group, a non-empty path ("/10.0.0.1") selects the interface.
+         */
+        [[nodiscard]] auto connect(std::string const& host, std::string const& port,
+                                   std::string const& path = {}) noexcept -> spl::result<void> {
+            auto const operation = router_.make_connection(connection_, host, port, path);
+            if (spl::failed(operation)) [[unlikely]] {
+                return spl::failure("subscriber: unable to join {}:{} ({})", host, port,
+                                    operation.error().message().data());
+            }
+            return spl::success();
+        }
+
+        /**
+         * @brief Drains the datagrams pending in the socket with a single batch read.
+         * @return Number of packets delivered to the handler.
+         */
+        template <typename HandlerT>
+        [[nodiscard, gnu::hot]] auto poll(HandlerT&& handler) noexcept -> spl::result<std::size_t> {
+            if (not connection_) [[unlikely]] {
+                return spl::failure("subscriber: trying to poll without a connection");
+            }
+
+            auto const pending = connection_->bytes_readable();
+            if (spl::failed(pending) or pending.value() == 0) [[likely]] {
+                return std::size_t{0};
+            }
+
+            auto error_code  = spl::network::error_code{};
+            auto const bytes = connection_->read(slab_, error_code);
+            if (error_code) [[unlikely]] {
+                return spl::failure("subscriber: unable to read ({})", error_code.message());
+            }
+
+            auto delivered      = std::size_t{0};
+            auto discarding     = false;
+            auto const dispatch = [&]<typename RecordT>(RecordT const& record) -> spl::result<void> {
+                if constexpr (std::is_same_v<RecordT, spl::protocol::multicast::header>) {
+                    discarding = not accept(record, handler);
+                    delivered += discarding ? 0 : 1;
+                    if (discarding) [[unlikely]] {
+                        return spl::success();
+                    }
+                } else if (discarding) [[unlikely]] {
+                    return spl::success();
+                }
+                return handler(record);
+            };
+
+            auto view = std::span<char const>{reinterpret_cast<char const*>(std::data(slab_)), bytes};
+            while (not std::empty(view)) {
+                auto const processed = err_return(decoder_(view, dispatch));
+                view                 = view.subspan(processed);
+            }
+            return delivered;
+        }
+
+        [[nodiscard]] constexpr auto sequencer() const noexcept -> spl::components::feeder::sequencer const& {
+            return sequencer_;
+        }
+
+        [[nodiscard]] auto connection() noexcept -> connection_type& {
+            return *connection_;
+        }
+
+    private:
+        template <typename HandlerT>
+        [[nodiscard]] auto accept(spl::protocol::multicast::header const& header, HandlerT&& handler) noexcept
+            -> bool {
+            switch (sequencer_(header.sequence)) {
+                case spl::components::feeder::sequencer::status::stale:
+                    return false;
+                case spl::components::feeder::sequencer::status::gap: {
+                    auto const& missing = sequencer_.missing();
+                    logger::warn("Subscriber: packets [{}, {}] lost", missing.first, missing.last);
+                    if constexpr (requires { handler(missing); }) {
+                        std::ignore = handler(missing);
+                    }
+                    return true;
+                }
+                default:
+                    return true;
+            }
+        }
+
+        router_type router_;
+        std::optional<connection_type> connection_{std::nullopt};
+        slab_type slab_{};
+        spl::protocol::multicast::decoder decoder_{};
+        spl::components::feeder::sequencer sequencer_{};
+    };
+
+} // namespace spl::components::publisher
@@ -0,0 +1,142 @@
+#include "spl/components/publisher/publisher.hpp"
+#include "spl/components/publisher/subscriber.hpp"
+#include "spl/protocol/multicast/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace spl::protocol;
+
+namespace {
+
+    constexpr auto group     = "239.255.0.3";
+    constexpr auto port      = "30003";
+    constexpr auto interface = "/127.0.0.1";
+
+    auto make(std::uint64_t sequence) -> feeder::trade::trade_summary {
+        return feeder::trade::trade_summary{
+            .instrument_id = "BTCUSDT",
+            .exchange_id   = common::exchange_id::coinbase,
+            .trade_id      = std::to_string(sequence),
+            .side          = common::aggressor_side::buy,
+            .price         = spl::types::price::from_unshifted(100.25),
+            .quantity      = spl::types::quantity::from_unshifted(0.5),
+            .sequence      = sequence,
+            .timestamp     = std::chrono::nanoseconds{1'700'000'000'000'000'000},
+        };
+    }
+
+    struct collector {
+        std::vector<multicast::trade> trades{};
+        std::vector<multicast::metrics> metrics{};
+        std::vector<spl::components::feeder::sequencer::range> gaps{};
+        std::size_t packets{0};
+
+        template <typename RecordT>
+        auto operator()(RecordT const& record) -> spl::result<void> {
+            if constexpr (std::is_same_v<RecordT, multicast::trade>) {
+                trades.push_back(record);
+            } else if constexpr (std::is_same_v<RecordT, multicast::metrics>) {
+                metrics.push_back(record);
+            } else if constexpr (std::is_same_v<RecordT, spl::components::feeder::sequencer::range>) {
+                gaps.push_back(record);
+            } else {
+                ++packets;
+            }
+            return spl::success();
+        }
+    };
+
+    template <typename SubscriberT>
+    auto drain(SubscriberT& subscriber, collector& sink, std::size_t packets) -> void {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (sink.packets < packets and std::chrono::steady_clock::now() < deadline) {
+            ASSERT_TRUE(subscriber.poll(sink));
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+    }
+
+} // namespace
+
+TEST(PublisherTest, RepublishesTradesAndMetrics) {
+    auto context    = spl::network::context{};
+    auto subscriber = spl::components::publisher::subscriber<>{context};
+    auto publisher  = spl::components::publisher::publisher<>{context};
+    ASSERT_TRUE(subscriber.connect(group, port, interface));
+    ASSERT_TRUE(publisher.connect(group, port, interface));
+
+    ASSERT_TRUE(publisher(make(1)));
+    ASSERT_TRUE(publisher(make(2)));
+    ASSERT_TRUE(publisher(common::exchange_id::coinbase, "BTCUSDT",
+                          spl::metrics::metrics{
+                              .minimum   = spl::types::price::from_unshifted(99.0),
+                              .maximum   = spl::types::price::from_unshifted(101.0),
+                              .median    = spl::types::price::from_unshifted(100.0),
+                              .mean      = spl::types::price::from_unshifted(100.5),
+                              .timestamp = std::chrono::nanoseconds{42},
+                          }));
+    ASSERT_TRUE(publisher.flush());
+    EXPECT_EQ(publisher.sequence(), 2);
+    EXPECT_EQ(publisher.published(), 3);
+
+    auto sink = collector{};
+    drain(subscriber, sink, 1);
+    ASSERT_EQ(sink.packets, 1);
+    ASSERT_EQ(std::size(sink.trades), 2);
+    EXPECT_EQ(sink.trades[1].sequence, 2);
+    EXPECT_EQ(sink.trades[0].price, spl::types::price::from_unshifted(100.25).shifted());
+    EXPECT_EQ(multicast::to_view(sink.trades[0].instrument_id), "BTCUSDT");
+    EXPECT_EQ(multicast::to_view(sink.trades[1].trade_id), "2");
+    ASSERT_EQ(std::size(sink.metrics), 1);
+    EXPECT_EQ(sink.metrics[0].maximum, spl::types::price::from_unshifted(101.0).shifted());
+    EXPECT_EQ(sink.metrics[0].timestamp, 42);
+    EXPECT_TRUE(std::empty(sink.gaps));
+}
+
+TEST(PublisherTest, SplitsFullDatagrams) {
+    auto context    = spl::network::context{};
+    auto subscriber = spl::components::publisher::subscriber<>{context};
+    auto publisher  = spl::components::publisher::publisher<512>{context};
+    ASSERT_TRUE(subscriber.connect(group, port, interface));
+    ASSERT_TRUE(publisher.connect(group, port, interface));
+
+    for (auto sequence = std::uint64_t{0}; sequence < 10; ++sequence) {
+        ASSERT_TRUE(publisher(make(sequence)));
+    }
+    ASSERT_TRUE(publisher.flush());
+
+    auto sink = collector{};
+    drain(subscriber, sink, publisher.sequence() - 1);
+    EXPECT_EQ(sink.packets, publisher.sequence() - 1);
+    EXPECT_EQ(std::size(sink.trades), 10);
+    EXPECT_TRUE(std::empty(sink.gaps));
+}
+
+TEST(PublisherTest, SubscriberReportsLostPackets) {
+    auto context    = spl::network::context{};
+    auto subscriber = spl::components::publisher::subscriber<>{context};
+    ASSERT_TRUE(subscriber.connect(group, port, interface));
+
+    auto sender   = boost::asio::ip::udp::socket{context, boost::asio::ip::udp::v4()};
+    auto endpoint = boost::asio::ip::udp::endpoint{boost::asio::ip::make_address(group), 30003};
+    sender.set_option(boost::asio::ip::multicast::outbound_interface(boost::asio::ip::address_v4::loopback()));
+
+    auto buffer  = std::array<char, 256>{};
+    auto records = std::array<multicast::trade, 1>{};
+    for (auto const sequence : {1, 2, 6, 2, 7}) {
+        auto const bytes = multicast::encoder{}(sequence, 0, std::span(std::as_const(records)), std::span(buffer));
+        sender.send_to(boost::asio::buffer(buffer.data(), bytes.value()), endpoint);
+    }
+
+    auto sink = collector{};
+    drain(subscriber, sink, 4);
+    EXPECT_EQ(sink.packets, 4);
+    EXPECT_EQ(std::size(sink.trades), 4);
+    ASSERT_EQ(std::size(sink.gaps), 1);
+    EXPECT_EQ(sink.gaps[0].first, 3);
+    EXPECT_EQ(sink.gaps[0].last, 5);
+    EXPECT_EQ(subscriber.sequencer().stale(), 1);
+}
@@ -0,0 +1,22 @@
+target("components-publisher")
+    set_kind("headeronly")
+    add_headerfiles("include/spl/components/publisher/*.hpp")
+    add_includedirs("include", {public = true})
+    add_deps("network", "components-feeder", "protocol-feeder", "protocol-multicast", "metrics", {public = true})
+target_end()
+
+
+target("components-publisher-test")
+    set_kind("binary")
+    set_group("test")
+    add_files("test/*.cpp")
+    add_deps("components-publisher")
+    add_packages("gtest")
+target_end()
+
+target("components-publisher-benchmark")
+    set_kind("binary")
+    add_files("benchmark/publisher_benchmark.cpp")
+    add_deps("components-publisher", "metrics-generator")
+    add_packages("benchmark")
+target_end()
@@ -0,0 +1,212 @@
+#pragma once
+
+#include "spl/components/sink/schema.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string_view>
+
+namespace spl::components::sink {
+
+    /**
+     * @brief Leading bytes of a columnar file, followed by the chunks back to back.
+     */
+    struct file_header {
+        constexpr static auto signature = std::uint32_t{0x434C5053}; ///< "SPLC" in little endian.
+        constexpr static auto revision  = std::uint16_t{1};
+
+        std::uint32_t magic;                ///< Always signature.
+        std::uint16_t version;              ///< Layout revision.
+        spl::components::sink::table kind;  ///< Record kind stored in the file.
+        std::uint16_t integers;             ///< Integer columns per chunk.
+        std::uint16_t strings;              ///< String columns per chunk.
+        std::uint32_t rows;                 ///< Rows of a full chunk, the last one may hold fewer.
+    };
+
+    /**
+     * @brief Header of a chunk, followed by one column_index per column and then the column payloads.
+     */
+    struct chunk_header {
+        constexpr static auto signature = std::uint32_t{0x4B4C5053}; ///< "SPLK" in little endian.
+
+        std::uint32_t magic;    ///< Always signature.
+        std::uint32_t rows;     ///< Rows stored in the chunk.
+        std::uint32_t length;   ///< Payload bytes after the column index, padded to 8 bytes.
+        std::uint32_t reserved; ///< Always zero.
+    };
+
+    /**
+     * @brief Per-column entry of the chunk index, what a reader checks to skip a chunk without decoding it.
+     */
+    struct column_index {
+        std::int64_t minimum;  ///< Smallest value of an integer column, zero for strings.
+        std::int64_t maximum;  ///< Largest value of an integer column, zero for strings.
+        std::uint32_t offset;  ///< Offset of the column in the payload.
+        std::uint32_t length;  ///< Encoded bytes of the column.
+    };
+
+    static_assert(sizeof(file_header) == 16, "spl::components::sink::file_header must be 16 bytes");
+    static_assert(sizeof(chunk_header) == 16, "spl::components::sink::chunk_header must be 16 bytes");
+    static_assert(sizeof(column_index) == 24, "spl::components::sink::column_index must be 24 bytes");
+
+    namespace internal {
+
+        constexpr auto varint = std::size_t{10};
+
+        [[nodiscard]] constexpr auto zigzag(std::int64_t value) noexcept -> std::uint64_t {
+            return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+        }
+
+        [[nodiscard]] constexpr auto unzigzag(std::uint64_t value) noexcept -> std::int64_t {
+            return static_cast<std::int64_t>((value >> 1) ^ (~(value & 1) + 1));
+        }
+
+        [[nodiscard]] constexpr auto put(char* buffer, std::uint64_t value) noexcept -> char* {
+            while (value >= 0x80) {
+                *buffer++ = static_cast<char>(value | 0x80);
+                value >>= 7;
+            }
+            *buffer++ = static_cast<char>(value);
+            return buffer;
+        }
+
+        [[nodiscard]] constexpr auto get(char const*& cursor, char const* end, std::uint64_t& value) noexcept -> bool {
+            value = 0;
+            for (auto shift = 0; cursor != end and shift < 64; shift += 7) {
+                auto const byte = static_cast<std::uint8_t>(*cursor++);
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    } // namespace internal
+
+    /**
+     * @brief Columnar and chunked serializer for the sink writer.
+     *
+     * Rows are buffered column by column and a chunk is emitted once it holds schema::rows of them, or when the
+     * writer closes. Integer columns are delta encoded against the previous row and stored as zigzag varints, which
+     * turns timestamps and prices into one or two bytes per row. Every chunk carries the minimum and maximum of its
+     * integer columns, so a reader can skip a chunk by time or price range without decoding it.
+     *
+     * @tparam RecordT Record with a spl::components::sink::schema specialization.
+     */
+    template <typename RecordT>
+    class columnar {
+    public:
+        using record_type = RecordT;
+        using schema_type = spl::components::sink::schema<record_type>;
+
+        constexpr static auto integers = schema_type::integers;
+        constexpr static auto strings  = schema_type::strings;
+        constexpr static auto columns  = integers + strings;
+        constexpr static auto rows     = schema_type::rows;
+
+        /// Upper bound of an emitted chunk: header, index, worst-case varints, capped strings and padding.
+        constexpr static auto maximum = sizeof(chunk_header) + columns * sizeof(spl::components::sink::column_index) +
+                                        integers * rows * internal::varint +
+                                        strings * rows * (2 + schema_type::length) + 8;
+
+        [[nodiscard]] auto header(char* buffer) const noexcept -> char* {
+            auto const header = spl::components::sink::file_header{
+                .magic    = spl::components::sink::file_header::signature,
+                .version  = spl::components::sink::file_header::revision,
+                .kind     = schema_type::kind,
+                .integers = static_cast<std::uint16_t>(integers),
+                .strings  = static_cast<std::uint16_t>(strings),
+                .rows     = static_cast<std::uint32_t>(rows),
+            };
+            std::memcpy(buffer, &header, sizeof(header));
+            return buffer + sizeof(header);
+        }
+
+        /**
+         * @brief Buffers the row, writes nothing until the chunk is full.
+         */
+        [[nodiscard, gnu::hot]] auto operator()(record_type const& record, char* buffer) noexcept -> char* {
+            auto values = std::array<std::int64_t, integers>{};
+            auto texts  = std::array<std::string_view, strings>{};
+            schema_type::split(record, values, texts);
+            for (std::size_t column = 0; column < integers; ++column) {
+                values_[column][size_] = values[column];
+            }
+            for (std::size_t column = 0; column < strings; ++column) {
+                auto const length       = std::min(std::size(texts[column]), schema_type::length);
+                lengths_[column][size_] = static_cast<std::uint8_t>(length);
+                std::copy_n(std::data(texts[column]), length, std::data(texts_[column][size_]));
+            }
+            return ++size_ == rows ? finish(buffer) : buffer;
+        }
+
+        /**
+         * @brief Emits the rows buffered so far as a (possibly short) chunk.
+         */
+        [[nodiscard]] auto finish(char* buffer) noexcept -> char* {
+            if (size_ == 0) {
+                return buffer;
+            }
+
+            auto index        = std::array<spl::components::sink::column_index, columns>{};
+            auto* const start = buffer + sizeof(chunk_header) + sizeof(index);
+            auto* cursor      = start;
+            for (std::size_t column = 0; column < integers; ++column) {
+                auto const values             = std::span(values_[column]).first(size_);
+                auto const [minimum, maximum] = std::ranges::minmax(values);
+                auto* const begin             = cursor;
+                auto previous                 = std::uint64_t{0};
+                for (auto const value : values) {
+                    auto const delta = static_cast<std::int64_t>(static_cast<std::uint64_t>(value) - previous);
+                    cursor           = internal::put(cursor, internal::zigzag(delta));
+                    previous         = static_cast<std::uint64_t>(value);
+                }
+                index[column] = spl::components::sink::column_index{
+                    .minimum = minimum,
+                    .maximum = maximum,
+                    .offset  = static_cast<std::uint32_t>(begin - start),
+                    .length  = static_cast<std::uint32_t>(cursor - begin),
+                };
+            }
+            for (std::size_t column = 0; column < strings; ++column) {
+                auto* const begin = cursor;
+                for (std::size_t row = 0; row < size_; ++row) {
+                    cursor = internal::put(cursor, lengths_[column][row]);
+                    cursor = std::copy_n(std::data(texts_[column][row]), lengths_[column][row], cursor);
+                }
+                index[integers + column] = spl::components::sink::column_index{
+                    .minimum = 0,
+                    .maximum = 0,
+                    .offset  = static_cast<std::uint32_t>(begin - start),
+                    .length  = static_cast<std::uint32_t>(cursor - begin),
+                };
+            }
+            while ((cursor - start) % 8 != 0) {
+                *cursor++ = '\0';
+            }
+
+            auto const header = spl::components::sink::chunk_header{
+                .magic    = spl::components::sink::chunk_header::signature,
+                .rows     = static_cast<std::uint32_t>(size_),
+                .length   = static_cast<std::uint32_t>(cursor - start),
+                .reserved = 0,
+            };
+            std::memcpy(buffer, &header, sizeof(header));
+            std::memcpy(buffer + sizeof(header), std::data(index), sizeof(index));
+            size_ = 0;
+            return cursor;
+        }
+
+    private:
+        std::array<std::array<std::int64_t, rows>, integers> values_{};
+        std::array<std::array<std::array<char, schema_type::length>, rows>, strings> texts_{};
+        std::array<std::array<std::uint8_t, rows>, strings> lengths_{};
+        std::size_t size_{0};
+    };
+
+} // namespace spl::components::sink
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "spl/metrics/metrics.hpp"
+#include "spl/protocol/feeder/candlestick/candlestick.hpp"
+#include "spl/types/decimal.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <limits>
+
+namespace spl::components::sink {
+
+    /**
+     * @brief One CSV line per metrics record: timestamp,minimum,maximum,median,mean.
+     *
+     * Formatting goes straight into the writer buffer with spl::types::decimal::to_chars, no intermediate string is
+     * built and nothing is allocated.
+     */
+    struct csv {
+        using record_type = spl::metrics::metrics;
+
+        /// Upper bound of a single line: five fields of sign, 19 digits and point, plus separators and newline.
+        constexpr static auto maximum = std::size_t{std::numeric_limits<std::int64_t>::digits10 + 3} * 5 + 5;
+
+        [[nodiscard, gnu::hot]] auto operator()(record_type const& record, char* buffer) const noexcept -> char* {
+            buffer    = std::to_chars(buffer, buffer + maximum, record.timestamp.count()).ptr;
+            *buffer++ = ',';
+            buffer    = record.minimum.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.maximum.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.median.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.mean.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = '\n';
+            return buffer;
+        }
+    };
+
+    /**
+     * @brief One CSV line per candle: starting,ending,open,high,low,close,volume,trades,complete.
+     */
+    struct candlestick_csv {
+        using record_type = spl::protocol::feeder::candlestick::candlestick;
+
+        /// Upper bound of a single line: eight fields of sign, 20 digits and point, the flag, separators and newline.
+        constexpr static auto maximum = std::size_t{std::numeric_limits<std::uint64_t>::digits10 + 3} * 8 + 10;
+
+        [[nodiscard, gnu::hot]] auto operator()(record_type const& record, char* buffer) const noexcept -> char* {
+            buffer    = std::to_chars(buffer, buffer + maximum, record.starting.count()).ptr;
+            *buffer++ = ',';
+            buffer    = std::to_chars(buffer, buffer + maximum, record.ending.count()).ptr;
+            *buffer++ = ',';
+            buffer    = record.open.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.high.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.low.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.close.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = record.volume.to_chars<spl::types::decimal_format::trimmed>(buffer);
+            *buffer++ = ',';
+            buffer    = std::to_chars(buffer, buffer + maximum, record.trades).ptr;
+            *buffer++ = ',';
+            *buffer++ = record.complete ? '1' : '0';
+            *buffer++ = '\n';
+            return buffer;
+        }
+    };
+
+} // namespace spl::components::sink
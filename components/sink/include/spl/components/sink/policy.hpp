@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace spl::components::sink {
+
+    /**
+     * @brief Decides when the writer thread hands the formatted records to the kernel, whichever comes first.
+     *
+     * The interval also bounds what a crash can lose: records older than one interval are already in the page cache.
+     */
+    struct policy {
+        std::size_t size{256 * 1024};                                       ///< Pending bytes that trigger a flush.
+        std::chrono::milliseconds interval{std::chrono::milliseconds{100}}; ///< Maximum age of a pending record.
+    };
+
+} // namespace spl::components::sink
@@ -0,0 +1,291 @@
+#pragma once
+
+#include "spl/components/sink/columnar.hpp"
+#include "spl/components/sink/schema.hpp"
+#include "spl/result/result.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace spl::components::sink {
+
+    /**
+     * @brief Memory-mapped reader of the columnar format.
+     *
+     * The file is mapped read-only and the chunk headers and indexes are used in place, so walking the chunks and
+     * checking their ranges costs no parsing and no copy. Columns are only decoded when asked for, and string values
+     * are views into the mapping. A truncated tail (i.e. a capture killed while writing) ends the iteration at the
+     * last complete chunk.
+     *
+     * @tparam RecordT Record with a spl::components::sink::schema specialization.
+     */
+    template <typename RecordT>
+    class reader {
+    public:
+        using record_type = RecordT;
+        using schema_type = spl::components::sink::schema<record_type>;
+
+        constexpr static auto integers = schema_type::integers;
+        constexpr static auto strings  = schema_type::strings;
+        constexpr static auto columns  = integers + strings;
+
+        /**
+         * @brief View over a chunk of the mapping.
+         */
+        class chunk {
+        public:
+            constexpr chunk() noexcept = default;
+
+            constexpr explicit chunk(char const* data) noexcept : data_(data) {}
+
+            [[nodiscard]] auto rows() const noexcept -> std::size_t {
+                return header().rows;
+            }
+
+            [[nodiscard]] auto size() const noexcept -> std::size_t {
+                return sizeof(chunk_header) + sizeof(column_index) * columns + header().length;
+            }
+
+            [[nodiscard]] auto index(std::size_t column) const noexcept -> spl::components::sink::column_index const& {
+                auto const* entries = reinterpret_cast<column_index const*>(data_ + sizeof(chunk_header));
+                return entries[column];
+            }
+
+            [[nodiscard]] auto minimum(std::size_t column) const noexcept -> std::int64_t {
+                return index(column).minimum;
+            }
+
+            [[nodiscard]] auto maximum(std::size_t column) const noexcept -> std::int64_t {
+                return index(column).maximum;
+            }
+
+            /**
+             * @brief Decodes an integer column, the output must hold rows() values.
+             */
+            [[nodiscard]] auto column(std::size_t column, std::span<std::int64_t> output) const noexcept
+                -> spl::result<void> {
+                auto cursor     = payload(column);
+                auto const* end = cursor + index(column).length;
+                auto previous   = std::uint64_t{0};
+                for (auto& value : output.first(rows())) {
+                    auto encoded = std::uint64_t{0};
+                    if (not internal::get(cursor, end, encoded)) [[unlikely]] {
+                        return spl::failure("sink: column {} is truncated", column);
+                    }
+                    previous += static_cast<std::uint64_t>(internal::unzigzag(encoded));
+                    value = static_cast<std::int64_t>(previous);
+                }
+                return spl::success();
+            }
+
+            /**
+             * @brief Decodes a string column into views of the mapping, the output must hold rows() values.
+             */
+            [[nodiscard]] auto text(std::size_t column, std::span<std::string_view> output) const noexcept
+                -> spl::result<void> {
+                auto cursor     = payload(integers + column);
+                auto const* end = cursor + index(integers + column).length;
+                for (auto& value : output.first(rows())) {
+                    auto length = std::uint64_t{0};
+                    if (not internal::get(cursor, end, length) or std::cmp_less(end - cursor, length)) [[unlikely]] {
+                        return spl::failure("sink: string column {} is truncated", column);
+                    }
+                    value = std::string_view{cursor, static_cast<std::size_t>(length)};
+                    cursor += length;
+                }
+                return spl::success();
+            }
+
+            /**
+             * @brief Decodes every column and hands the rebuilt records to the handler, in file order.
+             */
+            template <typename HandlerT>
+            [[nodiscard]] auto for_each(HandlerT&& handler) const noexcept -> spl::result<void> {
+                auto values = std::array<std::array<std::int64_t, schema_type::rows>, integers>{};
+                auto texts  = std::array<std::array<std::string_view, schema_type::rows>, strings>{};
+                for (std::size_t column = 0; column < integers; ++column) {
+                    err_return(this->column(column, values[column]));
+                }
+                for (std::size_t column = 0; column < strings; ++column) {
+                    err_return(text(column, texts[column]));
+                }
+
+                auto row_values = std::array<std::int64_t, integers>{};
+                auto row_texts  = std::array<std::string_view, strings>{};
+                for (std::size_t row = 0; row < rows(); ++row) {
+                    for (std::size_t column = 0; column < integers; ++column) {
+                        row_values[column] = values[column][row];
+                    }
+                    for (std::size_t column = 0; column < strings; ++column) {
+                        row_texts[column] = texts[column][row];
+                    }
+                    handler(schema_type::join(row_values, row_texts));
+                }
+                return spl::success();
+            }
+
+            [[nodiscard]] constexpr auto data() const noexcept -> char const* {
+                return data_;
+            }
+
+        private:
+            [[nodiscard]] auto header() const noexcept -> spl::components::sink::chunk_header const& {
+                return *reinterpret_cast<spl::components::sink::chunk_header const*>(data_);
+            }
+
+            [[nodiscard]] auto payload(std::size_t column) const noexcept -> char const* {
+                return data_ + sizeof(chunk_header) + sizeof(column_index) * columns + index(column).offset;
+            }
+
+            char const* data_{nullptr};
+        };
+
+        /**
+         * @brief Forward iterator over the complete chunks of the file.
+         */
+        class iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = chunk;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = chunk const*;
+            using reference         = chunk const&;
+
+            constexpr iterator() noexcept = default;
+
+            iterator(char const* current, char const* end) noexcept : end_(end) {
+                current_ = chunk{validate(current)};
+            }
+
+            [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+                return current_;
+            }
+
+            [[nodiscard]] constexpr auto operator->() const noexcept -> pointer {
+                return &current_;
+            }
+
+            auto operator++() noexcept -> iterator& {
+                current_ = chunk{validate(current_.data() + current_.size())};
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> iterator {
+                auto const previous = *this;
+                ++(*this);
+                return previous;
+            }
+
+            [[nodiscard]] constexpr auto operator==(iterator const& other) const noexcept -> bool {
+                return current_.data() == other.current_.data();
+            }
+
+        private:
+            [[nodiscard]] auto validate(char const* position) const noexcept -> char const* {
+                constexpr auto fixed = sizeof(chunk_header) + sizeof(column_index) * columns;
+                if (position == nullptr or std::cmp_less(end_ - position, fixed)) {
+                    return nullptr;
+                }
+                auto const& header = *reinterpret_cast<spl::components::sink::chunk_header const*>(position);
+                auto const valid   = header.magic == chunk_header::signature and header.rows <= schema_type::rows and
+                                   not std::cmp_less(end_ - position, fixed + header.length);
+                return valid ? position : nullptr;
+            }
+
+            chunk current_{};
+            char const* end_{nullptr};
+        };
+
+        constexpr reader() noexcept = default;
+
+        reader(reader const&)                    = delete;
+        auto operator=(reader const&) -> reader& = delete;
+        reader(reader&&)                         = delete;
+        auto operator=(reader&&) -> reader&      = delete;
+
+        ~reader() {
+            close();
+        }
+
+        /**
+         * @brief Maps the file and checks that it holds records of this schema.
+         */
+        [[nodiscard]] auto open(std::filesystem::path const& path) -> spl::result<void> {
+            close();
+            auto const descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (descriptor == -1) [[unlikely]] {
+                return spl::failure("sink: unable to open {} ({})", path.string(), std::strerror(errno));
+            }
+
+            struct stat status {};
+            auto const stated = ::fstat(descriptor, &status) == 0;
+            auto const length = stated ? static_cast<std::size_t>(status.st_size) : std::size_t{0};
+            auto* const data  = length >= sizeof(file_header)
+                                    ? ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0)
+                                    : MAP_FAILED;
+            std::ignore = ::close(descriptor);
+            if (data == MAP_FAILED) [[unlikely]] {
+                return spl::failure("sink: unable to map {}", path.string());
+            }
+            data_       = static_cast<char const*>(data);
+            size_       = length;
+            std::ignore = ::madvise(data, size_, MADV_SEQUENTIAL);
+
+            auto const& header = *reinterpret_cast<spl::components::sink::file_header const*>(data_);
+            if (header.magic != file_header::signature or header.version != file_header::revision) [[unlikely]] {
+                close();
+                return spl::failure("sink: {} is not a columnar capture", path.string());
+            }
+            auto const matches = header.kind == schema_type::kind and header.integers == integers and
+                                 header.strings == strings;
+            if (not matches) [[unlikely]] {
+                close();
+                return spl::failure("sink: {} holds a different table", path.string());
+            }
+            return spl::success();
+        }
+
+        auto close() noexcept -> void {
+            if (data_ != nullptr) {
+                std::ignore = ::munmap(const_cast<char*>(data_), size_);
+            }
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> iterator {
+            return data_ == nullptr ? end() : iterator{data_ + sizeof(file_header), data_ + size_};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> iterator {
+            return iterator{};
+        }
+
+        /**
+         * @brief Decodes every record of the file, in order.
+         */
+        template <typename HandlerT>
+        [[nodiscard]] auto for_each(HandlerT&& handler) const noexcept -> spl::result<void> {
+            for (auto const& chunk : *this) {
+                err_return(chunk.for_each(handler));
+            }
+            return spl::success();
+        }
+
+    private:
+        char const* data_{nullptr};
+        std::size_t size_{0};
+    };
+
+} // namespace spl::components::sink
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "spl/metrics/metrics.hpp"
+#include "spl/protocol/feeder/candlestick/candlestick.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace spl::components::sink {
+
+    /**
+     * @brief Record kinds a columnar file can hold, stored in the file header.
+     */
+    enum class table : std::uint16_t {
+        metrics = 1,
+        trades  = 2,
+        candles = 3,
+    };
+
+    /**
+     * @brief Maps a record to the integer and string columns of the columnar format.
+     *
+     * Fixed-point values are stored as their mantissas and enumerations as their underlying values, so every
+     * integer column round-trips exactly. String columns are capped at a fixed length to bound the size of a chunk.
+     */
+    template <typename RecordT>
+    struct schema;
+
+    template <>
+    struct schema<spl::metrics::metrics> {
+        using record_type = spl::metrics::metrics;
+
+        constexpr static auto kind     = spl::components::sink::table::metrics;
+        constexpr static auto integers = std::size_t{5}; ///< timestamp, minimum, maximum, median, mean.
+        constexpr static auto strings  = std::size_t{0};
+        constexpr static auto length   = std::size_t{0};
+        constexpr static auto rows     = std::size_t{1024};
+
+        constexpr static auto split(record_type const& record, std::span<std::int64_t, integers> values,
+                                    std::span<std::string_view, strings>) noexcept -> void {
+            values[0] = record.timestamp.count();
+            values[1] = record.minimum.shifted();
+            values[2] = record.maximum.shifted();
+            values[3] = record.median.shifted();
+            values[4] = record.mean.shifted();
+        }
+
+        [[nodiscard]] constexpr static auto join(std::span<std::int64_t const, integers> values,
+                                                 std::span<std::string_view const, strings>) noexcept -> record_type {
+            return record_type{
+                .minimum   = spl::types::price::from_shifted(values[1]),
+                .maximum   = spl::types::price::from_shifted(values[2]),
+                .median    = spl::types::price::from_shifted(values[3]),
+                .mean      = spl::types::price::from_shifted(values[4]),
+                .timestamp = std::chrono::nanoseconds{values[0]},
+            };
+        }
+    };
+
+    template <>
+    struct schema<spl::protocol::feeder::trade::trade_summary> {
+        using record_type = spl::protocol::feeder::trade::trade_summary;
+
+        constexpr static auto kind     = spl::components::sink::table::trades;
+        /// timestamp, received, price, quantity, sequence, exchange_id, side and condition, then the strings
+        /// instrument_id and trade_id.
+        constexpr static auto integers = std::size_t{8};
+        constexpr static auto strings  = std::size_t{2};
+        constexpr static auto length   = std::size_t{64};
+        constexpr static auto rows     = std::size_t{256};
+
+        constexpr static auto split(record_type const& record, std::span<std::int64_t, integers> values,
+                                    std::span<std::string_view, strings> texts) noexcept -> void {
+            values[0] = record.timestamp.count();
+            values[1] = record.received.count();
+            values[2] = record.price.shifted();
+            values[3] = record.quantity.shifted();
+            values[4] = static_cast<std::int64_t>(record.sequence);
+            values[5] = static_cast<std::int64_t>(record.exchange_id);
+            values[6] = static_cast<std::int64_t>(record.side);
+            values[7] = static_cast<std::int64_t>(record.condition);
+            texts[0]  = record.instrument_id;
+            texts[1]  = record.trade_id;
+        }
+
+        [[nodiscard]] static auto join(std::span<std::int64_t const, integers> values,
+                                       std::span<std::string_view const, strings> texts) -> record_type {
+            return record_type{
+                .instrument_id = spl::protocol::common::instrument_id{texts[0]},
+                .exchange_id   = static_cast<spl::protocol::common::exchange_id>(values[5]),
+                .trade_id      = spl::protocol::common::trade_id{texts[1]},
+                .side          = static_cast<spl::protocol::common::aggressor_side>(values[6]),
+                .price         = spl::protocol::common::price::from_shifted(values[2]),
+                .quantity      = spl::protocol::common::quantity::from_shifted(values[3]),
+                .condition     = static_cast<spl::protocol::common::trade_condition>(values[7]),
+                .sequence      = static_cast<spl::protocol::common::sequence>(values[4]),
+                .timestamp     = spl::protocol::common::timestamp{values[0]},
+                .received      = spl::protocol::common::timestamp{values[1]},
+            };
+        }
+    };
+
+    template <>
+    struct schema<spl::protocol::feeder::candlestick::candlestick> {
+        using record_type = spl::protocol::feeder::candlestick::candlestick;
+
+        constexpr static auto kind     = spl::components::sink::table::candles;
+        /// starting, ending, timestamp, open, high, low, close, volume, trades, sequence, exchange_id and complete,
+        /// then the string instrument_id.
+        constexpr static auto integers = std::size_t{12};
+        constexpr static auto strings  = std::size_t{1};
+        constexpr static auto length   = std::size_t{64};
+        constexpr static auto rows     = std::size_t{256};
+
+        constexpr static auto split(record_type const& record, std::span<std::int64_t, integers> values,
+                                    std::span<std::string_view, strings> texts) noexcept -> void {
+            values[0]  = record.starting.count();
+            values[1]  = record.ending.count();
+            values[2]  = record.timestamp.count();
+            values[3]  = record.open.shifted();
+            values[4]  = record.high.shifted();
+            values[5]  = record.low.shifted();
+            values[6]  = record.close.shifted();
+            values[7]  = record.volume.shifted();
+            values[8]  = static_cast<std::int64_t>(record.trades);
+            values[9]  = static_cast<std::int64_t>(record.sequence);
+            values[10] = static_cast<std::int64_t>(record.exchange_id);
+            values[11] = static_cast<std::int64_t>(record.complete);
+            texts[0]   = record.instrument_id;
+        }
+
+        [[nodiscard]] static auto join(std::span<std::int64_t const, integers> values,
+                                       std::span<std::string_view const, strings> texts) -> record_type {
+            return record_type{
+                .instrument_id = spl::protocol::common::instrument_id{texts[0]},
+                .exchange_id   = static_cast<spl::protocol::common::exchange_id>(values[10]),
+                .open          = spl::protocol::common::price::from_shifted(values[3]),
+                .high          = spl::protocol::common::price::from_shifted(values[4]),
+                .low           = spl::protocol::common::price::from_shifted(values[5]),
+                .close         = spl::protocol::common::price::from_shifted(values[6]),
+                .volume        = spl::protocol::common::quantity::from_shifted(values[7]),
+                .trades        = static_cast<spl::protocol::common::counter>(values[8]),
+                .complete      = values[11] != 0,
+                .starting      = spl::protocol::common::timestamp{values[0]},
+                .ending        = spl::protocol::common::timestamp{values[1]},
+                .sequence      = static_cast<spl::protocol::common::sequence>(values[9]),
+                .timestamp     = spl::protocol::common::timestamp{values[2]},
+            };
+        }
+    };
+
+} // namespace spl::components::sink
@@ -0,0 +1,231 @@
+#pragma once
+
+#include "spl/components/sink/policy.hpp"
+#include "spl/container/spsc_queue.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/result/result.hpp"
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace spl::components::sink {
+
+    /**
+     * @brief Asynchronous file sink: the hot thread pushes records into a wait-free ring and a writer thread formats
+     * them into large chunks that reach the kernel with a single writev.
+     *
+     * The producer never formats, never allocates and never calls into the kernel; a full ring drops the record and
+     * counts it instead of blocking the feed. The writer thread flushes according to the policy, and close() drains
+     * the ring before joining it, so a clean shutdown (i.e. on SIGTERM) loses nothing that was pushed.
+     *
+     * @tparam FormatT Serializer with a record_type, a maximum output size per call and
+     * operator()(record, char*) -> char*. Optional header(char*) and finish(char*) members write the leading bytes
+     * of the file and whatever the format still buffers on close.
+     * @tparam CapacityV Number of records the ring holds while the writer thread catches up.
+     */
+    template <typename FormatT, std::size_t CapacityV = 4096>
+    class writer {
+    public:
+        using format_type = FormatT;
+        using record_type = typename format_type::record_type;
+        using queue_type  = spl::container::spsc_queue<record_type, CapacityV>;
+
+        constexpr static auto chunk_size = std::size_t{64 * 1024};
+        static_assert(format_type::maximum < chunk_size, "a single record must fit in a chunk");
+
+        explicit writer(spl::components::sink::policy policy = {}, format_type format = {}) noexcept
+            : policy_(policy), format_(format) {}
+
+        writer(writer const&)                    = delete;
+        auto operator=(writer const&) -> writer& = delete;
+        writer(writer&&)                         = delete;
+        auto operator=(writer&&) -> writer&      = delete;
+
+        ~writer() {
+            std::ignore = close();
+        }
+
+        /**
+         * @brief Creates (or truncates) the file and starts the writer thread.
+         */
+        [[nodiscard]] auto open(std::filesystem::path const& path) -> spl::result<void> {
+            if (descriptor_ != -1) [[unlikely]] {
+                return spl::failure("sink: already writing to a file");
+            }
+
+            descriptor_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+            if (descriptor_ == -1) [[unlikely]] {
+                return spl::failure("sink: unable to open {} ({})", path.string(), std::strerror(errno));
+            }
+
+            auto const chunks = std::max<std::size_t>(1, (policy_.size + chunk_size - 1) / chunk_size) + 1;
+            storage_.resize(chunks * chunk_size);
+            vectors_.resize(chunks);
+            running_.store(true, std::memory_order_release);
+            thread_ = std::jthread([this]() { run(); });
+            return spl::success();
+        }
+
+        /**
+         * @brief Hands a record to the writer thread, called from the hot thread.
+         * @return False when the ring is full and the record was dropped.
+         */
+        [[gnu::hot]] auto push(record_type const& record) noexcept -> bool {
+            if (queue_.push(record)) [[likely]] {
+                return true;
+            }
+            ++dropped_;
+            return false;
+        }
+
+        /**
+         * @brief Drains the ring, flushes the pending chunks and closes the file.
+         */
+        [[nodiscard]] auto close() noexcept -> spl::result<void> {
+            if (descriptor_ == -1) {
+                return spl::success();
+            }
+
+            running_.store(false, std::memory_order_release);
+            if (thread_.joinable()) {
+                thread_.join();
+            }
+
+            if (::fsync(descriptor_) != 0 and error_ == 0) [[unlikely]] {
+                error_ = errno;
+            }
+            std::ignore = ::close(descriptor_);
+            descriptor_ = -1;
+            if (dropped_ != 0) [[unlikely]] {
+                logger::warn("Sink dropped {} records, the writer thread could not keep up", dropped_);
+            }
+            if (error_ != 0) [[unlikely]] {
+                return spl::failure("sink: unable to write the output file ({})", std::strerror(error_));
+            }
+            return spl::success();
+        }
+
+        [[nodiscard]] constexpr auto dropped() const noexcept -> std::size_t {
+            return dropped_;
+        }
+
+        [[nodiscard]] auto written() const noexcept -> std::size_t {
+            return written_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        auto run() noexcept -> void {
+            using clock     = std::chrono::steady_clock;
+            auto const idle = std::min<clock::duration>(policy_.interval, std::chrono::milliseconds{1});
+            auto deadline   = clock::now() + policy_.interval;
+            if constexpr (requires(char* buffer) { format_.header(buffer); }) {
+                auto* const begin = reserve();
+                commit(begin, format_.header(begin));
+            }
+
+            while (true) {
+                auto const running  = running_.load(std::memory_order_acquire);
+                auto const consumed = queue_.consume_all([this](record_type const& record) { append(record); });
+                auto const now      = clock::now();
+                if (not running) {
+                    if constexpr (requires(char* buffer) { format_.finish(buffer); }) {
+                        auto* const begin = reserve();
+                        commit(begin, format_.finish(begin));
+                    }
+                    flush();
+                    return;
+                }
+                if (pending_ >= policy_.size or (pending_ != 0 and now >= deadline)) {
+                    flush();
+                    deadline = now + policy_.interval;
+                }
+                if (consumed == 0) {
+                    std::this_thread::sleep_for(idle);
+                }
+            }
+        }
+
+        [[gnu::hot]] auto append(record_type const& record) noexcept -> void {
+            auto* const begin = reserve();
+            commit(begin, format_(record, begin));
+        }
+
+        [[nodiscard, gnu::hot]] auto reserve() noexcept -> char* {
+            if (chunk_size - used_ < format_type::maximum) [[unlikely]] {
+                vectors_[current_] = ::iovec{.iov_base = chunk(current_), .iov_len = used_};
+                used_              = 0;
+                if (++current_ == std::size(vectors_)) [[unlikely]] {
+                    flush();
+                }
+            }
+            return chunk(current_) + used_;
+        }
+
+        auto commit(char const* begin, char const* end) noexcept -> void {
+            used_ += static_cast<std::size_t>(end - begin);
+            pending_ += static_cast<std::size_t>(end - begin);
+        }
+
+        auto flush() noexcept -> void {
+            if (used_ != 0) {
+                vectors_[current_] = ::iovec{.iov_base = chunk(current_), .iov_len = used_};
+                ++current_;
+            }
+
+            auto remaining = std::span(std::data(vectors_), current_);
+            while (not std::empty(remaining) and error_ == 0) {
+                auto const bytes = ::writev(descriptor_, std::data(remaining), static_cast<int>(std::size(remaining)));
+                if (bytes < 0) [[unlikely]] {
+                    error_ = errno == EINTR ? 0 : errno;
+                    continue;
+                }
+                written_.fetch_add(static_cast<std::size_t>(bytes), std::memory_order_relaxed);
+                for (auto left = static_cast<std::size_t>(bytes); left != 0;) {
+                    auto& front = remaining.front();
+                    if (left < front.iov_len) {
+                        front.iov_base = static_cast<char*>(front.iov_base) + left;
+                        front.iov_len -= left;
+                        break;
+                    }
+                    left -= front.iov_len;
+                    remaining = remaining.subspan(1);
+                }
+            }
+
+            current_ = 0;
+            used_    = 0;
+            pending_ = 0;
+        }
+
+        [[nodiscard]] auto chunk(std::size_t index) noexcept -> char* {
+            return std::data(storage_) + index * chunk_size;
+        }
+
+        spl::components::sink::policy policy_;
+        format_type format_;
+        queue_type queue_{};
+        std::size_t dropped_{0};
+        std::atomic<bool> running_{false};
+        std::atomic<std::size_t> written_{0};
+        int descriptor_{-1};
+        int error_{0};
+        std::vector<char> storage_{};
+        std::vector<::iovec> vectors_{};
+        std::size_t current_{0};
+        std::size_t used_{0};
+        std::size_t pending_{0};
+        std::jthread thread_{};
+    };
+
+} // namespace spl::components::sink
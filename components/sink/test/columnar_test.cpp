@@ -0,0 +1,199 @@
+#include "spl/components/sink/columnar.hpp"
+#include "spl/components/sink/reader.hpp"
+#include "spl/components/sink/writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <format>
+#include <vector>
+
+using trade_summary = spl::protocol::feeder::trade::trade_summary;
+using candlestick   = spl::protocol::feeder::candlestick::candlestick;
+
+namespace {
+
+    auto metrics(std::int64_t index) -> spl::metrics::metrics {
+        return spl::metrics::metrics{
+            .minimum   = spl::types::price::from_shifted(9'950'000'000'000 + index * 7),
+            .maximum   = spl::types::price::from_shifted(10'050'000'000'000 - index * 3),
+            .median    = spl::types::price::from_shifted(-1'250'000 * (index % 17)),
+            .mean      = spl::types::price::from_shifted(10'000'000'000'000),
+            .timestamp = std::chrono::nanoseconds{1'700'000'000'000'000'000 + index * 1'000'000},
+        };
+    }
+
+    auto trade(std::int64_t index) -> trade_summary {
+        return trade_summary{
+            .instrument_id = "BTCUSDT",
+            .exchange_id   = spl::protocol::common::exchange_id::bybit,
+            .trade_id      = std::format("2290000000-{}", index),
+            .side          = index % 2 == 0 ? spl::protocol::common::aggressor_side::buy
+                                            : spl::protocol::common::aggressor_side::sell,
+            .price         = spl::types::price::from_shifted(10'000'000'000'000 + (index % 11) * 1'000'000),
+            .quantity      = spl::types::quantity::from_shifted(index + 1),
+            .condition     = spl::protocol::common::trade_condition::regular,
+            .sequence      = static_cast<std::uint64_t>(80'000'000'000 + index),
+            .timestamp     = std::chrono::nanoseconds{1'700'000'000'000'000'000 + index * 250'000},
+            .received      = std::chrono::nanoseconds{1'700'000'000'000'400'000 + index * 250'000},
+        };
+    }
+
+    auto candle(std::int64_t index) -> candlestick {
+        auto const starting = std::chrono::nanoseconds{1'700'000'000'000'000'000 + (index / 3) * 1'000'000'000};
+        return candlestick{
+            .instrument_id = "BTCUSDT",
+            .exchange_id   = spl::protocol::common::exchange_id::coinbase,
+            .open          = spl::types::price::from_shifted(10'000'000'000'000),
+            .high          = spl::types::price::from_shifted(10'000'000'000'000 + (index % 13) * 1'000'000),
+            .low           = spl::types::price::from_shifted(10'000'000'000'000 - (index % 7) * 1'000'000),
+            .close         = spl::types::price::from_shifted(10'000'000'000'000 + (index % 5) * 1'000'000),
+            .volume        = spl::types::quantity::from_shifted(index * 1'000 + 1),
+            .trades        = static_cast<std::uint64_t>(index % 3 + 1),
+            .complete      = index % 3 == 2,
+            .starting      = starting,
+            .ending        = starting + std::chrono::seconds{1},
+            .sequence      = static_cast<std::uint64_t>(80'000'000'000 + index),
+            .timestamp     = starting + std::chrono::milliseconds{index % 3 * 300},
+        };
+    }
+
+    auto temporary(std::string_view name) -> std::filesystem::path {
+        return std::filesystem::temp_directory_path() / std::format("spl-columnar-{}-{}.bin", name, ::getpid());
+    }
+
+    template <typename RecordT, typename FactoryT>
+    auto capture(std::filesystem::path const& path, std::int64_t count, FactoryT factory) -> void {
+        auto writer = spl::components::sink::writer<spl::components::sink::columnar<RecordT>>{};
+        ASSERT_TRUE(writer.open(path));
+        for (auto index = std::int64_t{0}; index < count; ++index) {
+            ASSERT_TRUE(writer.push(factory(index)));
+        }
+        ASSERT_TRUE(writer.close());
+    }
+
+    auto equal(spl::metrics::metrics const& lhs, spl::metrics::metrics const& rhs) -> bool {
+        return lhs.timestamp == rhs.timestamp and lhs.minimum == rhs.minimum and lhs.maximum == rhs.maximum and
+               lhs.median == rhs.median and lhs.mean == rhs.mean;
+    }
+
+} // namespace
+
+TEST(ComponentsSinkColumnarTest, ZigzagRoundTrips) {
+    using namespace spl::components::sink::internal;
+    constexpr auto lowest  = std::numeric_limits<std::int64_t>::min();
+    constexpr auto highest = std::numeric_limits<std::int64_t>::max();
+    for (auto const value : {std::int64_t{0}, std::int64_t{-1}, std::int64_t{1}, lowest, highest}) {
+        auto buffer       = std::array<char, varint>{};
+        auto const* end   = put(std::data(buffer), zigzag(value));
+        auto const* begin = static_cast<char const*>(std::data(buffer));
+        auto decoded      = std::uint64_t{0};
+        ASSERT_TRUE(get(begin, end, decoded));
+        EXPECT_EQ(begin, end);
+        EXPECT_EQ(unzigzag(decoded), value);
+    }
+    EXPECT_EQ(zigzag(-1), 1);
+    EXPECT_EQ(zigzag(1), 2);
+}
+
+TEST(ComponentsSinkColumnarTest, RoundTripsMetrics) {
+    auto const path  = temporary("metrics");
+    auto const count = std::int64_t{2500};
+    capture<spl::metrics::metrics>(path, count, metrics);
+
+    auto reader = spl::components::sink::reader<spl::metrics::metrics>{};
+    ASSERT_TRUE(reader.open(path));
+
+    auto chunks = std::size_t{0};
+    for (auto const& chunk : reader) {
+        EXPECT_LE(chunk.rows(), spl::components::sink::schema<spl::metrics::metrics>::rows);
+        EXPECT_LE(chunk.minimum(0), chunk.maximum(0));
+        ++chunks;
+    }
+    EXPECT_EQ(chunks, 3);
+
+    auto index = std::int64_t{0};
+    ASSERT_TRUE(reader.for_each([&](spl::metrics::metrics const& record) {
+        EXPECT_TRUE(equal(record, metrics(index++)));
+    }));
+    EXPECT_EQ(index, count);
+    EXPECT_LT(std::filesystem::file_size(path), static_cast<std::uintmax_t>(count) * 5 * sizeof(std::int64_t) / 2);
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkColumnarTest, RoundTripsTrades) {
+    auto const path  = temporary("trades");
+    auto const count = std::int64_t{600};
+    capture<trade_summary>(path, count, trade);
+
+    auto reader = spl::components::sink::reader<trade_summary>{};
+    ASSERT_TRUE(reader.open(path));
+
+    auto index = std::int64_t{0};
+    ASSERT_TRUE(reader.for_each([&](trade_summary const& record) { EXPECT_EQ(record, trade(index++)); }));
+    EXPECT_EQ(index, count);
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkColumnarTest, RoundTripsCandles) {
+    auto const path  = temporary("candles");
+    auto const count = std::int64_t{700};
+    capture<candlestick>(path, count, candle);
+
+    auto reader = spl::components::sink::reader<candlestick>{};
+    ASSERT_TRUE(reader.open(path));
+
+    auto index = std::int64_t{0};
+    ASSERT_TRUE(reader.for_each([&](candlestick const& record) { EXPECT_EQ(record, candle(index++)); }));
+    EXPECT_EQ(index, count);
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkColumnarTest, IndexesEveryChunk) {
+    auto const path = temporary("index");
+    capture<spl::metrics::metrics>(path, 2048, metrics);
+
+    auto reader = spl::components::sink::reader<spl::metrics::metrics>{};
+    ASSERT_TRUE(reader.open(path));
+
+    auto first = std::int64_t{0};
+    for (auto const& chunk : reader) {
+        auto const last = first + static_cast<std::int64_t>(chunk.rows()) - 1;
+        EXPECT_EQ(chunk.minimum(0), metrics(first).timestamp.count());
+        EXPECT_EQ(chunk.maximum(0), metrics(last).timestamp.count());
+        EXPECT_EQ(chunk.minimum(2), metrics(last).maximum.shifted());
+
+        auto timestamps = std::vector<std::int64_t>(chunk.rows());
+        ASSERT_TRUE(chunk.column(0, timestamps));
+        EXPECT_EQ(timestamps.back(), metrics(last).timestamp.count());
+        first = last + 1;
+    }
+    EXPECT_EQ(first, 2048);
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkColumnarTest, StopsAtTruncatedChunk) {
+    auto const path = temporary("truncated");
+    capture<spl::metrics::metrics>(path, 1500, metrics);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 3);
+
+    auto reader = spl::components::sink::reader<spl::metrics::metrics>{};
+    ASSERT_TRUE(reader.open(path));
+
+    auto rows = std::size_t{0};
+    for (auto const& chunk : reader) {
+        rows += chunk.rows();
+    }
+    EXPECT_EQ(rows, 1024);
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkColumnarTest, RejectsOtherTables) {
+    auto const path = temporary("table");
+    capture<spl::metrics::metrics>(path, 10, metrics);
+
+    auto reader = spl::components::sink::reader<trade_summary>{};
+    EXPECT_FALSE(reader.open(path));
+    EXPECT_EQ(reader.begin(), reader.end());
+    std::filesystem::remove(path);
+}
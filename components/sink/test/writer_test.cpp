@@ -0,0 +1,140 @@
+#include "spl/components/sink/csv.hpp"
+#include "spl/components/sink/writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+    auto make(std::int64_t index) -> spl::metrics::metrics {
+        return spl::metrics::metrics{
+            .minimum   = spl::types::price::from_shifted(9'950'000'000'000 + index),
+            .maximum   = spl::types::price::from_shifted(10'050'000'000'000 - index),
+            .median    = spl::types::price::from_shifted(-1'250'000 * index),
+            .mean      = spl::types::price::from_shifted(10'000'000'000'000),
+            .timestamp = std::chrono::nanoseconds{1'700'000'000'000'000'000 + index},
+        };
+    }
+
+    auto expected(spl::metrics::metrics const& metrics) -> std::string {
+        return std::format("{},{},{},{},{}\n", metrics.timestamp.count(), metrics.minimum.to_string(),
+                           metrics.maximum.to_string(), metrics.median.to_string(), metrics.mean.to_string());
+    }
+
+    auto read(std::filesystem::path const& path) -> std::string {
+        auto stream = std::ifstream{path};
+        auto buffer = std::stringstream{};
+        buffer << stream.rdbuf();
+        return buffer.str();
+    }
+
+    auto temporary(std::string_view name) -> std::filesystem::path {
+        return std::filesystem::temp_directory_path() / std::format("spl-sink-{}-{}.csv", name, ::getpid());
+    }
+
+} // namespace
+
+TEST(ComponentsSinkCsvTest, MatchesDecimalFormatting) {
+    auto buffer = std::array<char, spl::components::sink::csv::maximum>{};
+    for (auto const index : {0, 1, 7, 123'456}) {
+        auto const metrics = make(index);
+        auto const* end    = spl::components::sink::csv{}(metrics, std::data(buffer));
+        EXPECT_EQ(std::string_view(std::data(buffer), end), expected(metrics));
+    }
+}
+
+TEST(ComponentsSinkCsvTest, FitsTheWorstCase) {
+    auto buffer        = std::array<char, spl::components::sink::csv::maximum>{};
+    auto const extreme = spl::types::price::from_shifted(std::numeric_limits<std::int64_t>::min() + 1);
+    auto const metrics = spl::metrics::metrics{
+        .minimum   = extreme,
+        .maximum   = extreme,
+        .median    = extreme,
+        .mean      = extreme,
+        .timestamp = std::chrono::nanoseconds{std::numeric_limits<std::int64_t>::min()},
+    };
+    auto const* end = spl::components::sink::csv{}(metrics, std::data(buffer));
+    EXPECT_LE(static_cast<std::size_t>(end - std::data(buffer)), spl::components::sink::csv::maximum);
+}
+
+TEST(ComponentsSinkCsvTest, FormatsCandles) {
+    auto buffer       = std::array<char, spl::components::sink::candlestick_csv::maximum>{};
+    auto const candle = spl::protocol::feeder::candlestick::candlestick{
+        .open     = spl::types::price::from_shifted(10'000'000'000'000),
+        .high     = spl::types::price::from_shifted(10'050'000'000'000),
+        .low      = spl::types::price::from_shifted(9'950'000'000'000),
+        .close    = spl::types::price::from_shifted(10'010'000'000'000),
+        .volume   = spl::types::quantity::from_shifted(1'250'000),
+        .trades   = 42,
+        .complete = true,
+        .starting = std::chrono::seconds{1'700'000'000},
+        .ending   = std::chrono::seconds{1'700'000'060},
+    };
+    auto const* end = spl::components::sink::candlestick_csv{}(candle, std::data(buffer));
+    EXPECT_EQ(std::string_view(std::data(buffer), end),
+              std::format("{},{},{},{},{},{},{},42,1\n", candle.starting.count(), candle.ending.count(),
+                          candle.open.to_string(), candle.high.to_string(), candle.low.to_string(),
+                          candle.close.to_string(), candle.volume.to_string()));
+}
+
+TEST(ComponentsSinkWriterTest, DrainsEverythingOnClose) {
+    auto const path = temporary("drain");
+    auto content    = std::string{};
+    {
+        auto writer = spl::components::sink::writer<spl::components::sink::csv>{{.size = 1024 * 1024}};
+        ASSERT_TRUE(writer.open(path));
+        for (auto index = 0; index < 4000; ++index) {
+            EXPECT_TRUE(writer.push(make(index)));
+            content += expected(make(index));
+        }
+        ASSERT_TRUE(writer.close());
+        EXPECT_EQ(writer.dropped(), 0);
+        EXPECT_EQ(writer.written(), std::size(content));
+    }
+    EXPECT_EQ(read(path), content);
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkWriterTest, FlushesOnInterval) {
+    auto const path = temporary("interval");
+    auto writer     = spl::components::sink::writer<spl::components::sink::csv>{
+        {.size = 1024 * 1024, .interval = std::chrono::milliseconds{5}}};
+    ASSERT_TRUE(writer.open(path));
+    EXPECT_TRUE(writer.push(make(42)));
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (writer.written() == 0 and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(read(path), expected(make(42)));
+    ASSERT_TRUE(writer.close());
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkWriterTest, FlushesOnSize) {
+    auto const path = temporary("size");
+    auto writer     = spl::components::sink::writer<spl::components::sink::csv>{
+        {.size = 1, .interval = std::chrono::hours{1}}};
+    ASSERT_TRUE(writer.open(path));
+    EXPECT_TRUE(writer.push(make(7)));
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (writer.written() == 0 and std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    EXPECT_EQ(writer.written(), std::size(expected(make(7))));
+    ASSERT_TRUE(writer.close());
+    std::filesystem::remove(path);
+}
+
+TEST(ComponentsSinkWriterTest, FailsOnInvalidPath) {
+    auto writer = spl::components::sink::writer<spl::components::sink::csv>{};
+    EXPECT_FALSE(writer.open("/nonexistent/directory/output.csv"));
+    EXPECT_TRUE(writer.close());
+}
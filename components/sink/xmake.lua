@@ -0,0 +1,15 @@
+target("components-sink")
+    set_kind("headeronly")
+    add_headerfiles("include/spl/components/sink/*.hpp")
+    add_includedirs("include", {public = true})
+    add_deps("container", "logger", "metrics", "protocol-feeder", "result", "types", {public = true})
+target_end()
+
+
+target("components-sink-test")
+    set_kind("binary")
+    set_group("test")
+    add_files("test/*.cpp")
+    add_deps("components-sink")
+    add_packages("gtest")
+target_end()
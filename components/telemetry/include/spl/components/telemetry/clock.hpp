@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+namespace spl::components::telemetry {
+
+    /**
+     * @brief Cycle counter used to stamp the pipeline stages: rdtsc where available, the steady clock otherwise.
+     *
+     * Reading the counter costs a few nanoseconds and no system call. It assumes an invariant TSC (constant rate,
+     * synchronised across cores), which every x86 server of the last decade provides. The counter is not serialising,
+     * so stages shorter than a few dozen cycles are not measured reliably.
+     */
+    struct clock {
+        /**
+         * @brief Current value of the counter, in ticks.
+         */
+        [[nodiscard, gnu::always_inline]] static auto now() noexcept -> std::uint64_t {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            auto const now = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+#endif
+        }
+
+        /**
+         * @brief Converts a number of ticks into nanoseconds, calibrating the counter against the steady clock on the
+         * first call.
+         */
+        [[nodiscard]] static auto nanoseconds(std::uint64_t ticks) noexcept -> std::uint64_t {
+            static auto const ratio = calibrate();
+            return static_cast<std::uint64_t>(static_cast<double>(ticks) * ratio);
+        }
+
+    private:
+        [[nodiscard]] static auto calibrate() noexcept -> double {
+#if defined(__x86_64__) || defined(__i386__)
+            auto const start = std::chrono::steady_clock::now();
+            auto const first = now();
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            auto const elapsed = std::chrono::steady_clock::now() - start;
+            auto const ticks   = now() - first;
+            return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(ticks);
+#else
+            return 1.0;
+#endif
+        }
+    };
+
+} // namespace spl::components::telemetry
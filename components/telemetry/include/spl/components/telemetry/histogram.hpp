@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace spl::components::telemetry {
+
+    /**
+     * @brief HDR-style log-linear histogram of 64-bit values, i.e. latencies in nanoseconds.
+     *
+     * Every power of two is split into 2^PrecisionV linear sub-buckets, so a recorded value is reported with a relative
+     * error below 2^-PrecisionV over the whole 64-bit range, with a fixed footprint and no allocation. Values below
+     * 2^PrecisionV are kept exactly.
+     *
+     * A histogram has a single writer: record() is a handful of relaxed loads and stores, with no read-modify-write
+     * instruction, while any other thread may read it (i.e. merge it into a snapshot) concurrently. Such a reader sees
+     * every value recorded before it started, plus possibly some of the ones recorded meanwhile.
+     *
+     * @tparam PrecisionV Number of bits of the sub-bucket index.
+     */
+    template <std::size_t PrecisionV = 5>
+    class histogram {
+        static_assert(PrecisionV > 0 and PrecisionV < 16, "unreasonable histogram precision");
+
+        using counter_type = std::atomic<std::uint64_t>;
+
+    public:
+        constexpr static auto precision   = PrecisionV;
+        constexpr static auto sub_buckets = std::size_t{1} << precision;
+        constexpr static auto buckets     = (64 - precision + 1) * sub_buckets;
+
+        constexpr histogram() noexcept = default;
+
+        histogram(histogram const&)                    = delete;
+        auto operator=(histogram const&) -> histogram& = delete;
+        histogram(histogram&&)                         = delete;
+        auto operator=(histogram&&) -> histogram&      = delete;
+        ~histogram()                                   = default;
+
+        /**
+         * @brief Index of the bucket a value falls into.
+         */
+        [[nodiscard]] constexpr static auto index(std::uint64_t value) noexcept -> std::size_t {
+            if (value < sub_buckets) {
+                return static_cast<std::size_t>(value);
+            }
+            auto const shift = static_cast<std::size_t>(std::bit_width(value)) - precision - 1;
+            return ((shift + 1) << precision) | static_cast<std::size_t>((value >> shift) & (sub_buckets - 1));
+        }
+
+        /**
+         * @brief Highest value that falls into a bucket.
+         */
+        [[nodiscard]] constexpr static auto highest(std::size_t index) noexcept -> std::uint64_t {
+            if (index < sub_buckets) {
+                return index;
+            }
+            auto const shift    = (index >> precision) - 1;
+            auto const mantissa = static_cast<std::uint64_t>((index & (sub_buckets - 1)) | sub_buckets);
+            auto const upper    = (mantissa + 1) << shift;
+            return upper == 0 ? std::numeric_limits<std::uint64_t>::max() : upper - 1;
+        }
+
+        [[gnu::hot]] auto record(std::uint64_t value) noexcept -> void {
+            increment(counts_[index(value)], 1);
+            increment(count_, 1);
+            increment(sum_, value);
+            if (value < minimum_.load(std::memory_order_relaxed)) {
+                minimum_.store(value, std::memory_order_relaxed);
+            }
+            if (value > maximum_.load(std::memory_order_relaxed)) {
+                maximum_.store(value, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Adds the values of another histogram, which may still be written by its own thread.
+         */
+        auto merge(histogram const& other) noexcept -> void {
+            for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+                if (auto const count = other.counts_[bucket].load(std::memory_order_relaxed); count != 0) {
+                    increment(counts_[bucket], count);
+                }
+            }
+            increment(count_, other.count_.load(std::memory_order_relaxed));
+            increment(sum_, other.sum_.load(std::memory_order_relaxed));
+            auto const minimum = other.minimum_.load(std::memory_order_relaxed);
+            auto const maximum = other.maximum_.load(std::memory_order_relaxed);
+            minimum_.store(std::min(minimum, minimum_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+            maximum_.store(std::max(maximum, maximum_.load(std::memory_order_relaxed)), std::memory_order_relaxed);
+        }
+
+        auto reset() noexcept -> void {
+            for (auto& count : counts_) {
+                count.store(0, std::memory_order_relaxed);
+            }
+            count_.store(0, std::memory_order_relaxed);
+            sum_.store(0, std::memory_order_relaxed);
+            minimum_.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+            maximum_.store(0, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Value below or at which the given fraction of the recorded values lies, e.g. 0.99 for the p99.
+         * @return The highest value of the bucket holding that rank, capped by the maximum; zero when empty.
+         */
+        [[nodiscard]] auto percentile(double fraction) const noexcept -> std::uint64_t {
+            auto const total = count();
+            if (total == 0) {
+                return 0;
+            }
+            auto const clamped = std::clamp(fraction, 0.0, 1.0);
+            auto const rank    = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped * total)));
+            auto seen          = std::uint64_t{0};
+            for (std::size_t bucket = 0; bucket < buckets; ++bucket) {
+                seen += counts_[bucket].load(std::memory_order_relaxed);
+                if (seen >= rank) {
+                    return std::clamp(highest(bucket), minimum(), maximum());
+                }
+            }
+            return maximum();
+        }
+
+        [[nodiscard]] auto count() const noexcept -> std::uint64_t {
+            return count_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto minimum() const noexcept -> std::uint64_t {
+            return count() == 0 ? 0 : minimum_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto maximum() const noexcept -> std::uint64_t {
+            return maximum_.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto mean() const noexcept -> double {
+            auto const total = count();
+            return total == 0 ? 0.0 : static_cast<double>(sum_.load(std::memory_order_relaxed)) / total;
+        }
+
+    private:
+        [[gnu::always_inline]] static auto increment(counter_type& counter, std::uint64_t value) noexcept -> void {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        std::array<counter_type, buckets> counts_{};
+        counter_type count_{0};
+        counter_type sum_{0};
+        counter_type minimum_{std::numeric_limits<std::uint64_t>::max()};
+        counter_type maximum_{0};
+    };
+
+} // namespace spl::components::telemetry
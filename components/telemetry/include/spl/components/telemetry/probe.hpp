@@ -0,0 +1,144 @@
+#pragma once
+
+#include "spl/components/telemetry/clock.hpp"
+#include "spl/components/telemetry/histogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <tuple>
+
+namespace spl::components::telemetry {
+
+#ifdef SPL_TELEMETRY_ENABLED
+    constexpr auto enabled = true;
+#else
+    constexpr auto enabled = false;
+#endif
+
+    /**
+     * @brief Steps a message goes through, from the socket to the output.
+     */
+    enum class stage : std::uint8_t {
+        read,       ///< Socket read of the inbound frame (codegen::read).
+        decode,     ///< Parsing of the frame, excluding the stages it calls into (codegen::decode).
+        transform,  ///< Normalisation of a decoded event, excluding the handler it feeds.
+        metrics,    ///< Update of the sliding window statistics.
+        output,     ///< Hand-off of the results to the sinks and publishers.
+        end_to_end, ///< From the receive timestamp of the frame to the end of the output.
+    };
+
+    constexpr auto stages = static_cast<std::size_t>(stage::end_to_end) + 1;
+
+    using histogram_type = spl::components::telemetry::histogram<>;
+    using snapshot_type  = std::array<histogram_type, stages>;
+
+    /**
+     * @brief Histograms of every thread that recorded something, merged on demand.
+     *
+     * Each thread writes its own histograms, registered the first time it records, so the hot path never contends on
+     * a lock or a shared cache line. Histograms outlive their thread, so nothing it recorded is lost at exit. The
+     * clock is calibrated when the registry is created, so that the first probe does not pay for it.
+     */
+    class registry {
+    public:
+        [[nodiscard]] static auto instance() noexcept -> registry& {
+            static auto instance = registry{};
+            return instance;
+        }
+
+        /**
+         * @brief Histograms of the calling thread.
+         */
+        [[nodiscard, gnu::hot]] auto local() -> snapshot_type& {
+            thread_local snapshot_type* local = nullptr;
+            if (local == nullptr) [[unlikely]] {
+                auto const lock = std::scoped_lock{mutex_};
+                local           = &threads_.emplace_back();
+            }
+            return *local;
+        }
+
+        /**
+         * @brief Merges the histograms of every thread into the given one, recorded since start or the last reset.
+         */
+        auto merge(snapshot_type& snapshot) -> void {
+            auto const lock = std::scoped_lock{mutex_};
+            for (auto const& histograms : threads_) {
+                for (std::size_t index = 0; index < stages; ++index) {
+                    snapshot[index].merge(histograms[index]);
+                }
+            }
+        }
+
+    private:
+        registry() noexcept {
+            std::ignore = clock::nanoseconds(0);
+        }
+
+        std::mutex mutex_{};
+        std::list<snapshot_type> threads_{};
+    };
+
+    /**
+     * @brief Records a latency, in nanoseconds, into the histogram of a stage of the calling thread.
+     */
+    [[gnu::hot]] inline auto record(spl::components::telemetry::stage stage, std::uint64_t nanoseconds) -> void {
+        registry::instance().local()[static_cast<std::size_t>(stage)].record(nanoseconds);
+    }
+
+    /**
+     * @brief Records the time elapsed between construction and destruction in the histogram of a stage.
+     *
+     * Probes nest: the time spent in the probes opened meanwhile on the same thread is subtracted, so every stage
+     * reports its own cost even when it calls into the next one (i.e. the decoder calling the transformer).
+     */
+    class probe {
+    public:
+        [[gnu::always_inline]] explicit probe(spl::components::telemetry::stage stage) noexcept :
+            stage_(stage), parent_(active), start_(clock::now()) {
+            active = this;
+        }
+
+        probe(probe const&)                    = delete;
+        auto operator=(probe const&) -> probe& = delete;
+        probe(probe&&)                         = delete;
+        auto operator=(probe&&) -> probe&      = delete;
+
+        [[gnu::always_inline]] ~probe() {
+            auto const elapsed = clock::now() - start_;
+            active             = parent_;
+            if (parent_ != nullptr) {
+                parent_->nested_ += elapsed;
+            }
+            record(stage_, clock::nanoseconds(elapsed - std::min(nested_, elapsed)));
+        }
+
+    private:
+        static inline thread_local probe* active = nullptr;
+
+        spl::components::telemetry::stage stage_;
+        probe* parent_;
+        std::uint64_t start_;
+        std::uint64_t nested_{0};
+    };
+
+} // namespace spl::components::telemetry
+
+#define SPL_TELEMETRY_CONCAT_IMPL(x, y) x##y
+#define SPL_TELEMETRY_CONCAT(x, y)      SPL_TELEMETRY_CONCAT_IMPL(x, y)
+
+#ifdef SPL_TELEMETRY_ENABLED
+#    define SPL_TELEMETRY_PROBE(name)                                                                                  \
+        spl::components::telemetry::probe const SPL_TELEMETRY_CONCAT(spl_telemetry_probe_, __LINE__) {                 \
+            spl::components::telemetry::stage::name                                                                    \
+        }
+#    define SPL_TELEMETRY_RECORD(name, nanoseconds)                                                                    \
+        spl::components::telemetry::record(spl::components::telemetry::stage::name, nanoseconds)
+#else
+#    define SPL_TELEMETRY_PROBE(name)
+#    define SPL_TELEMETRY_RECORD(name, nanoseconds)
+#endif
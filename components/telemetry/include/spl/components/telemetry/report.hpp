@@ -0,0 +1,141 @@
+#pragma once
+
+#include "spl/components/telemetry/probe.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/reflect/enum.hpp"
+#include "spl/result/result.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+namespace spl::components::telemetry {
+
+    /**
+     * @brief Periodic export of the stage latencies: one log line and, optionally, rows appended to a stats file.
+     *
+     * Percentiles are cumulative since the start of the process. The stats file is a CSV with one row per stage and
+     * report, in nanoseconds, so successive reports of a run can be plotted directly. Reporting takes the registry
+     * lock and walks every histogram, so it belongs on a timer, not on the hot path.
+     */
+    class reporter {
+    public:
+        reporter() noexcept {
+            std::ignore = registry::instance();
+        }
+
+        reporter(reporter const&)                    = delete;
+        auto operator=(reporter const&) -> reporter& = delete;
+        reporter(reporter&&)                         = delete;
+        auto operator=(reporter&&) -> reporter&      = delete;
+
+        ~reporter() {
+            close();
+        }
+
+        /**
+         * @brief Appends the following reports to a stats file, writing the CSV header when the file is new.
+         */
+        [[nodiscard]] auto open(std::filesystem::path const& path) -> spl::result<void> {
+            close();
+            descriptor_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+            if (descriptor_ == -1) [[unlikely]] {
+                return spl::failure("telemetry: unable to open {} ({})", path.string(), std::strerror(errno));
+            }
+
+            struct stat status{};
+            if (::fstat(descriptor_, &status) == 0 and status.st_size == 0) {
+                return write("timestamp,stage,count,minimum,mean,p50,p90,p99,p999,maximum\n");
+            }
+            return spl::success();
+        }
+
+        auto close() noexcept -> void {
+            if (descriptor_ != -1) {
+                ::close(descriptor_);
+                descriptor_ = -1;
+            }
+        }
+
+        /**
+         * @brief Merges the histograms of every thread, logs the percentiles and appends them to the stats file.
+         */
+        [[nodiscard]] auto report() -> spl::result<void> {
+            for (auto& histogram : snapshot_) {
+                histogram.reset();
+            }
+            registry::instance().merge(snapshot_);
+
+            auto const now       = std::chrono::system_clock::now().time_since_epoch();
+            auto const timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+
+            line_.clear();
+            rows_.clear();
+            for (std::size_t index = 0; index < stages; ++index) {
+                auto const& histogram = snapshot_[index];
+                if (histogram.count() == 0) {
+                    continue;
+                }
+                auto const name = spl::reflect::enum_to_string(static_cast<spl::components::telemetry::stage>(index));
+                auto const p50  = histogram.percentile(0.50);
+                auto const p90  = histogram.percentile(0.90);
+                auto const p99  = histogram.percentile(0.99);
+                auto const p999 = histogram.percentile(0.999);
+                std::format_to(std::back_inserter(line_), "{}{} p50={} p99={} p99.9={} max={} (n={})",
+                               std::empty(line_) ? "" : " | ", name, p50, p99, p999, histogram.maximum(),
+                               histogram.count());
+                std::format_to(std::back_inserter(rows_), "{},{},{},{},{:.1f},{},{},{},{},{}\n", timestamp, name,
+                               histogram.count(), histogram.minimum(), histogram.mean(), p50, p90, p99, p999,
+                               histogram.maximum());
+            }
+
+            if (std::empty(line_)) {
+                return spl::success();
+            }
+            logger::info("Latency (ns): {}", line_);
+            if (descriptor_ == -1) {
+                return spl::success();
+            }
+            return write(rows_);
+        }
+
+        /**
+         * @brief Merged histogram of a stage as of the last report.
+         */
+        [[nodiscard]] auto histogram(spl::components::telemetry::stage stage) const noexcept
+            -> histogram_type const& {
+            return snapshot_[static_cast<std::size_t>(stage)];
+        }
+
+    private:
+        [[nodiscard]] auto write(std::string_view text) const -> spl::result<void> {
+            while (not std::empty(text)) {
+                auto const written = ::write(descriptor_, std::data(text), std::size(text));
+                if (written == -1 and errno == EINTR) {
+                    continue;
+                }
+                if (written == -1) [[unlikely]] {
+                    return spl::failure("telemetry: unable to write the stats file ({})", std::strerror(errno));
+                }
+                text.remove_prefix(static_cast<std::size_t>(written));
+            }
+            return spl::success();
+        }
+
+        int descriptor_{-1};
+        snapshot_type snapshot_{};
+        std::string line_{};
+        std::string rows_{};
+    };
+
+} // namespace spl::components::telemetry
@@ -0,0 +1,155 @@
+#ifndef SPL_TELEMETRY_ENABLED
+#    define SPL_TELEMETRY_ENABLED
+#endif
+
+#include "spl/components/telemetry/histogram.hpp"
+#include "spl/components/telemetry/probe.hpp"
+#include "spl/components/telemetry/report.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+    auto busy(std::chrono::nanoseconds duration) -> void {
+        auto const until = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < until) {
+        }
+    }
+
+    auto merged() -> std::unique_ptr<spl::components::telemetry::snapshot_type> {
+        auto snapshot = std::make_unique<spl::components::telemetry::snapshot_type>();
+        spl::components::telemetry::registry::instance().merge(*snapshot);
+        return snapshot;
+    }
+
+    auto of(spl::components::telemetry::snapshot_type const& snapshot, spl::components::telemetry::stage stage)
+        -> spl::components::telemetry::histogram_type const& {
+        return snapshot[static_cast<std::size_t>(stage)];
+    }
+
+} // namespace
+
+TEST(HistogramTest, BucketsAreContiguousAndBounded) {
+    using histogram_type = spl::components::telemetry::histogram<>;
+    EXPECT_EQ(histogram_type::index(0), 0);
+    EXPECT_EQ(histogram_type::index(31), 31);
+    EXPECT_EQ(histogram_type::index(32), 32);
+    EXPECT_EQ(histogram_type::index(std::numeric_limits<std::uint64_t>::max()), histogram_type::buckets - 1);
+    EXPECT_EQ(histogram_type::highest(histogram_type::buckets - 1), std::numeric_limits<std::uint64_t>::max());
+
+    for (auto value = std::uint64_t{1}; value < (std::uint64_t{1} << 40); value = value * 3 + 1) {
+        auto const bucket = histogram_type::index(value);
+        EXPECT_GE(histogram_type::highest(bucket), value);
+        EXPECT_LT(histogram_type::highest(bucket - 1), value);
+        EXPECT_LE(histogram_type::highest(bucket) - value, value / histogram_type::sub_buckets);
+    }
+}
+
+TEST(HistogramTest, PercentilesWithinPrecision) {
+    auto histogram = std::make_unique<spl::components::telemetry::histogram<>>();
+    for (auto value = std::uint64_t{1}; value <= 100'000; ++value) {
+        histogram->record(value);
+    }
+
+    EXPECT_EQ(histogram->count(), 100'000);
+    EXPECT_EQ(histogram->minimum(), 1);
+    EXPECT_EQ(histogram->maximum(), 100'000);
+    EXPECT_DOUBLE_EQ(histogram->mean(), 50'000.5);
+    EXPECT_NEAR(histogram->percentile(0.50), 50'000, 50'000 / 32);
+    EXPECT_NEAR(histogram->percentile(0.99), 99'000, 99'000 / 32);
+    EXPECT_EQ(histogram->percentile(1.0), 100'000);
+    EXPECT_EQ(histogram->percentile(0.0), 1);
+}
+
+TEST(HistogramTest, MergeAddsCountsAndExtremes) {
+    auto first  = std::make_unique<spl::components::telemetry::histogram<>>();
+    auto second = std::make_unique<spl::components::telemetry::histogram<>>();
+    first->record(10);
+    first->record(20);
+    second->record(5);
+    second->record(1'000);
+
+    first->merge(*second);
+    EXPECT_EQ(first->count(), 4);
+    EXPECT_EQ(first->minimum(), 5);
+    EXPECT_EQ(first->maximum(), 1'000);
+    EXPECT_EQ(first->percentile(0.5), 10);
+
+    first->reset();
+    EXPECT_EQ(first->count(), 0);
+    EXPECT_EQ(first->percentile(0.5), 0);
+}
+
+TEST(ProbeTest, NestedProbesReportTheirOwnTime) {
+    auto const before = merged();
+    {
+        SPL_TELEMETRY_PROBE(decode);
+        busy(2ms);
+        {
+            SPL_TELEMETRY_PROBE(transform);
+            busy(5ms);
+        }
+    }
+    auto const after = merged();
+
+    auto const& decode    = of(*after, spl::components::telemetry::stage::decode);
+    auto const& transform = of(*after, spl::components::telemetry::stage::transform);
+    EXPECT_EQ(decode.count(), of(*before, spl::components::telemetry::stage::decode).count() + 1);
+    EXPECT_EQ(transform.count(), of(*before, spl::components::telemetry::stage::transform).count() + 1);
+    EXPECT_GE(transform.maximum(), 4'500'000);
+    EXPECT_GE(decode.maximum(), 1'500'000);
+    EXPECT_LT(decode.maximum(), 4'500'000);
+}
+
+TEST(ProbeTest, MergesHistogramsOfEveryThread) {
+    auto const before = of(*merged(), spl::components::telemetry::stage::end_to_end).count();
+    auto threads      = std::vector<std::jthread>{};
+    for (auto thread = 0; thread < 4; ++thread) {
+        threads.emplace_back([]() {
+            for (auto value = std::uint64_t{1}; value <= 1'000; ++value) {
+                SPL_TELEMETRY_RECORD(end_to_end, value);
+            }
+        });
+    }
+    threads.clear();
+
+    auto const after = merged();
+    EXPECT_EQ(of(*after, spl::components::telemetry::stage::end_to_end).count(), before + 4'000);
+}
+
+TEST(ReporterTest, AppendsRowsToTheStatsFile) {
+    auto const path = std::filesystem::temp_directory_path() / "spl-telemetry-stats.csv";
+    std::filesystem::remove(path);
+    SPL_TELEMETRY_RECORD(read, 250);
+
+    auto reporter = std::make_unique<spl::components::telemetry::reporter>();
+    ASSERT_TRUE(reporter->open(path));
+    ASSERT_TRUE(reporter->report());
+    ASSERT_TRUE(reporter->report());
+    reporter->close();
+    EXPECT_GE(reporter->histogram(spl::components::telemetry::stage::read).count(), 1);
+
+    auto stream = std::ifstream{path};
+    auto lines  = std::vector<std::string>{};
+    for (auto line = std::string{}; std::getline(stream, line);) {
+        lines.push_back(line);
+    }
+    ASSERT_FALSE(std::empty(lines));
+    EXPECT_EQ(lines.front(), "timestamp,stage,count,minimum,mean,p50,p90,p99,p999,maximum");
+    EXPECT_EQ(std::count_if(std::begin(lines), std::end(lines),
+                            [](auto const& line) { return line.find(",read,") != std::string::npos; }),
+              2);
+    std::filesystem::remove(path);
+}
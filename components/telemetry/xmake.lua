@@ -0,0 +1,18 @@
+target("components-telemetry")
+    set_kind("headeronly")
+    add_headerfiles("include/spl/components/telemetry/*.hpp")
+    add_includedirs("include", {public = true})
+    add_deps("logger", "reflect", "result", {public = true})
+    if has_config("telemetry") then
+        add_defines("SPL_TELEMETRY_ENABLED", {public = true})
+    end
+target_end()
+
+
+target("components-telemetry-test")
+    set_kind("binary")
+    set_group("test")
+    add_files("test/*.cpp")
+    add_deps("components-telemetry")
+    add_packages("gtest")
+target_end()
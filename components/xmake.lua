@@ -1,2 +1,6 @@
 includes("scheduler")
+includes("telemetry")
 includes("feeder")
+
+includes("publisher")
+includes("sink")
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <concepts>
+
+namespace spl::concepts {
+
+    /**
+     * @brief An associative `combine` over `value_type` with an `identity` element, i.e. what a sliding window can
+     * aggregate without ever needing to invert a value.
+     */
+    template <typename MonoidT>
+    concept monoid = requires(typename MonoidT::value_type const& lhs, typename MonoidT::value_type const& rhs) {
+        { MonoidT::identity() } -> std::same_as<typename MonoidT::value_type>;
+        { MonoidT::combine(lhs, rhs) } -> std::same_as<typename MonoidT::value_type>;
+    };
+
+    /**
+     * @brief A monoid that also `lift`s an ObjectT into its value_type, e.g. a trade into its quantity.
+     */
+    template <typename MonoidT, typename ObjectT>
+    concept monoid_of = monoid<MonoidT> and requires(ObjectT const& object) {
+        { MonoidT::lift(object) } -> std::same_as<typename MonoidT::value_type>;
+    };
+
+} // namespace spl::concepts
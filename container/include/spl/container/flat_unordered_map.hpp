@@ -0,0 +1,16 @@
+#pragma once
+
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <functional>
+#include <utility>
+
+namespace spl::container {
+
+    template <typename Key,                                                //
+              typename T,                                                  //
+              typename Hash      = std::hash<Key>,                         //
+              typename KeyEqual  = std::equal_to<Key>,                     //
+              typename Allocator = std::allocator<std::pair<Key const, T>>>
+    using flat_unordered_map = boost::unordered_flat_map<Key, T, Hash, KeyEqual, Allocator>;
+
+} // namespace spl::container
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace spl::container {
+
+    /**
+     * @brief Double-ended queue on a circular buffer that doubles when full and never shrinks.
+     *
+     * Once it has grown to the largest size it holds, pushing and popping at both ends never allocates, unlike
+     * std::deque which allocates and frees a block every few hundred elements of a sliding window. Only the front can
+     * be erased, which is all a time window needs. Drop-in for the ContainerT parameter of the metrics.
+     */
+    template <typename T, typename AllocatorT = std::allocator<T>>
+    class ring {
+        using traits_type = std::allocator_traits<AllocatorT>;
+
+        template <typename ValueT, typename RingT>
+        class basic_iterator {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using iterator_concept  = std::random_access_iterator_tag;
+            using value_type        = std::remove_const_t<ValueT>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = ValueT*;
+            using reference         = ValueT&;
+
+            constexpr basic_iterator() noexcept = default;
+            constexpr basic_iterator(RingT* ring, std::size_t index) noexcept : ring_(ring), index_(index) {}
+
+            template <typename OtherT, typename OtherRingT>
+            requires std::is_convertible_v<OtherT*, ValueT*>
+            constexpr basic_iterator(basic_iterator<OtherT, OtherRingT> const& other) noexcept :
+                ring_(other.ring_), index_(other.index_) {}
+
+            [[nodiscard]] constexpr auto operator*() const noexcept -> reference {
+                return (*ring_)[index_];
+            }
+
+            [[nodiscard]] constexpr auto operator->() const noexcept -> pointer {
+                return std::addressof((*ring_)[index_]);
+            }
+
+            [[nodiscard]] constexpr auto operator[](difference_type offset) const noexcept -> reference {
+                return (*ring_)[index_ + offset];
+            }
+
+            constexpr auto operator++() noexcept -> basic_iterator& {
+                ++index_;
+                return *this;
+            }
+
+            constexpr auto operator++(int) noexcept -> basic_iterator {
+                auto copy = *this;
+                ++index_;
+                return copy;
+            }
+
+            constexpr auto operator--() noexcept -> basic_iterator& {
+                --index_;
+                return *this;
+            }
+
+            constexpr auto operator--(int) noexcept -> basic_iterator {
+                auto copy = *this;
+                --index_;
+                return copy;
+            }
+
+            constexpr auto operator+=(difference_type offset) noexcept -> basic_iterator& {
+                index_ += offset;
+                return *this;
+            }
+
+            constexpr auto operator-=(difference_type offset) noexcept -> basic_iterator& {
+                index_ -= offset;
+                return *this;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(basic_iterator iter, difference_type offset) noexcept
+                -> basic_iterator {
+                return iter += offset;
+            }
+
+            [[nodiscard]] friend constexpr auto operator+(difference_type offset, basic_iterator iter) noexcept
+                -> basic_iterator {
+                return iter += offset;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(basic_iterator iter, difference_type offset) noexcept
+                -> basic_iterator {
+                return iter -= offset;
+            }
+
+            [[nodiscard]] friend constexpr auto operator-(basic_iterator const& lhs, basic_iterator const& rhs) noexcept
+                -> difference_type {
+                return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+            }
+
+            [[nodiscard]] friend constexpr auto operator==(basic_iterator const& lhs,
+                                                           basic_iterator const& rhs) noexcept -> bool {
+                return lhs.index_ == rhs.index_;
+            }
+
+            [[nodiscard]] friend constexpr auto operator<=>(basic_iterator const& lhs,
+                                                            basic_iterator const& rhs) noexcept
+                -> std::strong_ordering {
+                return lhs.index_ <=> rhs.index_;
+            }
+
+        private:
+            template <typename, typename>
+            friend class basic_iterator;
+
+            RingT* ring_{nullptr};
+            std::size_t index_{0};
+        };
+
+    public:
+        using value_type      = T;
+        using allocator_type  = AllocatorT;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference       = T&;
+        using const_reference = T const&;
+        using iterator        = basic_iterator<T, ring>;
+        using const_iterator  = basic_iterator<T const, ring const>;
+
+        constexpr ring() noexcept = default;
+
+        constexpr explicit ring(allocator_type const& allocator) noexcept : allocator_(allocator) {}
+
+        constexpr ring(ring const& other) :
+            allocator_(traits_type::select_on_container_copy_construction(other.allocator_)) {
+            reserve(std::size(other));
+            std::ranges::for_each(other, [this](auto const& value) { push_back(value); });
+        }
+
+        constexpr ring(ring&& other) noexcept :
+            allocator_(std::move(other.allocator_)),
+            data_(std::exchange(other.data_, nullptr)),
+            capacity_(std::exchange(other.capacity_, 0)),
+            head_(std::exchange(other.head_, 0)),
+            size_(std::exchange(other.size_, 0)) {}
+
+        constexpr auto operator=(ring other) noexcept -> ring& {
+            swap(other);
+            return *this;
+        }
+
+        constexpr ~ring() {
+            clear();
+            if (data_ != nullptr) {
+                traits_type::deallocate(allocator_, data_, capacity_);
+            }
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr auto capacity() const noexcept -> size_type {
+            return capacity_;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index) noexcept -> reference {
+            return data_[(head_ + index) & (capacity_ - 1)];
+        }
+
+        [[nodiscard]] constexpr auto operator[](size_type index) const noexcept -> const_reference {
+            return data_[(head_ + index) & (capacity_ - 1)];
+        }
+
+        [[nodiscard]] constexpr auto front() noexcept -> reference {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] constexpr auto front() const noexcept -> const_reference {
+            return (*this)[0];
+        }
+
+        [[nodiscard]] constexpr auto back() noexcept -> reference {
+            return (*this)[size_ - 1];
+        }
+
+        [[nodiscard]] constexpr auto back() const noexcept -> const_reference {
+            return (*this)[size_ - 1];
+        }
+
+        [[nodiscard]] constexpr auto begin() noexcept -> iterator {
+            return {this, 0};
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+            return {this, 0};
+        }
+
+        [[nodiscard]] constexpr auto cbegin() const noexcept -> const_iterator {
+            return {this, 0};
+        }
+
+        [[nodiscard]] constexpr auto end() noexcept -> iterator {
+            return {this, size_};
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+            return {this, size_};
+        }
+
+        [[nodiscard]] constexpr auto cend() const noexcept -> const_iterator {
+            return {this, size_};
+        }
+
+        template <typename... ArgsT>
+        constexpr auto emplace_back(ArgsT&&... args) -> reference {
+            if (size_ == capacity_) [[unlikely]] {
+                reserve(std::max<size_type>(capacity_ * 2, 16));
+            }
+            auto* slot = std::addressof(data_[(head_ + size_) & (capacity_ - 1)]);
+            traits_type::construct(allocator_, slot, std::forward<ArgsT>(args)...);
+            ++size_;
+            return *slot;
+        }
+
+        template <typename... ArgsT>
+        constexpr auto emplace_front(ArgsT&&... args) -> reference {
+            if (size_ == capacity_) [[unlikely]] {
+                reserve(std::max<size_type>(capacity_ * 2, 16));
+            }
+            head_      = (head_ + capacity_ - 1) & (capacity_ - 1);
+            auto* slot = std::addressof(data_[head_]);
+            traits_type::construct(allocator_, slot, std::forward<ArgsT>(args)...);
+            ++size_;
+            return *slot;
+        }
+
+        constexpr auto push_back(value_type const& value) -> void {
+            emplace_back(value);
+        }
+
+        constexpr auto push_back(value_type&& value) -> void {
+            emplace_back(std::move(value));
+        }
+
+        constexpr auto push_front(value_type const& value) -> void {
+            emplace_front(value);
+        }
+
+        constexpr auto push_front(value_type&& value) -> void {
+            emplace_front(std::move(value));
+        }
+
+        constexpr auto pop_front() noexcept -> void {
+            traits_type::destroy(allocator_, std::addressof(front()));
+            head_ = (head_ + 1) & (capacity_ - 1);
+            --size_;
+        }
+
+        constexpr auto pop_back() noexcept -> void {
+            traits_type::destroy(allocator_, std::addressof(back()));
+            --size_;
+        }
+
+        /**
+         * @brief Erases [first, last), which must start at the front.
+         */
+        constexpr auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+            for (auto count = last - first; count > 0; --count) {
+                pop_front();
+            }
+            return begin();
+        }
+
+        constexpr auto clear() noexcept -> void {
+            while (not empty()) {
+                pop_back();
+            }
+            head_ = 0;
+        }
+
+        /**
+         * @brief Grows the buffer to hold at least `capacity` elements, rounded up to a power of two.
+         */
+        constexpr auto reserve(size_type capacity) -> void {
+            if (capacity <= capacity_) {
+                return;
+            }
+
+            auto const grown = std::bit_ceil(capacity);
+            auto* data       = traits_type::allocate(allocator_, grown);
+            for (size_type index = 0; index < size_; ++index) {
+                auto& value = (*this)[index];
+                traits_type::construct(allocator_, std::addressof(data[index]), std::move(value));
+                traits_type::destroy(allocator_, std::addressof(value));
+            }
+            if (data_ != nullptr) {
+                traits_type::deallocate(allocator_, data_, capacity_);
+            }
+            data_     = data;
+            capacity_ = grown;
+            head_     = 0;
+        }
+
+        constexpr auto swap(ring& other) noexcept -> void {
+            using std::swap;
+            swap(allocator_, other.allocator_);
+            swap(data_, other.data_);
+            swap(capacity_, other.capacity_);
+            swap(head_, other.head_);
+            swap(size_, other.size_);
+        }
+
+    private:
+        [[no_unique_address]] allocator_type allocator_{};
+        T* data_{nullptr};
+        size_type capacity_{0};
+        size_type head_{0};
+        size_type size_{0};
+    };
+
+} // namespace spl::container
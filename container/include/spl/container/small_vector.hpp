@@ -0,0 +1,13 @@
+#pragma once
+
+#include <boost/container/small_vector.hpp>
+
+namespace spl::container {
+
+    /**
+     * @brief Vector keeping its first N elements inline, only allocating when it grows beyond them.
+     */
+    template <class T, std::size_t N>
+    using small_vector = boost::container::small_vector<T, N>;
+
+} // namespace spl::container
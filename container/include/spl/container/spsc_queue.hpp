@@ -0,0 +1,14 @@
+#pragma once
+
+#include <boost/lockfree/spsc_queue.hpp>
+
+namespace spl::container {
+
+    /**
+     * @brief Wait-free single-producer/single-consumer ring with the capacity fixed at compile time, so the storage
+     * is inline and neither side ever allocates.
+     */
+    template <typename T, std::size_t CapacityV>
+    using spsc_queue = boost::lockfree::spsc_queue<T, boost::lockfree::capacity<CapacityV>>;
+
+} // namespace spl::container
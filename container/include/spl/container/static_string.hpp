@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace spl::container {
+
+    /**
+     * @brief Read-only string stored inline up to a capacity fixed at compile time, so that building and copying it
+     * never allocates. Longer values are truncated to the capacity, as the fixed-size fields of the wire formats do.
+     */
+    template <std::size_t CapacityV>
+    class static_string {
+    public:
+        using value_type     = char;
+        using size_type      = std::size_t;
+        using const_iterator = char const*;
+        using iterator       = const_iterator;
+
+        constexpr static_string() noexcept = default;
+
+        template <typename StringT>
+        requires(not std::is_same_v<std::decay_t<StringT>, static_string> and
+                 std::convertible_to<StringT const&, std::string_view>)
+        constexpr static_string(StringT const& value) noexcept {
+            auto const view = std::string_view{value};
+            size_           = std::min(std::size(view), CapacityV);
+            std::copy_n(std::data(view), size_, std::begin(data_));
+        }
+
+        constexpr static_string(char const* data, size_type size) noexcept :
+            static_string(std::string_view{data, size}) {}
+
+        [[nodiscard]] constexpr static auto capacity() noexcept -> size_type {
+            return CapacityV;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] constexpr auto data() const noexcept -> char const* {
+            return std::data(data_);
+        }
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+            return data();
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+            return data() + size_;
+        }
+
+        [[nodiscard]] constexpr auto view() const noexcept -> std::string_view {
+            return {data(), size_};
+        }
+
+        [[nodiscard]] constexpr operator std::string_view() const noexcept {
+            return view();
+        }
+
+        [[nodiscard]] friend constexpr auto operator==(static_string const& lhs, static_string const& rhs) noexcept
+            -> bool {
+            return lhs.view() == rhs.view();
+        }
+
+        [[nodiscard]] friend constexpr auto operator<=>(static_string const& lhs, static_string const& rhs) noexcept
+            -> std::strong_ordering {
+            return lhs.view() <=> rhs.view();
+        }
+
+    private:
+        std::array<char, CapacityV> data_{};
+        size_type size_{0};
+    };
+
+} // namespace spl::container
+
+template <std::size_t CapacityV>
+struct std::hash<spl::container::static_string<CapacityV>> {
+    [[nodiscard]] constexpr auto operator()(spl::container::static_string<CapacityV> const& value) const noexcept
+        -> std::size_t {
+        return std::hash<std::string_view>{}(value.view());
+    }
+};
+
+template <std::size_t CapacityV>
+struct std::formatter<spl::container::static_string<CapacityV>> : public std::formatter<std::string_view> {
+    template <typename FormatContext>
+    [[nodiscard]] constexpr auto format(spl::container::static_string<CapacityV> const& value,
+                                        FormatContext&& ctx) const -> decltype(ctx.out()) {
+        return std::formatter<std::string_view>::format(value.view(), std::forward<FormatContext>(ctx));
+    }
+};
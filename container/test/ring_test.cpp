@@ -0,0 +1,141 @@
+#include "spl/container/ring.hpp"
+#include "spl/core/allocation.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+TEST(RingTest, StartsEmpty) {
+    auto const ring = spl::container::ring<int>{};
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.size(), 0);
+    EXPECT_EQ(ring.capacity(), 0);
+    EXPECT_EQ(ring.begin(), ring.end());
+}
+
+TEST(RingTest, PushesAndPopsAtBothEnds) {
+    auto ring = spl::container::ring<int>{};
+    ring.push_back(2);
+    ring.push_back(3);
+    ring.push_front(1);
+    ring.push_front(0);
+
+    ASSERT_EQ(ring.size(), 4);
+    EXPECT_EQ(ring.front(), 0);
+    EXPECT_EQ(ring.back(), 3);
+    EXPECT_EQ(ring[1], 1);
+    EXPECT_EQ(ring[2], 2);
+
+    ring.pop_front();
+    ring.pop_back();
+    ASSERT_EQ(ring.size(), 2);
+    EXPECT_EQ(ring.front(), 1);
+    EXPECT_EQ(ring.back(), 2);
+}
+
+TEST(RingTest, WrapsAroundWithoutGrowing) {
+    auto ring = spl::container::ring<int>{};
+    ring.reserve(16);
+    for (int value = 0; value < 1000; ++value) {
+        ring.push_back(value);
+        if (ring.size() > 10) {
+            ring.pop_front();
+        }
+    }
+
+    EXPECT_EQ(ring.capacity(), 16);
+    ASSERT_EQ(ring.size(), 10);
+    for (std::size_t index = 0; index < ring.size(); ++index) {
+        EXPECT_EQ(ring[index], 990 + static_cast<int>(index));
+    }
+}
+
+TEST(RingTest, GrowsAndKeepsOrder) {
+    auto ring = spl::container::ring<std::string>{};
+    ring.reserve(16);
+    for (int value = 0; value < 12; ++value) {
+        ring.push_back(std::to_string(value));
+    }
+    for (int count = 0; count < 8; ++count) {
+        ring.pop_front();
+    }
+    for (int value = 12; value < 20; ++value) {
+        ring.push_back(std::to_string(value));
+    }
+    for (int value = 1; value <= 10; ++value) {
+        ring.push_front(std::to_string(-value));
+    }
+
+    EXPECT_EQ(ring.size(), 22);
+    EXPECT_EQ(ring.capacity(), 32);
+    EXPECT_EQ(ring.front(), "-10");
+    EXPECT_EQ(ring[9], "-1");
+    EXPECT_EQ(ring[10], "8");
+    EXPECT_EQ(ring.back(), "19");
+}
+
+TEST(RingTest, ErasesFromTheFront) {
+    auto ring = spl::container::ring<int>{};
+    for (int value = 0; value < 20; ++value) {
+        ring.push_back(value);
+    }
+
+    auto const iter = std::find_if(ring.cbegin(), ring.cend(), [](int value) { return value >= 15; });
+    ring.erase(ring.cbegin(), iter);
+
+    ASSERT_EQ(ring.size(), 5);
+    EXPECT_EQ(ring.front(), 15);
+    EXPECT_EQ(ring.back(), 19);
+}
+
+TEST(RingTest, IteratesInOrder) {
+    auto ring = spl::container::ring<int>{};
+    ring.reserve(16);
+    for (int value = 0; value < 20; ++value) {
+        ring.push_back(value);
+        if (value % 4 == 0) {
+            ring.pop_front();
+        }
+    }
+
+    auto expected = std::vector<int>(15);
+    std::iota(std::begin(expected), std::end(expected), 5);
+    EXPECT_EQ(ring.capacity(), 16);
+    EXPECT_TRUE(std::equal(ring.begin(), ring.end(), std::begin(expected), std::end(expected)));
+    EXPECT_EQ(std::accumulate(ring.cbegin(), ring.cend(), 0), 180);
+    EXPECT_EQ(ring.end() - ring.begin(), 15);
+    EXPECT_EQ(*(ring.begin() + 10), 15);
+}
+
+TEST(RingTest, CopiesAndMoves) {
+    auto ring = spl::container::ring<std::string>{};
+    ring.push_back("a");
+    ring.push_back("b");
+
+    auto copy = ring;
+    ring.pop_front();
+    ASSERT_EQ(copy.size(), 2);
+    EXPECT_EQ(copy.front(), "a");
+
+    auto const moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 2);
+    EXPECT_TRUE(copy.empty());
+}
+
+TEST(RingTest, DoesNotAllocateOnceGrown) {
+    auto const tracker = spl::allocation::tracker{};
+    auto ring          = spl::container::ring<int, spl::allocation::counting_allocator<int>>{};
+    for (int value = 0; value < 100; ++value) {
+        ring.push_back(value);
+    }
+    auto const grown = tracker.allocations();
+    EXPECT_EQ(grown, 4);
+
+    for (int value = 0; value < 100'000; ++value) {
+        ring.pop_front();
+        ring.push_back(value);
+    }
+    EXPECT_EQ(tracker.allocations(), grown);
+}
@@ -0,0 +1,56 @@
+#include "spl/container/static_string.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+using namespace std::literals;
+
+TEST(StaticStringTest, StartsEmpty) {
+    auto const value = spl::container::static_string<8>{};
+    EXPECT_TRUE(value.empty());
+    EXPECT_EQ(value.size(), 0);
+    EXPECT_EQ(value.view(), ""sv);
+}
+
+TEST(StaticStringTest, BuildsFromStringsAndViews) {
+    auto const from_literal = spl::container::static_string<16>{"4821"};
+    auto const from_view    = spl::container::static_string<16>{"4821"sv};
+    auto const from_string  = spl::container::static_string<16>{std::string{"4821"}};
+    auto const from_pointer = spl::container::static_string<16>{"48210", 4};
+
+    EXPECT_EQ(from_literal.view(), "4821"sv);
+    EXPECT_EQ(from_literal, from_view);
+    EXPECT_EQ(from_view, from_string);
+    EXPECT_EQ(from_string, from_pointer);
+    EXPECT_EQ(static_cast<std::string_view>(from_string), "4821"sv);
+}
+
+TEST(StaticStringTest, TruncatesToCapacity) {
+    auto const value = spl::container::static_string<4>{"abcdefgh"sv};
+    EXPECT_EQ(value.size(), 4);
+    EXPECT_EQ(value.view(), "abcd"sv);
+}
+
+TEST(StaticStringTest, HoldsAnUuid) {
+    constexpr auto uuid = "2f1c33b4-5d0a-4f0e-9a2c-4e7d5a0b9c11"sv;
+    auto const value    = spl::container::static_string<40>{uuid};
+    EXPECT_EQ(value.view(), uuid);
+    EXPECT_EQ(std::string(value.begin(), value.end()), uuid);
+}
+
+TEST(StaticStringTest, ComparesAndHashesLikeTheView) {
+    using string_type = spl::container::static_string<8>;
+    EXPECT_LT(string_type{"abc"}, string_type{"abd"});
+    EXPECT_LT(string_type{"ab"}, string_type{"abc"});
+    EXPECT_NE(string_type{"abc"}, string_type{"ab"});
+    EXPECT_EQ(std::hash<string_type>{}(string_type{"abc"}), std::hash<std::string_view>{}("abc"sv));
+
+    auto const values = std::unordered_set<string_type>{"a", "b", "a"};
+    EXPECT_EQ(values.size(), 2);
+}
+
+TEST(StaticStringTest, Formats) {
+    EXPECT_EQ(std::format("[{}]", spl::container::static_string<8>{"42"}), "[42]");
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace spl { inline namespace core {
+
+    namespace allocation {
+
+        /**
+         * @brief Heap activity of a thread, as seen by the counting hook or the counting allocator.
+         */
+        struct statistics {
+            std::size_t allocations{0};   ///< Blocks allocated.
+            std::size_t deallocations{0}; ///< Blocks released.
+            std::size_t bytes{0};         ///< Bytes requested.
+        };
+
+        inline constinit thread_local statistics current{};
+
+        /**
+         * @brief Heap activity of the calling thread since it started.
+         */
+        [[nodiscard]] inline auto local() noexcept -> statistics const& {
+            return current;
+        }
+
+        inline auto allocated(std::size_t bytes) noexcept -> void {
+            ++current.allocations;
+            current.bytes += bytes;
+        }
+
+        inline auto released() noexcept -> void {
+            ++current.deallocations;
+        }
+
+        /**
+         * @brief Heap activity of the calling thread between the construction (or the last reset) and now.
+         *
+         * Counts nothing unless the binary installs the hook with SPL_ALLOCATION_HOOK() or the containers under test
+         * use the counting allocator. Typical use is to warm a pipeline up, reset, run it again and expect zero.
+         */
+        class tracker {
+        public:
+            tracker() noexcept : start_(local()) {}
+
+            [[nodiscard]] auto allocations() const noexcept -> std::size_t {
+                return local().allocations - start_.allocations;
+            }
+
+            [[nodiscard]] auto deallocations() const noexcept -> std::size_t {
+                return local().deallocations - start_.deallocations;
+            }
+
+            [[nodiscard]] auto bytes() const noexcept -> std::size_t {
+                return local().bytes - start_.bytes;
+            }
+
+            auto reset() noexcept -> void {
+                start_ = local();
+            }
+
+        private:
+            statistics start_;
+        };
+
+        /**
+         * @brief Standard allocator counting into the statistics of the calling thread, to track a single container
+         * when the hook is not installed. Do not combine both, every block would be counted twice.
+         */
+        template <typename T>
+        struct counting_allocator {
+            using value_type = T;
+
+            constexpr counting_allocator() noexcept = default;
+
+            template <typename U>
+            constexpr counting_allocator(counting_allocator<U> const&) noexcept {}
+
+            [[nodiscard]] auto allocate(std::size_t count) -> T* {
+                allocated(count * sizeof(T));
+                return std::allocator<T>{}.allocate(count);
+            }
+
+            auto deallocate(T* pointer, std::size_t count) noexcept -> void {
+                released();
+                std::allocator<T>{}.deallocate(pointer, count);
+            }
+
+            template <typename U>
+            [[nodiscard]] constexpr auto operator==(counting_allocator<U> const&) const noexcept -> bool {
+                return true;
+            }
+        };
+
+    } // namespace allocation
+
+}} // namespace spl::core
+
+/**
+ * @brief Replaces the global operator new and delete with versions that count into spl::allocation, so every heap
+ * allocation of the thread shows up in an spl::allocation::tracker. Expand it once per binary, at namespace scope.
+ */
+#define SPL_ALLOCATION_HOOK()                                                                                          \
+    auto operator new(std::size_t size) -> void* {                                                                     \
+        spl::allocation::allocated(size);                                                                              \
+        if (auto* pointer = std::malloc(size == 0 ? 1 : size); pointer != nullptr) [[likely]] {                        \
+            return pointer;                                                                                            \
+        }                                                                                                              \
+        throw std::bad_alloc{};                                                                                        \
+    }                                                                                                                  \
+    auto operator delete(void* pointer) noexcept -> void {                                                             \
+        if (pointer != nullptr) {                                                                                      \
+            spl::allocation::released();                                                                               \
+        }                                                                                                              \
+        std::free(pointer);                                                                                            \
+    }                                                                                                                  \
+    auto operator delete(void* pointer, std::size_t) noexcept -> void {                                                \
+        ::operator delete(pointer);                                                                                    \
+    }
@@ -0,0 +1,187 @@
+#include "corpus.hpp"
+
+#include "spl/codec/json/decoder.hpp"
+#include "spl/exchange/bybit/feeder/tagger.hpp"
+#include "spl/exchange/bybit/feeder/transformer.hpp"
+#include "spl/protocol/bybit/websocket/public_stream/decoder.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/types/price.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using decoder_type     = spl::protocol::bybit::websocket::public_stream::decoder<spl::codec::json::decoder,
+                                                                             spl::exchange::bybit::feeder::tagger>;
+using transformer_type = spl::exchange::bybit::feeder::transformer;
+using trade_type       = spl::protocol::bybit::websocket::public_stream::trade::trade;
+using trade_summary    = spl::protocol::feeder::trade::trade_summary;
+
+// Configuration
+namespace {
+    constexpr std::size_t FIXED_TRADES = 8192;
+    constexpr std::uint32_t SEED       = 42;
+} // namespace
+
+// Corpus generator: publicTrade snapshots laid out byte for byte like the feed, with `trades` trades per message
+static auto generate_corpus(std::size_t trades) -> spl::exchange::benchmark::corpus {
+    return spl::exchange::benchmark::bybit_frames(FIXED_TRADES / trades, trades, trades, SEED);
+}
+
+// Decodes every frame once and keeps the trade messages, which point into the corpus, to time the transformer alone
+static auto decode_corpus(spl::exchange::benchmark::corpus const& corpus) -> std::vector<trade_type> {
+    auto const decoder = decoder_type{};
+    auto trades        = std::vector<trade_type>{};
+    for (auto const& frame : corpus.frames) {
+        auto const keep = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+            if constexpr (std::is_same_v<std::decay_t<EventT>, trade_type>) {
+                trades.push_back(event);
+            }
+            return spl::success();
+        };
+        std::ignore = decoder(std::span<char const>{frame}, keep);
+    }
+    return trades;
+}
+
+// Decoder only: tag lookup and JSON parsing into the venue structures
+static auto decode(benchmark::State& state, spl::exchange::benchmark::corpus const& corpus) -> void {
+    auto const decoder = decoder_type{};
+    auto const sink    = [](auto const& event) -> spl::result<void> {
+        benchmark::DoNotOptimize(&event);
+        return spl::success();
+    };
+
+    for (auto _ : state) {
+        for (auto const& frame : corpus.frames) {
+            auto const decoded = decoder(std::span<char const>{frame}, sink);
+            benchmark::DoNotOptimize(decoded);
+        }
+    }
+
+    spl::exchange::benchmark::record(state, corpus);
+}
+
+// Decoder and transformer: what codegen::decode runs for every inbound frame
+static auto pipeline(benchmark::State& state, spl::exchange::benchmark::corpus const& corpus) -> void {
+    auto const decoder = decoder_type{};
+    auto transformer   = transformer_type{};
+    auto summaries     = std::size_t{0};
+    auto const sink    = [&](auto const& event) -> spl::result<void> {
+        benchmark::DoNotOptimize(&event);
+        summaries += std::is_same_v<std::decay_t<decltype(event)>, trade_summary>;
+        return spl::success();
+    };
+    auto const transformation = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        return transformer(std::forward<EventT>(event), sink);
+    };
+
+    for (auto _ : state) {
+        for (auto const& frame : corpus.frames) {
+            auto const decoded = decoder(std::span<char const>{frame}, transformation);
+            benchmark::DoNotOptimize(decoded);
+        }
+    }
+
+    spl::exchange::benchmark::record(state, corpus);
+    state.counters["trades_per_second"] = benchmark::Counter(static_cast<double>(summaries),
+                                                             benchmark::Counter::kIsRate);
+}
+
+static void BM_BybitDecoder(benchmark::State& state) {
+    decode(state, generate_corpus(static_cast<std::size_t>(state.range(0))));
+    state.counters["trades_per_msg"] = state.range(0);
+}
+
+static void BM_BybitPipeline(benchmark::State& state) {
+    pipeline(state, generate_corpus(static_cast<std::size_t>(state.range(0))));
+    state.counters["trades_per_msg"] = state.range(0);
+}
+
+// Transformer only: decimal parsing, timestamp conversion and normalisation into trade_summary
+static void BM_BybitTransformer(benchmark::State& state) {
+    auto const corpus   = generate_corpus(static_cast<std::size_t>(state.range(0)));
+    auto const messages = decode_corpus(corpus);
+    auto transformer    = transformer_type{};
+    auto const sink     = [](trade_summary const& summary) -> spl::result<void> {
+        benchmark::DoNotOptimize(&summary);
+        return spl::success();
+    };
+
+    for (auto _ : state) {
+        for (auto const& message : messages) {
+            auto const transformed = transformer(message, sink);
+            benchmark::DoNotOptimize(transformed);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(messages) * state.range(0));
+    state.counters["trades_per_msg"] = state.range(0);
+}
+
+// Tag lookup alone: finding the "op" tag, then falling back to the topic for market data
+static void BM_BybitTagger(benchmark::State& state) {
+    using tagger_type = spl::exchange::bybit::feeder::tagger<typename decoder_type::value_type>;
+    auto const corpus = generate_corpus(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (auto const& frame : corpus.frames) {
+            auto const tag = tagger_type::hash<'o', 'p'>(std::span<char const>{frame});
+            benchmark::DoNotOptimize(tag);
+        }
+    }
+
+    spl::exchange::benchmark::record(state, corpus);
+    state.counters["trades_per_msg"] = state.range(0);
+}
+
+// Decimal parsing of the price and size strings the feed sends
+static void BM_BybitDecimalFromChars(benchmark::State& state) {
+    auto const corpus   = generate_corpus(1);
+    auto const messages = decode_corpus(corpus);
+    auto values         = std::vector<std::string_view>{};
+    for (auto const& message : messages) {
+        for (auto const& item : message.data) {
+            values.push_back(item.p);
+            values.push_back(item.v);
+        }
+    }
+
+    for (auto _ : state) {
+        for (auto const& value : values) {
+            auto const parsed = spl::types::price::from_chars(value);
+            benchmark::DoNotOptimize(parsed);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(values));
+}
+
+// Benchmark registrations: Arg(trades per message)
+BENCHMARK(BM_BybitDecoder)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BybitTransformer)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BybitPipeline)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BybitTagger)->Arg(1)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BybitDecimalFromChars)->Unit(benchmark::kMicrosecond);
+
+// Recorded frames are benchmarked as well when SPL_BENCHMARK_JOURNAL holds a Bybit journal
+auto main(int argc, char** argv) -> int {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    auto const captured = spl::exchange::benchmark::captured(spl::protocol::common::exchange_id::bybit);
+    if (not captured.empty()) {
+        benchmark::RegisterBenchmark("BM_BybitDecoderJournal", decode, captured)->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark("BM_BybitPipelineJournal", pipeline, captured)->Unit(benchmark::kMicrosecond);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -15,6 +15,9 @@ namespace spl::exchange::bybit::feeder {
 
         template <typename... ArgsT>
         [[nodiscard]] constexpr auto operator()(ArgsT&&... args) noexcept -> spl::result<response_type> {
+            if constexpr (EnvironmentV == spl::exchange::common::environment::simulator) {
+                return std::make_tuple(std::string("localhost"), std::string("9443"), std::string("/v5/public/spot"));
+            }
             auto const url = [&]() -> std::string {
                 auto const prefix = []() {
                     if constexpr (EnvironmentV == spl::exchange::common::environment::sandbox) {
@@ -19,7 +19,8 @@ namespace spl::exchange::bybit::feeder {
         using decoder_type = spl::protocol::bybit::websocket::public_stream::decoder<spl::codec::json::decoder, tagger>;
         using encoder_type = spl::protocol::bybit::websocket::public_stream::encoder<spl::codec::json::encoder, tagger>;
         using transformer_type            = spl::exchange::bybit::feeder::transformer;
-        using connection_type             = spl::network::client::wss;
+        using connection_type = spl::network::client::deflated_wss< //
+            spl::network::socket::layer::deflate{.enabled = true}, spl::network::socket::profile::low_latency>;
         using connector_type              = spl::exchange::bybit::feeder::connector<EnvironmentV>;
         constexpr static auto environment = EnvironmentV;
         constexpr static auto exchange    = spl::protocol::common::exchange_id::bybit;
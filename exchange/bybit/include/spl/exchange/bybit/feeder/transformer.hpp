@@ -18,8 +18,6 @@
 #include "spl/types/price.hpp"
 #include "spl/types/quantity.hpp"
 
-#include <boost/lexical_cast.hpp>
-
 #include <algorithm>
 #include <chrono>
 #include <limits>
@@ -128,12 +126,14 @@ namespace spl::exchange::bybit::feeder {
             for (auto const& item : input.data) {
                 auto const price        = spl::types::price::from(item.p);
                 auto const quantity     = spl::types::quantity::from(item.v);
-                auto const side         = spl::protocol::common::aggressor_side(item.S == "Buy");
-                auto const milliseconds = std::chrono::milliseconds(boost::lexical_cast<std::uint64_t>(item.T));
+                auto const side         = item.S == "Buy" ? spl::protocol::common::aggressor_side::buy
+                                                          : spl::protocol::common::aggressor_side::sell;
+                auto const milliseconds = std::chrono::milliseconds(item.T);
                 auto const nanoseconds  = std::chrono::duration_cast<std::chrono::nanoseconds>(milliseconds);
                 auto const sequence     = spl::protocol::common::sequence(item.seq);
                 err_return(functor(spl::protocol::feeder::trade::trade_summary{
                     .exchange_id = spl::protocol::common::exchange_id::bybit,
+                    .trade_id    = spl::protocol::common::trade_id(item.i),
                     .side        = side,
                     .price       = price,
                     .quantity    = quantity,
@@ -0,0 +1,58 @@
+#include "corpus.hpp"
+
+#include "spl/codec/json/decoder.hpp"
+#include "spl/container/ring.hpp"
+#include "spl/core/allocation.hpp"
+#include "spl/exchange/bybit/feeder/tagger.hpp"
+#include "spl/exchange/bybit/feeder/transformer.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/protocol/bybit/websocket/public_stream/decoder.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+SPL_ALLOCATION_HOOK()
+
+using decoder_type     = spl::protocol::bybit::websocket::public_stream::decoder<spl::codec::json::decoder,
+                                                                             spl::exchange::bybit::feeder::tagger>;
+using transformer_type = spl::exchange::bybit::feeder::transformer;
+using trade_summary    = spl::protocol::feeder::trade::trade_summary;
+using multimeter_type  = spl::metrics::stream::multimeter<trade_summary, spl::container::ring>;
+
+TEST(AllocationTest, PipelineSteadyStateDoesNotAllocate) {
+    // publicTrade snapshots laid out like the feed, up to four trades each
+    auto const frames  = spl::exchange::benchmark::bybit_frames(20'000, 1, 4, 42).frames;
+    auto const decoder = decoder_type{};
+    auto transformer   = transformer_type{};
+    auto multimeter    = multimeter_type{std::chrono::seconds{1}};
+    auto summaries     = std::size_t{0};
+
+    auto const sink = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        if constexpr (std::is_same_v<std::decay_t<EventT>, trade_summary>) {
+            std::ignore = multimeter(event);
+            ++summaries;
+        }
+        return spl::success();
+    };
+    auto const transformation = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        return transformer(std::forward<EventT>(event), sink);
+    };
+
+    // Decode → transform → stream multimeter, the first half fills the window and grows every buffer
+    auto const half = std::size(frames) / 2;
+    for (auto const& frame : std::span{frames}.first(half)) {
+        ASSERT_TRUE(decoder(std::span<char const>{frame}, transformation));
+    }
+
+    auto const tracker = spl::allocation::tracker{};
+    for (auto const& frame : std::span{frames}.subspan(half)) {
+        ASSERT_TRUE(decoder(std::span<char const>{frame}, transformation));
+    }
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_GT(summaries, std::size(frames));
+}
@@ -0,0 +1,37 @@
+#include "spl/exchange/bybit/feeder/transformer.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using trade_type    = spl::protocol::bybit::websocket::public_stream::trade::trade;
+using trade_summary = spl::protocol::feeder::trade::trade_summary;
+
+// Sides of the summaries the transformer emits for a publicTrade snapshot with one trade per side given
+static auto transform(std::vector<std::string_view> const& sides)
+    -> std::vector<spl::protocol::common::aggressor_side> {
+    auto input = trade_type{.topic = "publicTrade.BTCUSDT", .type = "snapshot", .ts = 1'700'000'000'000};
+    for (auto const side : sides) {
+        input.data.push_back({.i = "1", .T = 1'700'000'000'000, .p = "100.0", .v = "0.1", .S = side, .seq = 1});
+    }
+
+    auto transformer = spl::exchange::bybit::feeder::transformer{};
+    auto result      = std::vector<spl::protocol::common::aggressor_side>{};
+    auto const sink  = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        if constexpr (std::is_same_v<std::decay_t<EventT>, trade_summary>) {
+            result.push_back(event.side);
+        }
+        return spl::success();
+    };
+    EXPECT_TRUE(transformer(input, sink));
+    return result;
+}
+
+TEST(TransformerTest, KeepsTheAggressorSide) {
+    auto const sides = transform({"Buy", "Sell"});
+    ASSERT_EQ(std::size(sides), 2);
+    EXPECT_EQ(sides[0], spl::protocol::common::aggressor_side::buy);
+    EXPECT_EQ(sides[1], spl::protocol::common::aggressor_side::sell);
+}
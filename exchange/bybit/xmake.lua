@@ -10,6 +10,13 @@ target("exchange-bybit-test")
     set_kind("binary")
     set_group("test")
     add_files("test/*.cpp")
-    add_deps("exchange-bybit")
+    add_deps("exchange-bybit", "exchange-corpus", "metrics")
     add_packages("gtest")
 target_end()
+
+target("exchange-bybit-benchmark")
+    set_kind("binary")
+    add_files("benchmark/decoder_benchmark.cpp")
+    add_deps("exchange-bybit", "exchange-corpus")
+    add_packages("benchmark")
+target_end()
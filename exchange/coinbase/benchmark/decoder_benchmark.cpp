@@ -0,0 +1,232 @@
+#include "corpus.hpp"
+
+#include "spl/codec/json/decoder.hpp"
+#include "spl/exchange/coinbase/feeder/tagger.hpp"
+#include "spl/exchange/coinbase/feeder/transformer.hpp"
+#include "spl/protocol/coinbase/websocket/public_stream/decoder.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/types/price.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <format>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+using decoder_type     = spl::protocol::coinbase::websocket::public_stream::decoder<
+    spl::codec::json::decoder, spl::exchange::coinbase::feeder::tagger>;
+using transformer_type = spl::exchange::coinbase::feeder::transformer;
+using ticker_type      = spl::protocol::coinbase::websocket::public_stream::ticker::ticker;
+using trade_summary    = spl::protocol::feeder::trade::trade_summary;
+
+// Configuration
+namespace {
+    constexpr std::size_t FIXED_TRADES = 8192;
+    constexpr std::uint32_t SEED       = 42;
+} // namespace
+
+// Corpus generator: ticker messages laid out byte for byte like the feed, with a heartbeat every `every` tickers
+static auto generate_corpus(std::size_t every) -> spl::exchange::benchmark::corpus {
+    auto corpus = spl::exchange::benchmark::corpus{};
+    corpus.frames.reserve(FIXED_TRADES * 2);
+
+    auto rng        = std::mt19937{SEED};
+    auto price_dist = std::uniform_int_distribution<std::int64_t>{9'500'000, 10'500'000};
+    auto size_dist  = std::uniform_int_distribution<std::int64_t>{1, 50'000'000};
+    auto side_dist  = std::uniform_int_distribution<int>{0, 1};
+
+    auto microseconds = std::int64_t{0};
+    auto sequence     = std::int64_t{90'000'000'000};
+    auto trade_id     = std::int64_t{600'000'000};
+    for (std::size_t i = 0; i < FIXED_TRADES; ++i) {
+        microseconds += 1 + static_cast<std::int64_t>(rng() % 50'000);
+        auto const seconds = microseconds / 1'000'000;
+        auto const time    = std::format("2024-11-14T{:02}:{:02}:{:02}.{:06}Z", 10 + seconds / 3600,
+                                         seconds / 60 % 60, seconds % 60, microseconds % 1'000'000);
+        auto const price   = price_dist(rng);
+        corpus.frames.emplace_back(std::format(
+            R"({{"type":"ticker","sequence":{},"product_id":"BTC-USD","price":"{}.{:02}","open_24h":"88210.01",)"
+            R"("volume_24h":"14231.56012874","low_24h":"87021.5","high_24h":"91337.67","volume_30d":"421873.1187",)"
+            R"("best_bid":"{}.{:02}","best_bid_size":"0.01184215","best_ask":"{}.{:02}","best_ask_size":"0.4",)"
+            R"("side":"{}","time":"{}","trade_id":{},"last_size":"0.{:08}"}})",
+            ++sequence, price / 100, price % 100, price / 100, price % 100, (price + 1) / 100, (price + 1) % 100,
+            side_dist(rng) == 0 ? "buy" : "sell", time, ++trade_id, size_dist(rng)));
+        if (every != 0 and (i + 1) % every == 0) {
+            corpus.frames.emplace_back(
+                std::format(R"({{"type":"heartbeat","last_trade_id":{},"product_id":"BTC-USD","sequence":{},)"
+                            R"("time":"{}"}})",
+                            trade_id, sequence, time));
+        }
+    }
+    return corpus;
+}
+
+// Decodes every frame once and keeps the tickers, which point into the corpus, to time the transformer alone
+static auto decode_corpus(spl::exchange::benchmark::corpus const& corpus) -> std::vector<ticker_type> {
+    auto const decoder = decoder_type{};
+    auto tickers       = std::vector<ticker_type>{};
+    for (auto const& frame : corpus.frames) {
+        auto const keep = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+            if constexpr (std::is_same_v<std::decay_t<EventT>, ticker_type>) {
+                tickers.push_back(event);
+            }
+            return spl::success();
+        };
+        std::ignore = decoder(std::span<char const>{frame}, keep);
+    }
+    return tickers;
+}
+
+// Decoder only: tag lookup and JSON parsing into the venue structures
+static auto decode(benchmark::State& state, spl::exchange::benchmark::corpus const& corpus) -> void {
+    auto const decoder = decoder_type{};
+    auto const sink    = [](auto const& event) -> spl::result<void> {
+        benchmark::DoNotOptimize(&event);
+        return spl::success();
+    };
+
+    for (auto _ : state) {
+        for (auto const& frame : corpus.frames) {
+            auto const decoded = decoder(std::span<char const>{frame}, sink);
+            benchmark::DoNotOptimize(decoded);
+        }
+    }
+
+    spl::exchange::benchmark::record(state, corpus);
+}
+
+// Decoder and transformer: what codegen::decode runs for every inbound frame
+static auto pipeline(benchmark::State& state, spl::exchange::benchmark::corpus const& corpus) -> void {
+    auto const decoder = decoder_type{};
+    auto transformer   = transformer_type{};
+    auto summaries     = std::size_t{0};
+    auto const sink    = [&](auto const& event) -> spl::result<void> {
+        benchmark::DoNotOptimize(&event);
+        summaries += std::is_same_v<std::decay_t<decltype(event)>, trade_summary>;
+        return spl::success();
+    };
+    auto const transformation = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        return transformer(std::forward<EventT>(event), sink);
+    };
+
+    for (auto _ : state) {
+        for (auto const& frame : corpus.frames) {
+            auto const decoded = decoder(std::span<char const>{frame}, transformation);
+            benchmark::DoNotOptimize(decoded);
+        }
+    }
+
+    spl::exchange::benchmark::record(state, corpus);
+    state.counters["trades_per_second"] = benchmark::Counter(static_cast<double>(summaries),
+                                                             benchmark::Counter::kIsRate);
+}
+
+static void BM_CoinbaseDecoder(benchmark::State& state) {
+    decode(state, generate_corpus(static_cast<std::size_t>(state.range(0))));
+    state.counters["heartbeat_every"] = state.range(0);
+}
+
+static void BM_CoinbasePipeline(benchmark::State& state) {
+    pipeline(state, generate_corpus(static_cast<std::size_t>(state.range(0))));
+    state.counters["heartbeat_every"] = state.range(0);
+}
+
+// Transformer only: decimal parsing, ISO 8601 parsing and normalisation into trade_summary
+static void BM_CoinbaseTransformer(benchmark::State& state) {
+    auto const corpus  = generate_corpus(0);
+    auto const tickers = decode_corpus(corpus);
+    auto transformer   = transformer_type{};
+    auto const sink    = [](trade_summary const& summary) -> spl::result<void> {
+        benchmark::DoNotOptimize(&summary);
+        return spl::success();
+    };
+
+    for (auto _ : state) {
+        for (auto const& ticker : tickers) {
+            auto const transformed = transformer(ticker, sink);
+            benchmark::DoNotOptimize(transformed);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(tickers));
+}
+
+// Tag lookup alone: finding the "type" tag of every message
+static void BM_CoinbaseTagger(benchmark::State& state) {
+    using tagger_type = spl::exchange::coinbase::feeder::tagger<typename decoder_type::value_type>;
+    auto const corpus = generate_corpus(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (auto const& frame : corpus.frames) {
+            auto const tag = tagger_type::hash<'t', 'y', 'p', 'e'>(std::span<char const>{frame});
+            benchmark::DoNotOptimize(tag);
+        }
+    }
+
+    spl::exchange::benchmark::record(state, corpus);
+}
+
+// Decimal parsing of the price and size strings the feed sends
+static void BM_CoinbaseDecimalFromChars(benchmark::State& state) {
+    auto const corpus  = generate_corpus(0);
+    auto const tickers = decode_corpus(corpus);
+    auto values        = std::vector<std::string_view>{};
+    for (auto const& ticker : tickers) {
+        values.push_back(ticker.price);
+        values.push_back(ticker.last_size);
+    }
+
+    for (auto _ : state) {
+        for (auto const& value : values) {
+            auto const parsed = spl::types::price::from_chars(value);
+            benchmark::DoNotOptimize(parsed);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(values));
+}
+
+// Timestamp parsing of the ticker time, with microseconds as the feed sends them
+static void BM_CoinbaseParseIso8601(benchmark::State& state) {
+    auto const corpus  = generate_corpus(0);
+    auto const tickers = decode_corpus(corpus);
+
+    for (auto _ : state) {
+        for (auto const& ticker : tickers) {
+            auto const parsed = transformer_type::parse_iso8601(ticker.time);
+            benchmark::DoNotOptimize(parsed);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(tickers));
+}
+
+// Benchmark registrations: Arg(tickers between two heartbeats, 0 for none)
+BENCHMARK(BM_CoinbaseDecoder)->Arg(0)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CoinbaseTransformer)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CoinbasePipeline)->Arg(0)->Arg(1)->Arg(16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CoinbaseTagger)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CoinbaseDecimalFromChars)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CoinbaseParseIso8601)->Unit(benchmark::kMicrosecond);
+
+// Recorded frames are benchmarked as well when SPL_BENCHMARK_JOURNAL holds a Coinbase journal
+auto main(int argc, char** argv) -> int {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    auto const captured = spl::exchange::benchmark::captured(spl::protocol::common::exchange_id::coinbase);
+    if (not captured.empty()) {
+        benchmark::RegisterBenchmark("BM_CoinbaseDecoderJournal", decode, captured)->Unit(benchmark::kMicrosecond);
+        benchmark::RegisterBenchmark("BM_CoinbasePipelineJournal", pipeline, captured)->Unit(benchmark::kMicrosecond);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -15,6 +15,9 @@ namespace spl::exchange::coinbase::feeder {
 
         template <typename... ArgsT>
         [[nodiscard]] constexpr auto operator()(ArgsT&&... args) noexcept -> spl::result<response_type> {
+            if constexpr (EnvironmentV == spl::exchange::common::environment::simulator) {
+                return std::make_tuple(std::string("localhost"), std::string("9444"), std::string("/"));
+            }
             auto const url = [&]() -> std::string {
                 if constexpr (EnvironmentV == spl::exchange::common::environment::sandbox) {
                     return "wss://ws-feed-public.sandbox.exchange.coinbase.com/";
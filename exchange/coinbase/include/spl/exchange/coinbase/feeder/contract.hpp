@@ -17,7 +17,7 @@ namespace spl::exchange::coinbase::feeder {
         using decoder_type = spl::protocol::coinbase::websocket::public_stream::decoder<spl::codec::json::decoder, tagger>;
         using encoder_type = spl::protocol::coinbase::websocket::public_stream::encoder<spl::codec::json::encoder, tagger>;
         using transformer_type            = spl::exchange::coinbase::feeder::transformer;
-        using connection_type             = spl::network::client::wss;
+        using connection_type = spl::network::client::tuned_wss<spl::network::socket::profile::low_latency>;
         using connector_type              = spl::exchange::coinbase::feeder::connector<EnvironmentV>;
         constexpr static auto environment = EnvironmentV;
         constexpr static auto exchange    = spl::protocol::common::exchange_id::coinbase;
@@ -21,6 +21,8 @@
 #include <boost/lexical_cast.hpp>
 
 #include <algorithm>
+#include <array>
+#include <charconv>
 #include <chrono>
 #include <ctime>
 #include <limits>
@@ -35,17 +37,55 @@
 namespace spl::exchange::coinbase::feeder {
 
     struct transformer {
+        /**
+         * @brief Parses the YYYY-MM-DDTHH:MM:SS[.fraction]Z timestamps of the feed in place, without allocating: the
+         * fraction is read up to the nanosecond, and anything malformed yields zero.
+         */
         [[nodiscard]] static auto parse_iso8601(std::string_view s) noexcept -> std::chrono::nanoseconds {
-            std::chrono::sys_time<std::chrono::nanoseconds> tp{};
-            std::istringstream is{std::string{s}};
-            is >> std::chrono::parse("%Y-%m-%dT%H:%M:%S.%fZ", tp);
-            if (is.fail()) [[unlikely]] {
-                is.clear();
-                is.str(std::string{s});
-                is >> std::chrono::parse("%Y-%m-%dT%H:%M:%SZ", tp);
+            auto const number = [&](std::size_t offset, std::size_t length) noexcept -> int {
+                auto value           = 0;
+                auto const* first    = std::data(s) + offset;
+                auto const [last, e] = std::from_chars(first, first + length, value);
+                return (e == std::errc{} and last == first + length) ? value : -1;
+            };
+
+            if (std::size(s) < 20 or s[4] != '-' or s[7] != '-' or s[10] != 'T' or s[13] != ':' or s[16] != ':')
+                [[unlikely]] {
+                return std::chrono::nanoseconds{0};
             }
 
-            return is.fail() ? std::chrono::nanoseconds{0} : tp.time_since_epoch();
+            auto const year   = number(0, 4);
+            auto const month  = number(5, 2);
+            auto const day    = number(8, 2);
+            auto const hour   = number(11, 2);
+            auto const minute = number(14, 2);
+            auto const second = number(17, 2);
+            auto const date   = std::chrono::year{year} / std::chrono::month(static_cast<unsigned>(month)) /
+                              std::chrono::day(static_cast<unsigned>(day));
+            if (year < 0 or month < 0 or day < 0 or hour < 0 or minute < 0 or second < 0 or not date.ok())
+                [[unlikely]] {
+                return std::chrono::nanoseconds{0};
+            }
+
+            auto index    = std::size_t{19};
+            auto fraction = std::int64_t{0};
+            if (s[index] == '.') {
+                auto digits = 0;
+                for (++index; index < std::size(s) and s[index] >= '0' and s[index] <= '9'; ++index) {
+                    if (digits++ < 9) {
+                        fraction = fraction * 10 + (s[index] - '0');
+                    }
+                }
+                for (; digits < 9; ++digits) {
+                    fraction *= 10;
+                }
+            }
+            if (index + 1 != std::size(s) or s[index] != 'Z') [[unlikely]] {
+                return std::chrono::nanoseconds{0};
+            }
+
+            return std::chrono::sys_days{date}.time_since_epoch() + std::chrono::hours{hour} +
+                   std::chrono::minutes{minute} + std::chrono::seconds{second} + std::chrono::nanoseconds{fraction};
         }
 
         [[nodiscard]] constexpr auto to_channel(spl::protocol::feeder::stream::channel type,
@@ -101,12 +141,16 @@ namespace spl::exchange::coinbase::feeder {
                                       FunctorT&& functor) noexcept -> spl::result<void> {
             auto const price       = spl::types::price::from(input.price);
             auto const quantity    = spl::types::quantity::from(input.last_size);
-            auto const side        = spl::protocol::common::aggressor_side(input.side == "buy");
+            auto const side        = input.side == "buy" ? spl::protocol::common::aggressor_side::buy
+                                                         : spl::protocol::common::aggressor_side::sell;
             auto const sequence    = spl::protocol::common::sequence(input.sequence);
             auto const nanoseconds = parse_iso8601(input.time);
+            auto identifier        = std::array<char, 20>{};
+            auto const last        = std::to_chars(std::begin(identifier), std::end(identifier), input.trade_id).ptr;
 
             return functor(spl::protocol::feeder::trade::trade_summary{
                 .exchange_id = spl::protocol::common::exchange_id::coinbase,
+                .trade_id    = spl::protocol::common::trade_id(std::string_view(std::data(identifier), last)),
                 .side        = side,
                 .price       = price,
                 .quantity    = quantity,
@@ -0,0 +1,91 @@
+#include "spl/codec/json/decoder.hpp"
+#include "spl/container/ring.hpp"
+#include "spl/core/allocation.hpp"
+#include "spl/exchange/coinbase/feeder/tagger.hpp"
+#include "spl/exchange/coinbase/feeder/transformer.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/protocol/coinbase/websocket/public_stream/decoder.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <format>
+#include <random>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+SPL_ALLOCATION_HOOK()
+
+using decoder_type     = spl::protocol::coinbase::websocket::public_stream::decoder<
+    spl::codec::json::decoder, spl::exchange::coinbase::feeder::tagger>;
+using transformer_type = spl::exchange::coinbase::feeder::transformer;
+using trade_summary    = spl::protocol::feeder::trade::trade_summary;
+using multimeter_type  = spl::metrics::stream::multimeter<trade_summary, spl::container::ring>;
+
+// Ticker messages laid out like the feed, a few milliseconds apart, with a heartbeat every sixteen of them
+static auto generate_frames(std::size_t count) -> std::vector<std::string> {
+    auto rng        = std::mt19937{42};
+    auto price_dist = std::uniform_int_distribution<std::int64_t>{9'500'000, 10'500'000};
+    auto size_dist  = std::uniform_int_distribution<std::int64_t>{1, 50'000'000};
+    auto frames     = std::vector<std::string>{};
+    frames.reserve(count + count / 16);
+
+    auto microseconds = std::int64_t{0};
+    auto sequence     = std::int64_t{90'000'000'000};
+    auto trade_id     = std::int64_t{600'000'000};
+    for (std::size_t i = 0; i < count; ++i) {
+        microseconds += 1 + static_cast<std::int64_t>(rng() % 10'000);
+        auto const seconds = microseconds / 1'000'000;
+        auto const time    = std::format("2024-11-14T{:02}:{:02}:{:02}.{:06}Z", 10 + seconds / 3600,
+                                         seconds / 60 % 60, seconds % 60, microseconds % 1'000'000);
+        auto const price   = price_dist(rng);
+        frames.emplace_back(std::format(
+            R"({{"type":"ticker","sequence":{},"product_id":"BTC-USD","price":"{}.{:02}","open_24h":"88210.01",)"
+            R"("volume_24h":"14231.56012874","low_24h":"87021.5","high_24h":"91337.67","volume_30d":"421873.1187",)"
+            R"("best_bid":"{}.{:02}","best_bid_size":"0.01184215","best_ask":"{}.{:02}","best_ask_size":"0.4",)"
+            R"("side":"{}","time":"{}","trade_id":{},"last_size":"0.{:08}"}})",
+            ++sequence, price / 100, price % 100, price / 100, price % 100, (price + 1) / 100, (price + 1) % 100,
+            rng() % 2 == 0 ? "buy" : "sell", time, ++trade_id, size_dist(rng)));
+        if ((i + 1) % 16 == 0) {
+            frames.emplace_back(
+                std::format(R"({{"type":"heartbeat","last_trade_id":{},"product_id":"BTC-USD","sequence":{},)"
+                            R"("time":"{}"}})",
+                            trade_id, sequence, time));
+        }
+    }
+    return frames;
+}
+
+TEST(AllocationTest, PipelineSteadyStateDoesNotAllocate) {
+    auto const frames  = generate_frames(20'000);
+    auto const decoder = decoder_type{};
+    auto transformer   = transformer_type{};
+    auto multimeter    = multimeter_type{std::chrono::seconds{1}};
+    auto summaries     = std::size_t{0};
+
+    auto const sink = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        if constexpr (std::is_same_v<std::decay_t<EventT>, trade_summary>) {
+            std::ignore = multimeter(event);
+            ++summaries;
+        }
+        return spl::success();
+    };
+    auto const transformation = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        return transformer(std::forward<EventT>(event), sink);
+    };
+
+    // Decode → transform → stream multimeter, the first half fills the window and grows every buffer
+    auto const half = std::size(frames) / 2;
+    for (auto const& frame : std::span{frames}.first(half)) {
+        ASSERT_TRUE(decoder(std::span<char const>{frame}, transformation));
+    }
+
+    auto const tracker = spl::allocation::tracker{};
+    for (auto const& frame : std::span{frames}.subspan(half)) {
+        ASSERT_TRUE(decoder(std::span<char const>{frame}, transformation));
+    }
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(summaries, 20'000);
+}
@@ -0,0 +1,37 @@
+#include "spl/exchange/coinbase/feeder/transformer.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+using ticker_type   = spl::protocol::coinbase::websocket::public_stream::ticker::ticker;
+using trade_summary = spl::protocol::feeder::trade::trade_summary;
+
+// Side of the summary the transformer emits for a ticker of the given side
+static auto transform(std::string_view side) -> std::optional<spl::protocol::common::aggressor_side> {
+    auto const input = ticker_type{.sequence   = 1,
+                                   .product_id = "BTC-USD",
+                                   .price      = "100.0",
+                                   .side       = side,
+                                   .time       = "2024-01-01T00:00:00.000000Z",
+                                   .trade_id   = 1,
+                                   .last_size  = "0.1"};
+
+    auto transformer = spl::exchange::coinbase::feeder::transformer{};
+    auto result      = std::optional<spl::protocol::common::aggressor_side>{};
+    auto const sink  = [&]<typename EventT>(EventT&& event) -> spl::result<void> {
+        if constexpr (std::is_same_v<std::decay_t<EventT>, trade_summary>) {
+            result = event.side;
+        }
+        return spl::success();
+    };
+    EXPECT_TRUE(transformer(input, sink));
+    return result;
+}
+
+TEST(TransformerTest, KeepsTheAggressorSide) {
+    EXPECT_EQ(transform("buy"), spl::protocol::common::aggressor_side::buy);
+    EXPECT_EQ(transform("sell"), spl::protocol::common::aggressor_side::sell);
+}
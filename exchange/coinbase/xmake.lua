@@ -10,6 +10,13 @@ target("exchange-coinbase-test")
     set_kind("binary")
     set_group("test")
     add_files("test/*.cpp")
-    add_deps("exchange-coinbase")
+    add_deps("exchange-coinbase", "metrics")
     add_packages("gtest")
 target_end()
+
+target("exchange-coinbase-benchmark")
+    set_kind("binary")
+    add_files("benchmark/decoder_benchmark.cpp")
+    add_deps("exchange-coinbase", "exchange-corpus")
+    add_packages("benchmark")
+target_end()
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "spl/components/feeder/journal.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace spl::exchange::benchmark {
+
+    /**
+     * @brief Inbound frames a decoder benchmark runs over, each one a complete websocket message.
+     */
+    struct corpus {
+        std::vector<std::string> frames{};
+
+        [[nodiscard]] auto bytes() const noexcept -> std::size_t {
+            return std::accumulate(std::begin(frames), std::end(frames), std::size_t{0},
+                                   [](auto total, auto const& frame) { return total + std::size(frame); });
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return std::empty(frames);
+        }
+    };
+
+    /**
+     * @brief Frames of a journal recorded with `metrics-capture --record`, when SPL_BENCHMARK_JOURNAL points at one
+     * recorded from the given venue. The corpus is empty otherwise, and the journal benchmarks are not registered.
+     */
+    [[nodiscard]] inline auto captured(spl::protocol::common::exchange_id exchange_id) -> corpus {
+        auto const* path = std::getenv("SPL_BENCHMARK_JOURNAL");
+        auto playback    = spl::components::feeder::playback{};
+        if (path == nullptr or not playback.open(std::filesystem::path{path})) {
+            return {};
+        }
+        if (playback.header().exchange_id != exchange_id) {
+            return {};
+        }
+
+        auto result = corpus{};
+        for (auto const& frame : playback) {
+            result.frames.emplace_back(std::data(frame.payload), std::size(frame.payload));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Bybit publicTrade snapshots laid out byte for byte like the feed: `count` BTCUSDT frames, 1 to 50 ms
+     * apart, each carrying between `min_trades` and `max_trades` trades, drawn from the given seed.
+     */
+    [[nodiscard]] inline auto bybit_frames(std::size_t count, std::size_t min_trades, std::size_t max_trades,
+                                           std::uint32_t seed) -> corpus {
+        auto result = corpus{};
+        result.frames.reserve(count);
+
+        auto rng        = std::mt19937{seed};
+        auto price_dist = std::uniform_int_distribution<std::int64_t>{9'500'000, 10'500'000};
+        auto size_dist  = std::uniform_int_distribution<std::int64_t>{1, 500'000};
+        auto side_dist  = std::uniform_int_distribution<int>{0, 1};
+        auto count_dist = std::uniform_int_distribution<std::size_t>{min_trades, max_trades};
+
+        auto timestamp = std::int64_t{1'700'000'000'000};
+        auto sequence  = std::int64_t{80'000'000'000};
+        for (std::size_t i = 0; i < count; ++i) {
+            timestamp += 1 + static_cast<std::int64_t>(rng() % 50);
+            auto const trades = min_trades == max_trades ? min_trades : count_dist(rng);
+            auto frame =
+                std::format(R"({{"topic":"publicTrade.BTCUSDT","type":"snapshot","ts":{},"data":[)", timestamp);
+            for (std::size_t j = 0; j < trades; ++j) {
+                auto const price = price_dist(rng);
+                std::format_to(std::back_inserter(frame),
+                               R"({}{{"i":"2290000000{}","T":{},"p":"{}.{:02}","v":"0.{:06}","S":"{}","seq":{},)"
+                               R"("s":"BTCUSDT","BT":false,"RPI":false}})",
+                               j == 0 ? "" : ",", sequence, timestamp, price / 100, price % 100, size_dist(rng),
+                               side_dist(rng) == 0 ? "Buy" : "Sell", sequence);
+                ++sequence;
+            }
+            frame += "]}";
+            result.frames.emplace_back(std::move(frame));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Reports messages/s and bytes/s over the corpus, plus the average frame size.
+     */
+    inline auto record(::benchmark::State& state, corpus const& corpus) -> void {
+        auto const bytes = corpus.bytes();
+        state.SetItemsProcessed(state.iterations() * std::size(corpus.frames));
+        state.SetBytesProcessed(state.iterations() * bytes);
+        state.counters["bytes_per_msg"] = static_cast<double>(bytes) / std::size(corpus.frames);
+    }
+
+} // namespace spl::exchange::benchmark
@@ -2,6 +2,6 @@
 
 namespace spl::exchange::common {
 
-    enum class environment { production = 0, sandbox };
+    enum class environment { production = 0, sandbox, simulator };
 
 } // namespace spl::exchange::common
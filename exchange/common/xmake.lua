@@ -2,4 +2,12 @@ target("exchange-common")
     set_kind("headeronly")
     add_headerfiles("include/spl/exchange/common/*.hpp")
     add_includedirs("include", {public = true})
-target_end()
\ No newline at end of file
+target_end()
+
+target("exchange-corpus")
+    set_kind("headeronly")
+    add_headerfiles("benchmark/*.hpp")
+    add_includedirs("benchmark", { public = true })
+    add_deps("components-feeder", "protocol-common", { public = true })
+    add_packages("benchmark", { public = true })
+target_end()
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "spl/components/feeder/codegen.hpp"
+#include "spl/components/feeder/redundant.hpp"
+#include "spl/components/feeder/replay.hpp"
 #include "spl/protocol/common/exchange_id.hpp"
 #include "spl/exchange/bybit/feeder/contract.hpp"
 #include "spl/exchange/coinbase/feeder/contract.hpp"
@@ -29,4 +31,12 @@ namespace spl::exchange::factory {
               spl::exchange::common::environment EnvironmentV = spl::exchange::common::environment::production>
     using feeder = spl::components::feeder::codegen<internal::contract<ExchangeIdV, EnvironmentV>>;
 
+    template <spl::protocol::common::exchange_id ExchangeIdV, std::size_t LegsV, //
+              spl::exchange::common::environment EnvironmentV = spl::exchange::common::environment::production>
+    using redundant_feeder = spl::components::feeder::redundant<internal::contract<ExchangeIdV, EnvironmentV>, LegsV>;
+
+    template <spl::protocol::common::exchange_id ExchangeIdV, //
+              spl::exchange::common::environment EnvironmentV = spl::exchange::common::environment::production>
+    using replay = spl::components::feeder::replay<internal::contract<ExchangeIdV, EnvironmentV>>;
+
 } // namespace spl::exchange::factory
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "spl/result/result.hpp"
+#include "spl/exchange/common/environment.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+
+#include <format>
+#include <string>
+#include <tuple>
+#include <utility>
+
+namespace spl::exchange::multicast::feeder {
+
+    /**
+     * @brief Resolves the group carrying the trades of a venue, one administratively scoped group (RFC 2365) per
+     * exchange. The sandbox group is joined on the loopback interface, so a local publisher can stand in for the feed.
+     */
+    template <spl::protocol::common::exchange_id ExchangeIdV, spl::exchange::common::environment EnvironmentV>
+    struct connector {
+        using response_type = std::tuple<std::string, std::string, std::string>;
+
+        template <typename... ArgsT>
+        [[nodiscard]] constexpr auto operator()(ArgsT&&... args) noexcept -> spl::result<response_type> {
+            auto const [prefix, interface] = []() {
+                if constexpr (EnvironmentV == spl::exchange::common::environment::sandbox) {
+                    return std::make_pair("239.255.10", "/127.0.0.1");
+                }
+                return std::make_pair("239.192.10", "");
+            }();
+            auto const host = std::format("{}.{}", prefix, std::to_underlying(ExchangeIdV) + 1);
+            auto const port = "30001";
+            auto const path = std::string(interface);
+            return std::make_tuple(host, port, path);
+        }
+    };
+
+} // namespace spl::exchange::multicast::feeder
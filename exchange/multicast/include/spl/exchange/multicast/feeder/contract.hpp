@@ -0,0 +1,25 @@
+#pragma once
+
+#include "spl/exchange/multicast/feeder/connector.hpp"
+#include "spl/exchange/multicast/feeder/transformer.hpp"
+#include "spl/components/feeder/session.hpp"
+#include "spl/network/client/udp.hpp"
+#include "spl/protocol/feeder/stream/channel.hpp"
+#include "spl/protocol/multicast/decoder.hpp"
+#include "spl/protocol/multicast/encoder.hpp"
+
+namespace spl::exchange::multicast::feeder {
+
+    template <spl::protocol::common::exchange_id ExchangeIdV, spl::exchange::common::environment EnvironmentV>
+    struct contract {
+        using decoder_type                = spl::protocol::multicast::decoder;
+        using encoder_type                = spl::protocol::multicast::encoder;
+        using transformer_type            = spl::exchange::multicast::feeder::transformer<ExchangeIdV>;
+        using connection_type             = spl::network::client::multicast;
+        using connector_type              = spl::exchange::multicast::feeder::connector<ExchangeIdV, EnvironmentV>;
+        constexpr static auto environment = EnvironmentV;
+        constexpr static auto exchange    = ExchangeIdV;
+        constexpr static auto channel     = spl::protocol::feeder::stream::channel::trades;
+    };
+
+} // namespace spl::exchange::multicast::feeder
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "spl/exchange/multicast/feeder/contract.hpp"
+#include "spl/components/feeder/codegen.hpp"
+
+namespace spl::exchange::multicast::feeder {
+
+    template <spl::protocol::common::exchange_id ExchangeIdV, spl::exchange::common::environment EnvironmentV>
+    using session = spl::components::feeder::codegen<contract<ExchangeIdV, EnvironmentV>>;
+
+} // namespace spl::exchange::multicast::feeder
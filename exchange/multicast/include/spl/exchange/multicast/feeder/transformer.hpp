@@ -0,0 +1,126 @@
+#pragma once
+
+#include "spl/components/feeder/sequencer.hpp"
+#include "spl/logger/logger.hpp"
+#include "spl/result/result.hpp"
+
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+#include "spl/protocol/feeder/stream/gap.hpp"
+#include "spl/protocol/feeder/stream/heartbeat.hpp"
+#include "spl/protocol/feeder/stream/ping.hpp"
+#include "spl/protocol/feeder/stream/pong.hpp"
+#include "spl/protocol/feeder/stream/subscribe.hpp"
+#include "spl/protocol/feeder/stream/unsubscribe.hpp"
+#include "spl/protocol/multicast/header.hpp"
+#include "spl/protocol/multicast/trade.hpp"
+#include "spl/types/price.hpp"
+#include "spl/types/quantity.hpp"
+
+#include <chrono>
+#include <functional>
+
+namespace spl::exchange::multicast::feeder {
+
+    /**
+     * @brief Maps the multicast packets to feeder events.
+     *
+     * Every packet header goes through the sequencer first: a gap is reported to the handler as a
+     * spl::protocol::feeder::stream::gap before the trades of the packet that revealed it, and the trades of a late
+     * or duplicated packet are dropped. The feed is receive-only, so the outbound requests (subscriptions, pings and
+     * heartbeats) are accepted without writing anything to the group.
+     */
+    template <spl::protocol::common::exchange_id ExchangeIdV>
+    struct transformer {
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::feeder::stream::heartbeat const& input,
+                                      FunctorT&& functor) noexcept -> result<void> {
+            return spl::success();
+        }
+
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::feeder::stream::ping const& input, FunctorT&& functor) noexcept
+            -> result<void> {
+            return spl::success();
+        }
+
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::feeder::stream::pong const& input, FunctorT&& functor) noexcept
+            -> result<void> {
+            return spl::success();
+        }
+
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::feeder::stream::subscribe const& subscribe,
+                                      FunctorT&& functor) noexcept -> spl::result<void> {
+            return spl::success();
+        }
+
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::feeder::stream::unsubscribe const& unsubscribe,
+                                      FunctorT&& functor) noexcept -> spl::result<void> {
+            return spl::success();
+        }
+
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::multicast::header const& input, FunctorT&& functor) noexcept
+            -> spl::result<void> {
+            switch (sequencer_(input.sequence)) {
+                case spl::components::feeder::sequencer::status::in_order:
+                    discarding_ = false;
+                    return spl::success();
+                case spl::components::feeder::sequencer::status::stale:
+                    logger::debug("Multicast feed: dropping stale packet {}", input.sequence);
+                    discarding_ = true;
+                    return spl::success();
+                case spl::components::feeder::sequencer::status::gap: {
+                    discarding_         = false;
+                    auto const& missing = sequencer_.missing();
+                    logger::warn("Multicast feed: packets [{}, {}] lost", missing.first, missing.last);
+                    return functor(spl::protocol::feeder::stream::gap{
+                        .exchange_id = ExchangeIdV,
+                        .first       = missing.first,
+                        .last        = missing.last,
+                        .timestamp   = std::chrono::steady_clock::now().time_since_epoch(),
+                    });
+                }
+            }
+            return spl::success();
+        }
+
+        template <typename FunctorT>
+        [[nodiscard]] auto operator()(spl::protocol::multicast::trade const& input, FunctorT&& functor) noexcept
+            -> spl::result<void> {
+            if (discarding_) [[unlikely]] {
+                return spl::success();
+            }
+
+            auto const instrument_id = spl::protocol::multicast::to_view(input.instrument_id);
+            auto const trade_id      = spl::protocol::multicast::to_view(input.trade_id);
+            return functor(spl::protocol::feeder::trade::trade_summary{
+                .instrument_id = spl::protocol::common::instrument_id(instrument_id),
+                .exchange_id   = input.exchange_id,
+                .trade_id      = spl::protocol::common::trade_id(trade_id),
+                .side          = input.side,
+                .price         = spl::types::price::from_shifted(input.price),
+                .quantity      = spl::types::quantity::from_shifted(input.quantity),
+                .condition     = input.condition,
+                .sequence      = spl::protocol::common::sequence(input.sequence),
+                .timestamp     = spl::protocol::common::timestamp(input.timestamp),
+            });
+        }
+
+        template <typename RandomT, typename FunctorT>
+        [[nodiscard]] constexpr auto operator()(RandomT const& snapshot, FunctorT&& functor) noexcept {
+            return std::invoke(std::forward<FunctorT>(functor), snapshot);
+        }
+
+        [[nodiscard]] constexpr auto sequencer() const noexcept -> spl::components::feeder::sequencer const& {
+            return sequencer_;
+        }
+
+    private:
+        spl::components::feeder::sequencer sequencer_{};
+        bool discarding_{false};
+    };
+
+} // namespace spl::exchange::multicast::feeder
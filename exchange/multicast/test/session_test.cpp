@@ -0,0 +1,93 @@
+#include "spl/exchange/multicast/feeder/session.hpp"
+#include "spl/exchange/multicast/feeder/transformer.hpp"
+#include "spl/protocol/multicast/encoder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/asio/ip/multicast.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <array>
+#include <vector>
+
+using sandbox = spl::exchange::multicast::feeder::session<spl::protocol::common::exchange_id::bybit,
+                                                          spl::exchange::common::environment::sandbox>;
+
+namespace {
+
+    auto publish(spl::network::context& context, std::span<std::uint64_t const> sequences) -> void {
+        using connector_type = sandbox::connector_type;
+        auto const [host, port, path] = connector_type{}().value();
+
+        auto publisher = boost::asio::ip::udp::socket{context, boost::asio::ip::udp::v4()};
+        publisher.set_option(boost::asio::ip::multicast::outbound_interface(boost::asio::ip::address_v4::loopback()));
+        publisher.set_option(boost::asio::ip::multicast::enable_loopback(true));
+        auto const group = boost::asio::ip::make_address(host);
+        auto endpoint    = boost::asio::ip::udp::endpoint{group, static_cast<std::uint16_t>(std::stoi(port))};
+
+        auto buffer = std::array<char, 512>{};
+        for (auto const sequence : sequences) {
+            auto trade        = spl::protocol::multicast::trade{};
+            trade.sequence    = sequence;
+            trade.price       = spl::types::price::from(100.5).shifted();
+            trade.quantity    = spl::types::quantity::from(0.25).shifted();
+            trade.exchange_id = spl::protocol::common::exchange_id::bybit;
+            spl::protocol::multicast::to_field("BTCUSDT", trade.instrument_id);
+            spl::protocol::multicast::to_field(std::to_string(sequence), trade.trade_id);
+
+            auto const trades = std::array{trade};
+            auto const bytes  = spl::protocol::multicast::encoder{}(sequence, 0, std::span(std::as_const(trades)),
+                                                                    std::span<char>(buffer));
+            publisher.send_to(boost::asio::buffer(buffer.data(), bytes.value()), endpoint);
+        }
+    }
+
+} // namespace
+
+TEST(ExchangeMulticastFeederTest, EstablishConnection) {
+    auto context    = spl::network::context();
+    auto identifier = spl::components::feeder::session_id{"client", "multicast"};
+    auto session    = sandbox(context, identifier);
+    auto operation  = session.connect();
+    ASSERT_TRUE(operation) << "Failed to connect: " << operation.error().message().data();
+    ASSERT_TRUE(session.ready());
+}
+
+TEST(ExchangeMulticastFeederTest, ReportsSequenceGap) {
+    auto context    = spl::network::context();
+    auto identifier = spl::components::feeder::session_id{"client", "multicast"};
+    auto session    = sandbox(context, identifier);
+    auto operation  = session.connect();
+    ASSERT_TRUE(operation) << "Failed to connect: " << operation.error().message().data();
+
+    auto const sequences = std::array<std::uint64_t, 5>{1, 2, 5, 2, 6};
+    publish(context, sequences);
+
+    auto trades = std::vector<spl::protocol::feeder::trade::trade_summary>{};
+    auto gaps   = std::vector<spl::protocol::feeder::stream::gap>{};
+
+    auto const now      = std::chrono::steady_clock::now();
+    auto const deadline = now + std::chrono::seconds(2);
+    while (std::size(trades) < 4 and std::chrono::steady_clock::now() < deadline) {
+        auto const operation = session.poll([&]<typename EventT>(EventT&& event) -> spl::result<void> {
+            if constexpr (std::is_same_v<std::decay_t<EventT>, spl::protocol::feeder::trade::trade_summary>) {
+                trades.push_back(event);
+            }
+            if constexpr (std::is_same_v<std::decay_t<EventT>, spl::protocol::feeder::stream::gap>) {
+                gaps.push_back(event);
+            }
+            return spl::success();
+        });
+        ASSERT_TRUE(operation) << "Failed to poll events: " << operation.error().message().data();
+    }
+
+    ASSERT_EQ(std::size(trades), 4);
+    EXPECT_EQ(trades[0].sequence, 1);
+    EXPECT_EQ(trades[2].sequence, 5);
+    EXPECT_EQ(trades[3].sequence, 6);
+    EXPECT_EQ(trades[0].instrument_id, "BTCUSDT");
+    EXPECT_EQ(trades[0].price, spl::types::price::from(100.5));
+    ASSERT_EQ(std::size(gaps), 1);
+    EXPECT_EQ(gaps[0].first, 3);
+    EXPECT_EQ(gaps[0].last, 4);
+}
@@ -0,0 +1,15 @@
+target("exchange-multicast")
+    set_kind("headeronly")
+    add_headerfiles("include/spl/exchange/multicast/**/*.hpp")
+    add_includedirs("include", {public = true})
+    add_deps("components-feeder", "exchange-common", "protocol-multicast", "protocol-feeder", "protocol-common",  {public = true})
+target_end()
+
+
+target("exchange-multicast-test")
+    set_kind("binary")
+    set_group("test")
+    add_files("test/*.cpp")
+    add_deps("exchange-multicast")
+    add_packages("gtest")
+target_end()
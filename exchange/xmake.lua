@@ -1,4 +1,5 @@
 includes("common")
 includes("bybit")
 includes("coinbase")
-includes("factory")
+includes("multicast")
+includes("factory")
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <boost/mp11/algorithm.hpp>
 
 #include <tuple>
+#include <utility>
 #include <variant>
 
 namespace spl { inline namespace meta {
@@ -54,6 +55,14 @@ namespace spl { inline namespace meta {
         return boost::mp11::mp_size<boost::mp11::mp_take<ListT, iter_type>>::value;
     }
 
+    template <template <typename...> class FunctionT, typename ListT>
+    using transformed = boost::mp11::mp_transform<FunctionT, ListT>;
+
+    template <typename ListT, typename FunctionT>
+    constexpr auto for_each(FunctionT&& function) noexcept -> void {
+        boost::mp11::mp_for_each<ListT>(std::forward<FunctionT>(function));
+    }
+
     template <typename ListT>
     using as_tuple = boost::mp11::mp_rename<ListT, std::tuple>;
 
@@ -14,9 +14,33 @@
 #include <vector>
 #include <random>
 #include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
 
 namespace spl::metrics::benchmark {
 
+    /**
+     * @brief How the price of a trade follows from the previous ones.
+     */
+    enum class price_model : std::uint8_t {
+        uniform,        ///< Independent draws in [min_price, max_price], no autocorrelation at all.
+        random_walk,    ///< Gaussian steps of `volatility` around the previous price, reflected at the bounds.
+        mean_reverting, ///< Ornstein-Uhlenbeck walk pulled back to the middle of the bounds by `reversion`.
+        trending,       ///< Walk with a `drift` per trade that turns around at the bounds: long monotonic runs.
+        flash_crash,    ///< Random walk that drops by `crash_depth` and recovers over `crash_length` of the trades.
+    };
+
+    /**
+     * @brief How the trades are spread in time around `events_per_second`.
+     */
+    enum class arrival_model : std::uint8_t {
+        uniform, ///< Intervals drawn uniformly within ±20% of the mean interval.
+        poisson, ///< Exponential intervals: independent arrivals, occasional clusters and gaps.
+        hawkes,  ///< Self-exciting arrivals: every trade raises the intensity, producing bursts of trades.
+    };
+
     class trade_generator {
     public:
         struct config {
@@ -29,6 +53,35 @@ namespace spl::metrics::benchmark {
             std::chrono::milliseconds max_time_increment{500};
             spl::protocol::common::exchange_id exchange = spl::protocol::common::exchange_id::bybit;
             spl::protocol::common::instrument_id instrument{1};
+
+            // Price regime, the defaults reproduce independent uniform prices
+            price_model prices  = price_model::uniform;
+            double volatility   = 0.001;  // Standard deviation of a step, relative to the middle price
+            double reversion    = 0.05;   // Fraction of the distance to the middle price recovered per trade
+            double drift        = 0.0001; // Step per trade of a trend, relative to the middle price
+            double crash_depth  = 0.3;    // Relative drop at the bottom of the crash
+            double crash_start  = 0.5;    // Position of the crash, as a fraction of the trades
+            double crash_length = 0.05;   // Duration of the drop and recovery, as a fraction of the trades
+
+            // Price clustering, disabled by default
+            double tick_size         = 0.0; // Prices are rounded to a multiple of the tick when positive
+            double repeat_likelihood = 0.0; // Probability of a trade printing at the previous price
+
+            // Aggressor sides, even by default
+            double buy_ratio = 0.5; // Probability of a trade being bought by the aggressor
+
+            // Quantities, all of 1 by default
+            double min_quantity = 1.0;
+            double max_quantity = 1.0; // Quantities are drawn uniformly in [min_quantity, max_quantity] when wider
+
+            // Arrival regime, the defaults reproduce uniform jitter around the mean interval
+            arrival_model arrivals = arrival_model::uniform;
+            double excitation      = 0.7;  // Branching ratio of the Hawkes process, trades caused by every trade
+            double decay           = 50.0; // Decay rate of the excitation of a trade, per second
+
+            // Out-of-order timestamps, disabled by default
+            double disorder_likelihood = 0.0; // Probability of a trade being stamped earlier than the previous one
+            std::chrono::milliseconds max_disorder{50};
         };
 
         explicit trade_generator(config const& cfg) : config_{cfg}, rng_{cfg.seed} {}
@@ -37,37 +90,30 @@ namespace spl::metrics::benchmark {
             auto trades = std::vector<spl::protocol::feeder::trade::trade_summary>{};
             trades.reserve(config_.count);
 
-            auto price_dist = std::uniform_real_distribution<double>{config_.min_price, config_.max_price};
-            auto side_dist  = std::uniform_int_distribution<int>{0, 1};
-
-            // Calculate average interval based on events per second
-            auto const avg_interval_ns = static_cast<std::int64_t>(1'000'000'000.0 / config_.events_per_second);
-
-            // Add some variance around the average interval (±20%)
-            auto const min_interval_ns = static_cast<std::int64_t>(avg_interval_ns * 0.8);
-            auto const max_interval_ns = static_cast<std::int64_t>(avg_interval_ns * 1.2);
-            auto interval_dist         = std::uniform_int_distribution<std::int64_t>{min_interval_ns, max_interval_ns};
+            walk_       = (config_.min_price + config_.max_price) / 2.0;
+            direction_  = 1.0;
+            intensity_  = 0.0;
+            last_price_ = walk_;
 
             auto current_time = std::chrono::steady_clock::now().time_since_epoch();
 
             for (std::size_t i = 0; i < config_.count; ++i) {
-                auto const price       = price_dist(rng_);
-                auto const interval_ns = interval_dist(rng_);
-                current_time += std::chrono::nanoseconds{interval_ns};
+                auto const price = next_price(i);
+                current_time += next_interval();
 
-                auto const side = side_dist(rng_) == 0 ? spl::protocol::common::aggressor_side::buy
-                                                       : spl::protocol::common::aggressor_side::sell;
+                auto const side     = next_side();
+                auto const quantity = next_quantity();
 
                 trades.emplace_back(spl::protocol::feeder::trade::trade_summary{
                     .instrument_id = config_.instrument,
                     .exchange_id   = config_.exchange,
-                    .trade_id      = spl::protocol::common::trade_id{static_cast<char>(i)},
+                    .trade_id      = spl::protocol::common::trade_id{std::to_string(i)},
                     .side          = side,
                     .price         = spl::protocol::common::price::from(price),
-                    .quantity      = spl::protocol::common::quantity::from(1.0),
+                    .quantity      = spl::protocol::common::quantity::from(quantity),
                     .condition     = spl::protocol::common::trade_condition{},
                     .sequence      = spl::protocol::common::sequence{i},
-                    .timestamp     = spl::protocol::common::timestamp{current_time}});
+                    .timestamp     = spl::protocol::common::timestamp{current_time - next_lag()}});
             }
 
             return trades;
@@ -78,8 +124,135 @@ namespace spl::metrics::benchmark {
         }
 
     private:
+        [[nodiscard]] auto next_price(std::size_t index) -> double {
+            if (config_.repeat_likelihood > 0.0 and index != 0 and
+                std::bernoulli_distribution{config_.repeat_likelihood}(rng_)) {
+                return last_price_;
+            }
+
+            auto const middle = (config_.min_price + config_.max_price) / 2.0;
+            auto const step   = config_.volatility * middle;
+            auto price        = walk_;
+            switch (config_.prices) {
+                case price_model::uniform:
+                    price = std::uniform_real_distribution<double>{config_.min_price, config_.max_price}(rng_);
+                    break;
+                case price_model::random_walk:
+                case price_model::flash_crash:
+                    walk_ = reflect(walk_ + step * std::normal_distribution<double>{}(rng_));
+                    price = walk_ * (1.0 - config_.crash_depth * crash(index));
+                    break;
+                case price_model::mean_reverting:
+                    walk_ += config_.reversion * (middle - walk_) + step * std::normal_distribution<double>{}(rng_);
+                    walk_ = reflect(walk_);
+                    price = walk_;
+                    break;
+                case price_model::trending:
+                    walk_ += direction_ * config_.drift * middle + step * std::normal_distribution<double>{}(rng_);
+                    if (walk_ > config_.max_price or walk_ < config_.min_price) {
+                        direction_ = -direction_;
+                    }
+                    walk_ = reflect(walk_);
+                    price = walk_;
+                    break;
+            }
+
+            if (config_.tick_size > 0.0) {
+                price = std::max(config_.tick_size, std::round(price / config_.tick_size) * config_.tick_size);
+            }
+            last_price_ = price;
+            return price;
+        }
+
+        [[nodiscard]] auto next_side() -> spl::protocol::common::aggressor_side {
+            // An even split keeps drawing a fair integer, so that the default trades stay the same
+            auto const buy = config_.buy_ratio == 0.5 ? std::uniform_int_distribution<int>{0, 1}(rng_) == 0
+                                                      : std::bernoulli_distribution{config_.buy_ratio}(rng_);
+            return buy ? spl::protocol::common::aggressor_side::buy : spl::protocol::common::aggressor_side::sell;
+        }
+
+        [[nodiscard]] auto next_quantity() -> double {
+            if (config_.max_quantity <= config_.min_quantity) {
+                return config_.min_quantity;
+            }
+            return std::uniform_real_distribution<double>{config_.min_quantity, config_.max_quantity}(rng_);
+        }
+
+        [[nodiscard]] auto next_interval() -> std::chrono::nanoseconds {
+            // Calculate average interval based on events per second
+            auto const avg_interval_ns = 1'000'000'000.0 / config_.events_per_second;
+            switch (config_.arrivals) {
+                case arrival_model::poisson: {
+                    auto const interval = std::exponential_distribution<double>{1.0}(rng_) * avg_interval_ns;
+                    return std::chrono::nanoseconds{static_cast<std::int64_t>(interval)};
+                }
+                case arrival_model::hawkes: {
+                    // Ogata thinning: candidates are drawn at the current (decaying) intensity, the baseline is
+                    // scaled down by the branching ratio so the mean rate stays at events_per_second
+                    auto const excitation = std::clamp(config_.excitation, 0.0, 0.99);
+                    auto const baseline   = config_.events_per_second * (1.0 - excitation);
+                    auto elapsed          = 0.0;
+                    while (true) {
+                        auto const bound = baseline + intensity_;
+                        auto const wait  = std::exponential_distribution<double>{bound}(rng_);
+                        elapsed += wait;
+                        intensity_ *= std::exp(-config_.decay * wait);
+                        if (std::uniform_real_distribution<double>{0.0, bound}(rng_) <= baseline + intensity_) {
+                            break;
+                        }
+                    }
+                    intensity_ += excitation * config_.decay;
+                    return std::chrono::nanoseconds{static_cast<std::int64_t>(elapsed * 1'000'000'000.0)};
+                }
+                default: {
+                    // Add some variance around the average interval (±20%)
+                    auto const average      = static_cast<std::int64_t>(avg_interval_ns);
+                    auto const min_interval = static_cast<std::int64_t>(average * 0.8);
+                    auto const max_interval = static_cast<std::int64_t>(average * 1.2);
+                    return std::chrono::nanoseconds{
+                        std::uniform_int_distribution<std::int64_t>{min_interval, max_interval}(rng_)};
+                }
+            }
+        }
+
+        [[nodiscard]] auto next_lag() -> std::chrono::nanoseconds {
+            if (config_.disorder_likelihood <= 0.0 or
+                not std::bernoulli_distribution{config_.disorder_likelihood}(rng_)) {
+                return std::chrono::nanoseconds::zero();
+            }
+            auto const max_lag = std::chrono::duration_cast<std::chrono::nanoseconds>(config_.max_disorder).count();
+            return std::chrono::nanoseconds{std::uniform_int_distribution<std::int64_t>{0, max_lag}(rng_)};
+        }
+
+        [[nodiscard]] auto reflect(double price) const noexcept -> double {
+            if (price > config_.max_price) {
+                return std::max(config_.min_price, 2.0 * config_.max_price - price);
+            }
+            if (price < config_.min_price) {
+                return std::min(config_.max_price, 2.0 * config_.min_price - price);
+            }
+            return price;
+        }
+
+        // Triangular profile of the crash: 0 outside, rising to 1 at its bottom and back to 0 once recovered
+        [[nodiscard]] auto crash(std::size_t index) const noexcept -> double {
+            if (config_.prices != price_model::flash_crash or config_.crash_length <= 0.0) {
+                return 0.0;
+            }
+            auto const position = static_cast<double>(index) / static_cast<double>(config_.count);
+            auto const progress = (position - config_.crash_start) / config_.crash_length;
+            if (progress < 0.0 or progress >= 1.0) {
+                return 0.0;
+            }
+            return progress < 0.5 ? 2.0 * progress : 2.0 * (1.0 - progress);
+        }
+
         config config_;
         std::mt19937 rng_;
+        double walk_{0.0};       ///< Underlying price of the walks, before the crash and the clustering.
+        double direction_{1.0};  ///< Sign of the drift of a trend.
+        double intensity_{0.0};  ///< Excitation left by the previous trades of a Hawkes process, per second.
+        double last_price_{0.0}; ///< Price of the previous trade, repeated by the clustering.
     };
 
     // Predefined benchmark configurations with different event rates
@@ -117,6 +290,58 @@ namespace spl::metrics::benchmark {
         }
     } // namespace configs
 
+    // Price and arrival regimes applied on top of a rate configuration, to benchmark the worst cases of the metrics
+    namespace regimes {
+        inline auto random_walk(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices = price_model::random_walk;
+            return config;
+        }
+
+        inline auto mean_reverting(trade_generator::config config = configs::high_frequency())
+            -> trade_generator::config {
+            config.prices = price_model::mean_reverting;
+            return config;
+        }
+
+        inline auto trending(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices     = price_model::trending;
+            config.volatility = 0.00002;
+            return config;
+        }
+
+        inline auto flash_crash(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices = price_model::flash_crash;
+            return config;
+        }
+
+        inline auto poisson(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices   = price_model::random_walk;
+            config.arrivals = arrival_model::poisson;
+            return config;
+        }
+
+        inline auto bursty(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices   = price_model::random_walk;
+            config.arrivals = arrival_model::hawkes;
+            return config;
+        }
+
+        // Prices on a coarse tick with frequent repeated prints, as in a quiet book
+        inline auto clustered(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices            = price_model::random_walk;
+            config.tick_size         = 0.5;
+            config.repeat_likelihood = 0.6;
+            return config;
+        }
+
+        // Timestamps of some trades behind the previous ones, as when merging venues or late prints
+        inline auto disordered(trade_generator::config config = configs::high_frequency()) -> trade_generator::config {
+            config.prices              = price_model::random_walk;
+            config.disorder_likelihood = 0.05;
+            return config;
+        }
+    } // namespace regimes
+
     // Window configurations for benchmarking
     namespace windows {
         constexpr auto short_term     = std::chrono::seconds{10};
@@ -0,0 +1,120 @@
+#include "generator.hpp"
+
+#include "spl/components/telemetry/clock.hpp"
+#include "spl/components/telemetry/histogram.hpp"
+#include "spl/container/ring.hpp"
+#include "spl/core/allocation.hpp"
+#include "spl/metrics/scan/multimeter.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+using trade_summary    = spl::protocol::feeder::trade::trade_summary;
+using ScanMultimeter   = spl::metrics::scan::multimeter<trade_summary>;
+using StreamMultimeter = spl::metrics::stream::multimeter<trade_summary>;
+using RingMultimeter   = spl::metrics::stream::multimeter<trade_summary, spl::container::ring>;
+using histogram_type   = spl::components::telemetry::histogram<>;
+using clock_type       = spl::components::telemetry::clock;
+
+// Configuration
+namespace {
+    constexpr std::size_t FIXED_TRADES = 20000;
+    constexpr std::uint32_t SEED       = 42;
+} // namespace
+
+// Allocation hook: every operator new of the thread is counted, each call is attributed the difference around it
+SPL_ALLOCATION_HOOK()
+
+// Trade generator: uniform prices and arrivals around the given rate
+static std::vector<trade_summary> generate_trades(double events_per_second) {
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.seed              = SEED;
+    config.count             = FIXED_TRADES;
+    config.min_price         = 95.0;
+    config.max_price         = 105.0;
+    config.events_per_second = events_per_second;
+    return spl::metrics::benchmark::trade_generator{config}.generate();
+}
+
+// Times every call of a fresh multimeter per iteration, then reports the percentiles of a single call in nanoseconds
+// and the allocations per call. The two counter reads around a call add a few nanoseconds to every sample.
+template <typename MultimeterT>
+static void run(benchmark::State& state) {
+    auto const event_rate      = static_cast<double>(state.range(0));
+    auto const window_duration = std::chrono::seconds{state.range(1)};
+    auto const trades          = generate_trades(event_rate);
+    auto const latencies       = std::make_unique<histogram_type>();
+
+    // Calibrates the counter now, so that the first sample does not pay for it
+    std::ignore = clock_type::nanoseconds(0);
+
+    auto tracker     = spl::allocation::tracker{};
+    auto calls       = std::size_t{0};
+    auto allocating  = std::size_t{0};
+    auto total_count = std::size_t{0};
+    auto total_bytes = std::size_t{0};
+    for (auto _ : state) {
+        auto multimeter = MultimeterT{window_duration};
+
+        for (auto const& trade : trades) {
+            tracker.reset();
+            auto const start = clock_type::now();
+            auto result      = multimeter(trade);
+            auto const stop  = clock_type::now();
+            benchmark::DoNotOptimize(result);
+
+            auto const delta = tracker.allocations();
+            latencies->record(clock_type::nanoseconds(stop - start));
+            allocating += delta != 0;
+            total_count += delta;
+            total_bytes += tracker.bytes();
+            ++calls;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * FIXED_TRADES);
+    state.counters["events_per_sec"]    = event_rate;
+    state.counters["window_size_sec"]   = state.range(1);
+    state.counters["p50_ns"]            = static_cast<double>(latencies->percentile(0.50));
+    state.counters["p99_ns"]            = static_cast<double>(latencies->percentile(0.99));
+    state.counters["p999_ns"]           = static_cast<double>(latencies->percentile(0.999));
+    state.counters["max_ns"]            = static_cast<double>(latencies->maximum());
+    state.counters["allocs_per_event"]  = static_cast<double>(total_count) / static_cast<double>(calls);
+    state.counters["bytes_per_event"]   = static_cast<double>(total_bytes) / static_cast<double>(calls);
+    state.counters["allocating_events"] = static_cast<double>(allocating) / static_cast<double>(calls);
+}
+
+// Scan multimeter tail latency
+static void BM_ScanMultimeterLatency(benchmark::State& state) {
+    run<ScanMultimeter>(state);
+}
+
+// Stream multimeter tail latency
+static void BM_StreamMultimeterLatency(benchmark::State& state) {
+    run<StreamMultimeter>(state);
+}
+
+// Stream multimeter over spl::container::ring tail latency, which stops allocating once the window is full
+static void BM_StreamMultimeterRingLatency(benchmark::State& state) {
+    run<RingMultimeter>(state);
+}
+
+// Benchmark registrations: Args(event_rate, window_seconds), the same grid as multimeter_benchmark
+BENCHMARK(BM_ScanMultimeterLatency)
+    ->ArgsProduct({{1, 10, 1000}, {1, 10, 60, 180, 300}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterLatency)
+    ->ArgsProduct({{1, 10, 1000}, {1, 10, 60, 180, 300}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterRingLatency)
+    ->ArgsProduct({{1, 10, 1000}, {1, 10, 60, 180, 300}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -1,77 +1,92 @@
+#include "generator.hpp"
+
 #include "spl/metrics/scan/multimeter.hpp"
+#include "spl/metrics/sketch/multimeter.hpp"
+#include "spl/metrics/stream/horizons.hpp"
 #include "spl/metrics/stream/multimeter.hpp"
 #include "spl/protocol/feeder/trade/trade_summary.hpp"
-#include "spl/protocol/common/exchange_id.hpp"
-#include "spl/protocol/common/instrument_id.hpp"
-#include "spl/protocol/common/trade_id.hpp"
-#include "spl/protocol/common/aggressor_side.hpp"
-#include "spl/protocol/common/price.hpp"
-#include "spl/protocol/common/quantity.hpp"
-#include "spl/protocol/common/trade_condition.hpp"
-#include "spl/protocol/common/sequence.hpp"
-#include "spl/protocol/common/timestamp.hpp"
 
 #include <benchmark/benchmark.h>
+#include <array>
 #include <vector>
 #include <chrono>
-#include <random>
+#include <deque>
+#include <string_view>
 
 using trade_summary    = spl::protocol::feeder::trade::trade_summary;
 using ScanMultimeter   = spl::metrics::scan::multimeter<trade_summary>;
 using StreamMultimeter = spl::metrics::stream::multimeter<trade_summary>;
+using SketchMultimeter = spl::metrics::sketch::multimeter<trade_summary>;
+using StreamAll        = spl::metrics::stream::multimeter<trade_summary, std::deque,
+                                                          spl::metrics::internal::timeline_predicate,
+                                                          spl::metrics::policy::all>;
+using StreamExtrema    = spl::metrics::stream::multimeter<
+    trade_summary, std::deque, spl::metrics::internal::timeline_predicate,
+    spl::meta::list<spl::metrics::policy::minimum, spl::metrics::policy::maximum>>;
+using StreamSliding    = spl::metrics::stream::multimeter<
+    trade_summary, std::deque, spl::metrics::internal::timeline_predicate,
+    spl::meta::list<spl::metrics::policy::sliding_minimum, spl::metrics::policy::sliding_maximum>>;
+using StreamAggregates = spl::metrics::stream::multimeter<
+    trade_summary, std::deque, spl::metrics::internal::timeline_predicate,
+    spl::meta::list<spl::metrics::policy::ohlc, spl::metrics::policy::sides>>;
+using StreamCapped     = spl::metrics::stream::multimeter<trade_summary, std::deque,
+                                                          spl::metrics::internal::timeline_predicate,
+                                                          spl::metrics::policy::price, spl::metrics::window::capped>;
 
 // Configuration
 namespace {
     constexpr std::size_t FIXED_TRADES = 20000;
     constexpr std::uint32_t SEED       = 42;
+    constexpr double REGIME_RATE       = 1000.0;
+    constexpr std::size_t WINDOW_CAP   = 1024;
+    constexpr std::size_t SAMPLE_EVERY = 100;
+
+    struct regime {
+        std::string_view name;
+        spl::metrics::benchmark::trade_generator::config (*config)(spl::metrics::benchmark::trade_generator::config);
+    };
+
+    // Price and arrival regimes swept by the regime benchmarks, indexed by their first argument
+    constexpr auto REGIMES = std::array{
+        regime{"uniform", [](auto config) { return config; }},
+        regime{"random_walk", spl::metrics::benchmark::regimes::random_walk},
+        regime{"mean_reverting", spl::metrics::benchmark::regimes::mean_reverting},
+        regime{"trending", spl::metrics::benchmark::regimes::trending},
+        regime{"flash_crash", spl::metrics::benchmark::regimes::flash_crash},
+        regime{"poisson", spl::metrics::benchmark::regimes::poisson},
+        regime{"bursty", spl::metrics::benchmark::regimes::bursty},
+        regime{"clustered", spl::metrics::benchmark::regimes::clustered},
+        regime{"disordered", spl::metrics::benchmark::regimes::disordered},
+    };
 } // namespace
 
-// Trade generator
+// Trade generator: uniform prices and arrivals around the given rate
 static std::vector<trade_summary> generate_trades(double events_per_second) {
-    auto trades = std::vector<trade_summary>{};
-    trades.reserve(FIXED_TRADES);
-
-    auto rng        = std::mt19937{SEED};
-    auto price_dist = std::uniform_real_distribution<double>{95.0, 105.0};
-    auto side_dist  = std::uniform_int_distribution<int>{0, 1};
-
-    auto const avg_interval_ns = static_cast<std::int64_t>(1'000'000'000.0 / events_per_second);
-    auto const min_interval_ns = static_cast<std::int64_t>(avg_interval_ns * 0.8);
-    auto const max_interval_ns = static_cast<std::int64_t>(avg_interval_ns * 1.2);
-    auto interval_dist         = std::uniform_int_distribution<std::int64_t>{min_interval_ns, max_interval_ns};
-
-    auto current_time = std::chrono::steady_clock::now().time_since_epoch();
-
-    for (std::size_t i = 0; i < FIXED_TRADES; ++i) {
-        auto const price       = price_dist(rng);
-        auto const interval_ns = interval_dist(rng);
-        current_time += std::chrono::nanoseconds{interval_ns};
-
-        auto const side = side_dist(rng) == 0 ? spl::protocol::common::aggressor_side::buy
-                                              : spl::protocol::common::aggressor_side::sell;
-
-        trades.emplace_back(trade_summary{.instrument_id = spl::protocol::common::instrument_id{1},
-                                          .exchange_id   = spl::protocol::common::exchange_id::bybit,
-                                          .trade_id      = spl::protocol::common::trade_id{static_cast<char>(i)},
-                                          .side          = side,
-                                          .price         = spl::protocol::common::price::from(price),
-                                          .quantity      = spl::protocol::common::quantity::from(1.0),
-                                          .condition     = spl::protocol::common::trade_condition{},
-                                          .sequence      = spl::protocol::common::sequence{i},
-                                          .timestamp     = spl::protocol::common::timestamp{current_time}});
-    }
-
-    return trades;
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.seed              = SEED;
+    config.count             = FIXED_TRADES;
+    config.min_price         = 95.0;
+    config.max_price         = 105.0;
+    config.events_per_second = events_per_second;
+    return spl::metrics::benchmark::trade_generator{config}.generate();
 }
 
-// Scan multimeter benchmark
-static void BM_ScanMultimeter(benchmark::State& state) {
-    auto const event_rate      = static_cast<double>(state.range(0));
-    auto const window_duration = std::chrono::seconds{static_cast<int>(state.range(1))};
-    auto const trades          = generate_trades(event_rate);
+// Trade generator: one of the regimes at REGIME_RATE
+static std::vector<trade_summary> generate_trades(regime const& selected) {
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.seed              = SEED;
+    config.count             = FIXED_TRADES;
+    config.min_price         = 95.0;
+    config.max_price         = 105.0;
+    config.events_per_second = REGIME_RATE;
+    return spl::metrics::benchmark::trade_generator{selected.config(config)}.generate();
+}
 
+// Runs a multimeter over the trades, a fresh one every iteration
+template <typename MultimeterT>
+static void run(benchmark::State& state, std::vector<trade_summary> const& trades, std::chrono::seconds window) {
     for (auto _ : state) {
-        auto multimeter = ScanMultimeter{window_duration};
+        auto multimeter = MultimeterT{window};
 
         for (auto const& trade : trades) {
             auto result = multimeter(trade);
@@ -79,29 +94,145 @@ static void BM_ScanMultimeter(benchmark::State& state) {
         }
     }
 
-    state.SetItemsProcessed(state.iterations() * FIXED_TRADES);
-    state.counters["events_per_sec"]  = event_rate;
-    state.counters["window_size_sec"] = state.range(1);
+    state.SetItemsProcessed(state.iterations() * std::size(trades));
+    state.counters["window_size_sec"] = window.count();
+}
+
+// Scan multimeter benchmark
+static void BM_ScanMultimeter(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<ScanMultimeter>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
 }
 
 // Stream multimeter benchmark
 static void BM_StreamMultimeter(benchmark::State& state) {
-    auto const event_rate      = static_cast<double>(state.range(0));
-    auto const window_duration = std::chrono::seconds{static_cast<int>(state.range(1))};
-    auto const trades          = generate_trades(event_rate);
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<StreamMultimeter>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
+}
+
+// Sketch multimeter benchmark, the same price metrics over rotating buckets instead of the stored trades
+static void BM_SketchMultimeter(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<SketchMultimeter>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
+}
 
+// Stream multimeter benchmark updating on every trade, reading a snapshot every SAMPLE_EVERY trades
+static void BM_StreamMultimeterSampled(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    auto const trades     = generate_trades(event_rate);
     for (auto _ : state) {
-        auto multimeter = StreamMultimeter{window_duration};
+        auto multimeter = StreamMultimeter{std::chrono::seconds{state.range(1)}};
+        for (std::size_t index = 0; index < std::size(trades); ++index) {
+            multimeter.update(trades[index]);
+            if (index % SAMPLE_EVERY == 0) {
+                auto const& result = multimeter.snapshot();
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(trades));
+    state.counters["window_size_sec"] = static_cast<double>(state.range(1));
+    state.counters["events_per_sec"]  = event_rate;
+}
+
+// Stream multimeter benchmark with the flow policies on top of the price ones
+static void BM_StreamMultimeterAllPolicies(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<StreamAll>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
+}
+
+// Stream multimeter benchmark with the minimum and maximum only, i.e. without the median heaps
+static void BM_StreamMultimeterExtrema(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<StreamExtrema>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
+}
+
+// The same extrema over two stacks of aggregates instead of the monotonic deques
+static void BM_StreamMultimeterSlidingExtrema(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<StreamSliding>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
+}
 
+// Stream multimeter benchmark with the OHLC and trades by side, both monoids over a flat_fat
+static void BM_StreamMultimeterAggregates(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    run<StreamAggregates>(state, generate_trades(event_rate), std::chrono::seconds{state.range(1)});
+    state.counters["events_per_sec"] = event_rate;
+}
+
+// Windows published per instrument by the horizon benchmarks
+constexpr auto HORIZONS = std::array<std::chrono::nanoseconds, 4>{
+    std::chrono::seconds{1}, std::chrono::minutes{1}, std::chrono::minutes{5}, std::chrono::minutes{15}};
+
+// One stream multimeter per window, each with its own copy of the trades
+static void BM_StreamMultimeterPerHorizon(benchmark::State& state) {
+    auto const event_rate = static_cast<double>(state.range(0));
+    auto const trades     = generate_trades(event_rate);
+    for (auto _ : state) {
+        auto multimeters = std::array{StreamMultimeter{HORIZONS[0]}, StreamMultimeter{HORIZONS[1]},
+                                      StreamMultimeter{HORIZONS[2]}, StreamMultimeter{HORIZONS[3]}};
         for (auto const& trade : trades) {
-            auto result = multimeter(trade);
+            for (auto& multimeter : multimeters) {
+                auto result = multimeter(trade);
+                benchmark::DoNotOptimize(result);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(trades));
+    state.counters["events_per_sec"] = event_rate;
+}
+
+// The same windows over one shared timeline
+static void BM_StreamHorizons(benchmark::State& state) {
+    using horizons_type   = spl::metrics::stream::horizons<trade_summary, std::size(HORIZONS)>;
+    auto const event_rate = static_cast<double>(state.range(0));
+    auto const trades     = generate_trades(event_rate);
+    for (auto _ : state) {
+        auto horizons = horizons_type{HORIZONS};
+        for (auto const& trade : trades) {
+            auto result = horizons(trade);
             benchmark::DoNotOptimize(result);
         }
     }
+    state.SetItemsProcessed(state.iterations() * std::size(trades));
+    state.counters["events_per_sec"] = event_rate;
+}
 
-    state.SetItemsProcessed(state.iterations() * FIXED_TRADES);
-    state.counters["events_per_sec"]  = event_rate;
-    state.counters["window_size_sec"] = state.range(1);
+// Scan multimeter benchmark under a price and arrival regime
+static void BM_ScanMultimeterRegime(benchmark::State& state) {
+    auto const& regime = REGIMES[static_cast<std::size_t>(state.range(0))];
+    run<ScanMultimeter>(state, generate_trades(regime), std::chrono::seconds{state.range(1)});
+    state.SetLabel(std::string{regime.name});
+}
+
+// Stream multimeter benchmark under a price and arrival regime
+static void BM_StreamMultimeterRegime(benchmark::State& state) {
+    auto const& regime = REGIMES[static_cast<std::size_t>(state.range(0))];
+    run<StreamMultimeter>(state, generate_trades(regime), std::chrono::seconds{state.range(1)});
+    state.SetLabel(std::string{regime.name});
+}
+
+// Stream multimeter benchmark under a regime, over a time window that never keeps more than WINDOW_CAP trades
+static void BM_StreamMultimeterCappedRegime(benchmark::State& state) {
+    auto const& regime = REGIMES[static_cast<std::size_t>(state.range(0))];
+    auto const trades  = generate_trades(regime);
+    auto const window  = spl::metrics::window::capped{std::chrono::seconds{state.range(1)}, WINDOW_CAP};
+    for (auto _ : state) {
+        auto multimeter = StreamCapped{window};
+        for (auto const& trade : trades) {
+            auto result = multimeter(trade);
+            benchmark::DoNotOptimize(result);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * std::size(trades));
+    state.counters["window_size_sec"] = static_cast<double>(state.range(1));
+    state.SetLabel(std::string{regime.name});
 }
 
 // Benchmark registrations: Args(event_rate, window_seconds)
@@ -141,4 +272,42 @@ BENCHMARK(BM_StreamMultimeter)
     ->Args({1000, 300})
     ->Unit(benchmark::kMicrosecond);
 
+BENCHMARK(BM_StreamMultimeterSampled)->ArgsProduct({{10, 1000}, {10, 60}})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_SketchMultimeter)->ArgsProduct({{10, 1000}, {10, 60}})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterAllPolicies)
+    ->ArgsProduct({{10, 1000}, {10, 60}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterExtrema)
+    ->ArgsProduct({{10, 1000}, {10, 60}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterSlidingExtrema)
+    ->ArgsProduct({{10, 1000}, {10, 60}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterAggregates)
+    ->ArgsProduct({{10, 1000}, {10, 60}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Benchmark registrations: Args(event_rate), over the 1s, 1m, 5m and 15m windows
+BENCHMARK(BM_StreamMultimeterPerHorizon)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamHorizons)->Arg(10)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
+// Benchmark registrations: Args(regime, window_seconds), the slowest regime is the throughput to plan for
+BENCHMARK(BM_ScanMultimeterRegime)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, std::size(REGIMES) - 1, 1), {10}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterRegime)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, std::size(REGIMES) - 1, 1), {10, 60}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_StreamMultimeterCappedRegime)
+    ->ArgsProduct({benchmark::CreateDenseRange(0, std::size(REGIMES) - 1, 1), {10, 60}})
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
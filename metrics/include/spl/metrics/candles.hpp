@@ -0,0 +1,194 @@
+#pragma once
+
+#include "spl/metrics/timeline.hpp"
+#include "spl/result/contract.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <utility>
+
+namespace spl::metrics {
+
+    /**
+     * @brief Builds the OHLCV candles of one instrument over IntervalsV intervals at once, e.g. 1 s, 1 m, 1 h and 1 d.
+     * Candles are aligned to the epoch, so a daily candle starts at midnight UTC.
+     *
+     * Trades only update the candle of the finest interval. A coarser candle rolls up the closed candles of the finest
+     * interval, and merges the open one into its partial updates, so every interval keeps O(1) state whatever its
+     * length. Every trade emits a partial update (complete = false) per interval, after a complete one (complete =
+     * true) for every candle it closes. Intervals without trades emit no candle.
+     *
+     * @tparam ObjectT The trade type (must have .instrument_id, .exchange_id, .price, .quantity and .sequence)
+     * @tparam CandleT The candle type, e.g. spl::protocol::feeder::candlestick::candlestick
+     * @tparam IntervalsV Number of intervals
+     * @tparam PredicateT Predicate to extract the timestamp from ObjectT
+     *
+     * @par Complexity
+     * - Update: O(IntervalsV)
+     * - Memory: one candle per interval
+     */
+    template <typename ObjectT, typename CandleT, std::size_t IntervalsV,
+              typename PredicateT = internal::timeline_predicate>
+    struct candles {
+        static_assert(IntervalsV > 0, "spl::metrics::candles needs at least one interval");
+
+        using duration_type  = std::chrono::nanoseconds;
+        using intervals_type = std::array<duration_type, IntervalsV>;
+        using candle_type    = CandleT;
+
+        /**
+         * @brief The intervals go from the finest to the coarsest, and each one is a multiple of the finest.
+         */
+        constexpr explicit candles(intervals_type const& intervals) noexcept {
+            for (std::size_t index = 0; index < IntervalsV; ++index) {
+                spl::expects(intervals[index] > duration_type::zero(), "Candle intervals must be positive");
+                spl::expects(intervals[index] % intervals.front() == duration_type::zero(),
+                             "Candle intervals must be multiples of the finest one");
+                spl::expects(index == 0 or intervals[index - 1] < intervals[index],
+                             "Candle intervals must be sorted from the finest to the coarsest");
+                buckets_[index].interval = intervals[index];
+            }
+        }
+
+        [[nodiscard]] constexpr static auto size() noexcept -> std::size_t {
+            return IntervalsV;
+        }
+
+        /**
+         * @brief Adds the trade to the open candles, emitting to the callback the candles it closes and then the
+         * partial candle of every interval. Late trades are added to the open candles.
+         */
+        template <typename CallbackT>
+        constexpr auto operator()(ObjectT const& trade, CallbackT&& callback) noexcept -> void {
+            auto const timestamp = PredicateT{}(trade);
+            close(timestamp, callback);
+
+            auto& finest = buckets_.front();
+            if (not finest.active) {
+                open(finest, trade, timestamp);
+            } else {
+                finest.candle.high  = std::max(finest.candle.high, trade.price);
+                finest.candle.low   = std::min(finest.candle.low, trade.price);
+                finest.candle.close = trade.price;
+                finest.candle.volume += trade.quantity;
+                finest.candle.trades += 1;
+                finest.candle.sequence  = trade.sequence;
+                finest.candle.timestamp = timestamp;
+            }
+
+            callback(std::as_const(finest.candle));
+            for (std::size_t index = 1; index < IntervalsV; ++index) {
+                callback(std::as_const(partial(buckets_[index], finest.candle)));
+            }
+        }
+
+        /**
+         * @brief Emits to the callback the candles ending at or before the timestamp, e.g. from a timer when no
+         * trade arrives to close them.
+         */
+        template <typename CallbackT>
+        constexpr auto close(duration_type timestamp, CallbackT&& callback) noexcept -> void {
+            auto& finest = buckets_.front();
+            if (finest.active and timestamp >= finest.candle.ending) {
+                finest.active          = false;
+                finest.candle.complete = true;
+                callback(std::as_const(finest.candle));
+                for (std::size_t index = 1; index < IntervalsV; ++index) {
+                    roll(buckets_[index], finest.candle, callback);
+                }
+            }
+
+            for (std::size_t index = 1; index < IntervalsV; ++index) {
+                if (auto& bucket = buckets_[index]; bucket.active and timestamp >= bucket.candle.ending) {
+                    bucket.active          = false;
+                    bucket.candle.complete = true;
+                    callback(std::as_const(bucket.candle));
+                }
+            }
+        }
+
+    private:
+        struct bucket {
+            duration_type interval{}; ///< Length of the candles.
+            bool active{false};       ///< Whether the candle below is open.
+            CandleT candle{};         ///< Open candle, or for a coarser interval the closed finest candles it holds.
+            CandleT merged{};         ///< Partial candle of a coarser interval, including the open finest candle.
+        };
+
+        [[nodiscard]] constexpr static auto start(duration_type timestamp, duration_type interval) noexcept
+            -> duration_type {
+            auto const remainder = timestamp % interval;
+            return timestamp - (remainder < duration_type::zero() ? remainder + interval : remainder);
+        }
+
+        constexpr static auto open(bucket& target, ObjectT const& trade, duration_type timestamp) noexcept -> void {
+            auto const starting = start(timestamp, target.interval);
+            target.active       = true;
+            target.candle       = CandleT{
+                .instrument_id = trade.instrument_id,
+                .exchange_id   = trade.exchange_id,
+                .open          = trade.price,
+                .high          = trade.price,
+                .low           = trade.price,
+                .close         = trade.price,
+                .volume        = trade.quantity,
+                .trades        = 1,
+                .complete      = false,
+                .starting      = starting,
+                .ending        = starting + target.interval,
+                .sequence      = trade.sequence,
+                .timestamp     = timestamp,
+            };
+        }
+
+        /**
+         * @brief Adds a closed finest candle to a coarser one, emitting the latter first if the finest one is past it.
+         */
+        template <typename CallbackT>
+        constexpr static auto roll(bucket& target, CandleT const& finest, CallbackT& callback) noexcept -> void {
+            if (target.active and finest.starting >= target.candle.ending) {
+                target.active          = false;
+                target.candle.complete = true;
+                callback(std::as_const(target.candle));
+            }
+            if (not target.active) {
+                auto const starting    = start(finest.starting, target.interval);
+                target.active          = true;
+                target.candle          = finest;
+                target.candle.complete = false;
+                target.candle.starting = starting;
+                target.candle.ending   = starting + target.interval;
+                return;
+            }
+            merge(target.candle, finest);
+        }
+
+        [[nodiscard]] constexpr static auto partial(bucket& target, CandleT const& finest) noexcept -> CandleT const& {
+            if (not target.active) {
+                auto const starting    = start(finest.starting, target.interval);
+                target.merged          = finest;
+                target.merged.starting = starting;
+                target.merged.ending   = starting + target.interval;
+                return target.merged;
+            }
+            target.merged = target.candle;
+            merge(target.merged, finest);
+            return target.merged;
+        }
+
+        constexpr static auto merge(CandleT& target, CandleT const& candle) noexcept -> void {
+            target.high  = std::max(target.high, candle.high);
+            target.low   = std::min(target.low, candle.low);
+            target.close = candle.close;
+            target.volume += candle.volume;
+            target.trades += candle.trades;
+            target.sequence  = candle.sequence;
+            target.timestamp = candle.timestamp;
+        }
+
+        std::array<bucket, IntervalsV> buckets_{}; ///< Candles of every interval, the finest first.
+    };
+
+} // namespace spl::metrics
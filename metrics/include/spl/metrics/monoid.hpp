@@ -0,0 +1,101 @@
+#pragma once
+
+#include "spl/types/price.hpp"
+#include "spl/types/quantity.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * @brief Monoids the stream::aggregate metric computes over a window, see spl::concepts::monoid_of. Each one lifts a
+ * trade into its value, combines two values, the older on the left, and has an identity for the empty window.
+ */
+namespace spl::metrics::monoid {
+
+    /// Sum of the traded quantity.
+    struct volume {
+        using value_type = spl::types::quantity;
+
+        [[nodiscard]] constexpr static auto identity() noexcept -> value_type {
+            return value_type::zero();
+        }
+
+        template <typename ObjectT>
+        [[nodiscard]] constexpr static auto lift(ObjectT const& object) noexcept -> value_type {
+            return object.quantity;
+        }
+
+        [[nodiscard]] constexpr static auto combine(value_type const& lhs, value_type const& rhs) noexcept
+            -> value_type {
+            return lhs + rhs;
+        }
+    };
+
+    /// First, highest, lowest and last price, and the number of trades they cover.
+    struct ohlc {
+        struct value_type {
+            spl::types::price open;  ///< Price of the oldest trade.
+            spl::types::price high;  ///< Highest price.
+            spl::types::price low;   ///< Lowest price.
+            spl::types::price close; ///< Price of the newest trade.
+            std::uint64_t trades;    ///< Number of trades, zero for the identity.
+
+            constexpr auto operator==(value_type const& other) const noexcept -> bool = default;
+        };
+
+        [[nodiscard]] constexpr static auto identity() noexcept -> value_type {
+            return value_type{};
+        }
+
+        template <typename ObjectT>
+        [[nodiscard]] constexpr static auto lift(ObjectT const& object) noexcept -> value_type {
+            return value_type{object.price, object.price, object.price, object.price, 1};
+        }
+
+        [[nodiscard]] constexpr static auto combine(value_type const& lhs, value_type const& rhs) noexcept
+            -> value_type {
+            if (lhs.trades == 0) {
+                return rhs;
+            }
+            if (rhs.trades == 0) {
+                return lhs;
+            }
+            return value_type{
+                .open   = lhs.open,
+                .high   = std::max(lhs.high, rhs.high),
+                .low    = std::min(lhs.low, rhs.low),
+                .close  = rhs.close,
+                .trades = lhs.trades + rhs.trades,
+            };
+        }
+    };
+
+    /// Number of trades each aggressor side took.
+    struct sides {
+        struct value_type {
+            std::uint64_t buys;  ///< Trades a buyer aggressed.
+            std::uint64_t sells; ///< Trades a seller aggressed.
+
+            constexpr auto operator==(value_type const& other) const noexcept -> bool = default;
+        };
+
+        [[nodiscard]] constexpr static auto identity() noexcept -> value_type {
+            return value_type{};
+        }
+
+        template <typename ObjectT>
+        [[nodiscard]] constexpr static auto lift(ObjectT const& object) noexcept -> value_type {
+            using side_type = decltype(object.side);
+            return value_type{
+                .buys  = object.side == side_type::buy ? 1U : 0U,
+                .sells = object.side == side_type::sell ? 1U : 0U,
+            };
+        }
+
+        [[nodiscard]] constexpr static auto combine(value_type const& lhs, value_type const& rhs) noexcept
+            -> value_type {
+            return value_type{.buys = lhs.buys + rhs.buys, .sells = lhs.sells + rhs.sells};
+        }
+    };
+
+} // namespace spl::metrics::monoid
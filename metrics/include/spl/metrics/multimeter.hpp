@@ -3,6 +3,7 @@
 #include "spl/metrics/type.hpp"
 #include "spl/metrics/stream/multimeter.hpp"
 #include "spl/metrics/scan/multimeter.hpp"
+#include "spl/metrics/sketch/multimeter.hpp"
 #include "spl/meta/map.hpp"
 #include "spl/meta/typed.hpp"
 
@@ -10,22 +11,29 @@ namespace spl::metrics {
 
     namespace internal {
 
-        template <typename ObjectT,                                     //
-                  template <typename...> class ContainerT = std::deque, //
-                  typename PredicateT                     = internal::timeline_predicate>
-        using multimeter_lookup =
-            spl::meta::map<spl::meta::vpair<spl::metrics::type::scan,
-                                            spl::metrics::scan::multimeter<ObjectT, ContainerT, PredicateT>>, //
-                           spl::meta::vpair<spl::metrics::type::stream,
-                                            spl::metrics::stream::multimeter<ObjectT, ContainerT, PredicateT>>>;
+        template <typename ObjectT,                                                 //
+                  template <typename...> class ContainerT = std::deque,             //
+                  typename PredicateT                     = internal::timeline_predicate, //
+                  typename PoliciesT                      = spl::metrics::policy::price,  //
+                  typename WindowT                        = spl::metrics::window::time>
+        using multimeter_lookup = spl::meta::map<
+            spl::meta::vpair<spl::metrics::type::scan,
+                             spl::metrics::scan::multimeter<ObjectT, ContainerT, PredicateT, PoliciesT, WindowT>>, //
+            spl::meta::vpair<spl::metrics::type::stream,
+                             spl::metrics::stream::multimeter<ObjectT, ContainerT, PredicateT, PoliciesT, WindowT>>, //
+            spl::meta::vpair<spl::metrics::type::sketch,
+                             spl::metrics::sketch::multimeter<ObjectT, ContainerT, PredicateT, PoliciesT, WindowT>>>;
 
     } // namespace internal
 
-    template <spl::metrics::type TypeV,                             //
-              typename ObjectT,                                     //
-              template <typename...> class ContainerT = std::deque, //
-              typename PredicateT                     = internal::timeline_predicate>
-    using multimeter = spl::meta::map_at<internal::multimeter_lookup<ObjectT, ContainerT, PredicateT>, //
-                                         spl::meta::typed<TypeV>>;
+    template <spl::metrics::type TypeV,                                     //
+              typename ObjectT,                                             //
+              template <typename...> class ContainerT = std::deque,         //
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename PoliciesT                      = spl::metrics::policy::price,  //
+              typename WindowT                        = spl::metrics::window::time>
+    using multimeter =
+        spl::meta::map_at<internal::multimeter_lookup<ObjectT, ContainerT, PredicateT, PoliciesT, WindowT>, //
+                          spl::meta::typed<TypeV>>;
 
 } // namespace spl::metrics
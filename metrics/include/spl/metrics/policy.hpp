@@ -0,0 +1,271 @@
+#pragma once
+
+#include "spl/meta/list.hpp"
+#include "spl/metrics/metrics.hpp"
+#include "spl/metrics/monoid.hpp"
+#include "spl/metrics/scan/max.hpp"
+#include "spl/metrics/scan/mean.hpp"
+#include "spl/metrics/scan/median.hpp"
+#include "spl/metrics/scan/min.hpp"
+#include "spl/metrics/sketch/extremum.hpp"
+#include "spl/metrics/sketch/mean.hpp"
+#include "spl/metrics/sketch/quantiles.hpp"
+#include "spl/metrics/stream/aggregate.hpp"
+#include "spl/metrics/stream/max.hpp"
+#include "spl/metrics/stream/mean.hpp"
+#include "spl/metrics/stream/median.hpp"
+#include "spl/metrics/stream/min.hpp"
+#include "spl/metrics/stream/sliding.hpp"
+#include "spl/metrics/stream/trades.hpp"
+#include "spl/metrics/stream/volume.hpp"
+#include "spl/metrics/stream/vwap.hpp"
+#include "spl/types/price.hpp"
+#include "spl/types/quantity.hpp"
+
+#include <cstdint>
+
+/**
+ * @brief Metric policies a multimeter is parameterized with. A policy names the metric computing it in each
+ * implementation (`stream`, and `scan` and `sketch` where there is one), the `field` it contributes to the result
+ * and how to `fill` that field from the metric. The price statistics also tell how to `copy` their field into the
+ * spl::metrics::metrics record the sinks and the publisher take. Policies naming the same metric share it, e.g. mean
+ * and dispersion update a single stream::mean.
+ */
+namespace spl::metrics::policy {
+
+    struct minimum {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::min<ObjectT, ContainerT, PredicateT>;
+
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT, typename WindowT>
+        using scan = spl::metrics::scan::min<ObjectT, ContainerT, PredicateT, WindowT>;
+
+        template <typename ObjectT>
+        using sketch = spl::metrics::sketch::min<ObjectT>;
+
+        struct field {
+            spl::types::price minimum; ///< Lowest price of the window.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.minimum = metric();
+        }
+
+        constexpr static auto copy(spl::metrics::metrics& record, field const& result) noexcept -> void {
+            record.minimum = result.minimum;
+        }
+    };
+
+    struct maximum {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::max<ObjectT, ContainerT, PredicateT>;
+
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT, typename WindowT>
+        using scan = spl::metrics::scan::max<ObjectT, ContainerT, PredicateT, WindowT>;
+
+        template <typename ObjectT>
+        using sketch = spl::metrics::sketch::max<ObjectT>;
+
+        struct field {
+            spl::types::price maximum; ///< Highest price of the window.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.maximum = metric();
+        }
+
+        constexpr static auto copy(spl::metrics::metrics& record, field const& result) noexcept -> void {
+            record.maximum = result.maximum;
+        }
+    };
+
+    /// The minimum computed by a two_stack instead of the monotonic deque, listed in place of policy::minimum.
+    struct sliding_minimum : minimum {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::sliding_min<ObjectT, ContainerT, PredicateT>;
+    };
+
+    /// The maximum computed by a two_stack instead of the monotonic deque, listed in place of policy::maximum.
+    struct sliding_maximum : maximum {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::sliding_max<ObjectT, ContainerT, PredicateT>;
+    };
+
+    struct median {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::median<ObjectT, ContainerT, PredicateT>;
+
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT, typename WindowT>
+        using scan = spl::metrics::scan::median<ObjectT, ContainerT, PredicateT, WindowT>;
+
+        template <typename ObjectT>
+        using sketch = spl::metrics::sketch::quantiles<ObjectT>;
+
+        struct field {
+            spl::types::price median; ///< Median price of the window.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.median = metric();
+        }
+
+        constexpr static auto copy(spl::metrics::metrics& record, field const& result) noexcept -> void {
+            record.median = result.median;
+        }
+    };
+
+    struct mean {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::mean<ObjectT, ContainerT, PredicateT>;
+
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT, typename WindowT>
+        using scan = spl::metrics::scan::mean<ObjectT, ContainerT, PredicateT, WindowT>;
+
+        template <typename ObjectT>
+        using sketch = spl::metrics::sketch::mean<ObjectT>;
+
+        struct field {
+            spl::types::price mean; ///< Mean price of the window.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.mean = metric();
+        }
+
+        constexpr static auto copy(spl::metrics::metrics& record, field const& result) noexcept -> void {
+            record.mean = result.mean;
+        }
+    };
+
+    /// The 99th percentile of the price, only approximated by a sketch.
+    struct tail {
+        template <typename ObjectT>
+        using sketch = spl::metrics::sketch::quantiles<ObjectT>;
+
+        struct field {
+            spl::types::price p99; ///< 99th percentile of the price.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.p99 = metric.quantile(0.99);
+        }
+    };
+
+    struct dispersion {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::mean<ObjectT, ContainerT, PredicateT>;
+
+        struct field {
+            spl::types::price variance;  ///< Population variance of the price, in price² at the price scale.
+            spl::types::price deviation; ///< Population standard deviation of the price.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.variance  = metric.variance();
+            result.deviation = metric.deviation();
+        }
+    };
+
+    struct vwap {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::vwap<ObjectT, ContainerT, PredicateT>;
+
+        struct field {
+            spl::types::price vwap; ///< Volume-weighted average price.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.vwap = metric();
+        }
+    };
+
+    struct volume {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::volume<ObjectT, ContainerT, PredicateT>;
+
+        struct field {
+            spl::types::quantity volume;      ///< Base volume.
+            spl::types::price notional;       ///< Quote volume, the sum of price times quantity.
+            spl::types::quantity buy_volume;  ///< Base volume of the trades a buyer aggressed.
+            spl::types::quantity sell_volume; ///< Base volume of the trades a seller aggressed.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            auto const value   = metric();
+            result.volume      = value.base;
+            result.notional    = value.quote;
+            result.buy_volume  = value.buy;
+            result.sell_volume = value.sell;
+        }
+    };
+
+    struct trades {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::trades<ObjectT, ContainerT, PredicateT>;
+
+        struct field {
+            std::uint64_t trades; ///< Number of trades.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            result.trades = metric();
+        }
+    };
+
+    struct ohlc {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::aggregate<ObjectT, spl::metrics::monoid::ohlc, ContainerT, PredicateT>;
+
+        struct field {
+            spl::types::price open;  ///< Price of the oldest trade of the window.
+            spl::types::price high;  ///< Highest price of the window.
+            spl::types::price low;   ///< Lowest price of the window.
+            spl::types::price close; ///< Price of the newest trade of the window.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            auto const value = metric();
+            result.open      = value.open;
+            result.high      = value.high;
+            result.low       = value.low;
+            result.close     = value.close;
+        }
+
+        constexpr static auto copy(spl::metrics::metrics& record, field const& result) noexcept -> void {
+            record.maximum = result.high;
+            record.minimum = result.low;
+        }
+    };
+
+    struct sides {
+        template <typename ObjectT, template <typename...> class ContainerT, typename PredicateT>
+        using stream = spl::metrics::stream::aggregate<ObjectT, spl::metrics::monoid::sides, ContainerT, PredicateT>;
+
+        struct field {
+            std::uint64_t buy_trades;  ///< Number of trades a buyer aggressed.
+            std::uint64_t sell_trades; ///< Number of trades a seller aggressed.
+        };
+
+        template <typename MetricT>
+        constexpr static auto fill(field& result, MetricT const& metric) noexcept -> void {
+            auto const value   = metric();
+            result.buy_trades  = value.buys;
+            result.sell_trades = value.sells;
+        }
+    };
+
+    using price = spl::meta::list<minimum, maximum, median, mean>; ///< Price statistics, the default.
+    using flow  = spl::meta::list<vwap, volume, trades>;           ///< Traded volume and its average price.
+    using all   = spl::meta::joined<price, spl::meta::list<dispersion, ohlc, sides>, flow>;
+
+} // namespace spl::metrics::policy
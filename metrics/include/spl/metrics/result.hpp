@@ -0,0 +1,38 @@
+#pragma once
+
+#include "spl/meta/list.hpp"
+#include "spl/metrics/metrics.hpp"
+
+#include <chrono>
+
+namespace spl::metrics {
+
+    template <typename PoliciesT>
+    struct result;
+
+    /**
+     * @brief Result of a multimeter over the given policies: the fields of every policy and the timestamp of the
+     * window. It converts to the spl::metrics::metrics record the sinks and the publisher take, which holds the price
+     * statistics only: the policies with a `copy` fill it, the fields of the others stay in the result, and the price
+     * statistics left out are zero.
+     */
+    template <typename... PoliciesT>
+    struct result<spl::meta::list<PoliciesT...>> : PoliciesT::field... {
+        std::chrono::nanoseconds timestamp;
+
+        [[nodiscard]] constexpr operator spl::metrics::metrics() const noexcept {
+            auto record = spl::metrics::metrics{.timestamp = timestamp};
+            (copy<PoliciesT>(record), ...);
+            return record;
+        }
+
+    private:
+        template <typename PolicyT>
+        constexpr auto copy(spl::metrics::metrics& record) const noexcept -> void {
+            if constexpr (requires(typename PolicyT::field const& field) { PolicyT::copy(record, field); }) {
+                PolicyT::copy(record, static_cast<typename PolicyT::field const&>(*this));
+            }
+        }
+    };
+
+} // namespace spl::metrics
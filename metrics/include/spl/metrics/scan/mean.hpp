@@ -9,9 +9,10 @@ namespace spl::metrics::scan {
 
     template <typename ObjectT,                                     //
               template <typename...> class ContainerT = std::deque, //
-              typename PredicateT                     = internal::timeline_predicate>
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename WindowT                        = spl::metrics::window::time>
     struct mean {
-        using container_type = spl::metrics::timeline<ObjectT, ContainerT, PredicateT>;
+        using container_type = spl::metrics::timeline<ObjectT, ContainerT, PredicateT, WindowT>;
 
         constexpr explicit mean(container_type& reference) noexcept : reference_{reference} {}
 
@@ -11,9 +11,10 @@ namespace spl::metrics::scan {
 
     template <typename ObjectT,                                     //
               template <typename...> class ContainerT = std::deque, //
-              typename PredicateT                     = internal::timeline_predicate>
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename WindowT                        = spl::metrics::window::time>
     struct median {
-        using container_type = spl::metrics::timeline<ObjectT, ContainerT, PredicateT>;
+        using container_type = spl::metrics::timeline<ObjectT, ContainerT, PredicateT, WindowT>;
 
         constexpr explicit median(container_type& reference) noexcept : reference_{reference} {}
 
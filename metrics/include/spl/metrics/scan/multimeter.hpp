@@ -1,41 +1,82 @@
 #pragma once
 
+#include "spl/meta/list.hpp"
 #include "spl/metrics/timeline.hpp"
-#include "spl/metrics/metrics.hpp"
-#include "spl/metrics/scan/median.hpp"
-#include "spl/metrics/scan/max.hpp"
-#include "spl/metrics/scan/min.hpp"
-#include "spl/metrics/scan/mean.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/result.hpp"
+
+#include <tuple>
 
 namespace spl::metrics::scan {
 
+    /**
+     * @brief Computes the metrics of a time window listed in PoliciesT by scanning the shared timeline on every
+     * event. Only the policies with a `scan` implementation can be listed. WindowT is the spl::metrics::window the
+     * events expire by. `update` only stores the event, and `snapshot` scans the window.
+     */
     template <typename ObjectT,                                     //
               template <typename...> class ContainerT = std::deque, //
-              typename PredicateT                     = internal::timeline_predicate>
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename PoliciesT                      = spl::metrics::policy::price,  //
+              typename WindowT                        = spl::metrics::window::time>
     struct multimeter {
-        constexpr explicit multimeter(std::chrono::nanoseconds period = std::chrono::milliseconds{100}) noexcept :
-            timeline_{period}, median_{timeline_}, max_{timeline_}, min_{timeline_}, mean_{timeline_} {}
+        using result_type = spl::metrics::result<PoliciesT>;
+
+        constexpr explicit multimeter(std::chrono::nanoseconds period = std::chrono::milliseconds{100}) noexcept
+        requires std::is_same_v<WindowT, spl::metrics::window::time>
+            : timeline_{period}, metrics_{make(static_cast<metrics_type*>(nullptr))} {}
+
+        constexpr explicit multimeter(WindowT window) noexcept :
+            timeline_{window}, metrics_{make(static_cast<metrics_type*>(nullptr))} {}
+
+        template <typename InstanceT>
+        requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
+        [[nodiscard]] constexpr auto operator()(InstanceT&& instance) noexcept -> result_type {
+            update(std::forward<InstanceT>(instance));
+            return snapshot();
+        }
 
+        /**
+         * @brief Adds the event to the window and expires the ones it pushes out, without reading the metrics.
+         */
         template <typename InstanceT>
         requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
-        [[nodiscard]] constexpr auto operator()(InstanceT&& instance) noexcept -> spl::metrics::metrics {
-            auto& reference      = timeline_.emplace_back(std::forward<InstanceT>(instance));
-            auto const timestamp = PredicateT{}(reference);
-            return spl::metrics::metrics{
-                .minimum   = min_(),
-                .maximum   = max_(),
-                .median    = median_(),
-                .mean      = mean_(),
-                .timestamp = timestamp,
-            };
+        constexpr auto update(InstanceT&& instance) noexcept -> void {
+            auto& reference = timeline_.emplace_back(std::forward<InstanceT>(instance));
+            timestamp_      = PredicateT{}(reference);
+            dirty_          = true;
+        }
+
+        /**
+         * @brief Metrics of the window as of the last update, only computed again after a new one.
+         */
+        [[nodiscard]] constexpr auto snapshot() noexcept -> result_type const& {
+            if (dirty_) {
+                snapshot_.timestamp = timestamp_;
+                spl::meta::for_each<PoliciesT>([&]<typename PolicyT>(PolicyT) {
+                    PolicyT::fill(snapshot_, std::get<metric_type<PolicyT>>(metrics_));
+                });
+                dirty_ = false;
+            }
+            return snapshot_;
         }
 
     private:
-        spl::metrics::timeline<ObjectT, ContainerT, PredicateT> timeline_;
-        spl::metrics::scan::median<ObjectT, ContainerT, PredicateT> median_;
-        spl::metrics::scan::max<ObjectT, ContainerT, PredicateT> max_;
-        spl::metrics::scan::min<ObjectT, ContainerT, PredicateT> min_;
-        spl::metrics::scan::mean<ObjectT, ContainerT, PredicateT> mean_;
+        template <typename PolicyT>
+        using metric_type = typename PolicyT::template scan<ObjectT, ContainerT, PredicateT, WindowT>;
+
+        using metrics_type = spl::meta::as_tuple<spl::meta::unique<spl::meta::transformed<metric_type, PoliciesT>>>;
+
+        template <typename... MetricsT>
+        constexpr auto make(std::tuple<MetricsT...>*) noexcept -> metrics_type {
+            return metrics_type{MetricsT{timeline_}...};
+        }
+
+        spl::metrics::timeline<ObjectT, ContainerT, PredicateT, WindowT> timeline_;
+        metrics_type metrics_;
+        std::chrono::nanoseconds timestamp_{}; ///< Timestamp of the last update.
+        result_type snapshot_{};               ///< Metrics as of the last snapshot.
+        bool dirty_{false};                    ///< Whether an update came after the last snapshot.
     };
 
 } // namespace spl::metrics::scan
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Window of a sketch multimeter: `period` split into `buckets` of equal length, each summarised by its own
+     * sketch and expired whole, and the relative `accuracy` of the quantiles.
+     */
+    struct config {
+        std::chrono::nanoseconds period; ///< Length of the window.
+        std::size_t buckets{60};         ///< Number of buckets the window rotates through.
+        double accuracy{0.0001};         ///< Relative error of the quantiles, 1 bp by default.
+    };
+
+} // namespace spl::metrics::sketch
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "spl/result/contract.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Mergeable quantile sketch with a relative error bound (DDSketch)
+     *
+     * Positive values are counted in logarithmic bins: bin i holds the values in (γ^(i-1), γ^i], with
+     * γ = (1 + α) / (1 - α), and the quantile of a rank is read back as the bin midpoint 2γ^i / (γ + 1), within a
+     * relative error α of the exact value of that rank. Bins are dense counters between the lowest and the highest
+     * bin seen, so the memory depends on the ratio of the extreme values, log(max / min) / log(γ), and not on how
+     * many were inserted. The counts are additive: merging two sketches adds their bins, and erasing a sketch merged
+     * before subtracts them, which is how a window expires its oldest bucket. Zero and negative values are only
+     * counted, and read back as zero.
+     *
+     * @par Complexity
+     * - Query: O(B) with B the number of bins
+     * - Insert: O(1), O(B) when the range of bins grows
+     * - Merge and erase: O(B)
+     */
+    struct ddsketch {
+        using count_type = std::uint64_t;
+        using key_type   = std::int32_t;
+
+        /**
+         * @brief Sketch whose quantiles are within a relative `accuracy` of the exact ones, e.g. 0.0001 for 1 bp. The
+         * accuracy must lie in (0, 1).
+         */
+        explicit ddsketch(double accuracy) noexcept :
+            gamma_{(1.0 + accuracy) / (1.0 - accuracy)}, multiplier_{1.0 / std::log(gamma_)} {
+            spl::expects(accuracy > 0.0 and accuracy < 1.0, "The accuracy of a sketch must lie in (0, 1), got {}",
+                         accuracy);
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool {
+            return count_ == 0;
+        }
+
+        [[nodiscard]] auto count() const noexcept -> count_type {
+            return count_;
+        }
+
+        /**
+         * @brief Number of bins allocated, the memory of the sketch.
+         */
+        [[nodiscard]] auto bins() const noexcept -> std::size_t {
+            return std::size(bins_);
+        }
+
+        /**
+         * @brief Value of rank ⌊q (n - 1)⌋ among the n values counted, within the relative accuracy; zero if empty.
+         */
+        [[nodiscard]] auto quantile(double q) const noexcept -> double {
+            if (count_ == 0) [[unlikely]] {
+                return 0.0;
+            }
+
+            auto const rank = static_cast<count_type>(std::clamp(q, 0.0, 1.0) * static_cast<double>(count_ - 1));
+            auto seen       = zero_;
+            if (seen > rank) {
+                return 0.0;
+            }
+            for (std::size_t index = 0; index < std::size(bins_); ++index) {
+                seen += bins_[index];
+                if (seen > rank) {
+                    return value(offset_ + static_cast<key_type>(index));
+                }
+            }
+            return value(offset_ + static_cast<key_type>(std::size(bins_)) - 1);
+        }
+
+        auto insert(double value, count_type count = 1) noexcept -> void {
+            count_ += count;
+            if (value <= 0.0) [[unlikely]] {
+                zero_ += count;
+                return;
+            }
+            bin(static_cast<key_type>(std::ceil(std::log(value) * multiplier_))) += count;
+        }
+
+        /**
+         * @brief Adds the values counted by a sketch of the same accuracy.
+         */
+        auto merge(ddsketch const& other) noexcept -> void {
+            if (other.count_ == 0) {
+                return;
+            }
+            count_ += other.count_;
+            zero_ += other.zero_;
+            for (std::size_t index = 0; index < std::size(other.bins_); ++index) {
+                if (other.bins_[index] != 0) {
+                    bin(other.offset_ + static_cast<key_type>(index)) += other.bins_[index];
+                }
+            }
+        }
+
+        /**
+         * @brief Removes the values counted by a sketch of the same accuracy, all of which were merged or inserted
+         * into this one.
+         */
+        auto erase(ddsketch const& other) noexcept -> void {
+            if (other.count_ == 0) {
+                return;
+            }
+            count_ -= other.count_;
+            zero_ -= other.zero_;
+            for (std::size_t index = 0; index < std::size(other.bins_); ++index) {
+                if (other.bins_[index] != 0) {
+                    bin(other.offset_ + static_cast<key_type>(index)) -= other.bins_[index];
+                }
+            }
+        }
+
+        /**
+         * @brief Resets the counts, keeping the bins allocated.
+         */
+        auto clear() noexcept -> void {
+            std::ranges::fill(bins_, count_type{0});
+            zero_  = 0;
+            count_ = 0;
+        }
+
+    private:
+        [[nodiscard]] auto value(key_type key) const noexcept -> double {
+            return 2.0 * std::pow(gamma_, key) / (gamma_ + 1.0);
+        }
+
+        /**
+         * @brief Counter of the bin, growing the range of bins to include it.
+         */
+        auto bin(key_type key) noexcept -> count_type& {
+            if (std::empty(bins_)) [[unlikely]] {
+                offset_ = key;
+                bins_.resize(1);
+            } else if (key < offset_) [[unlikely]] {
+                bins_.insert(std::begin(bins_), static_cast<std::size_t>(offset_ - key), count_type{0});
+                offset_ = key;
+            } else if (key - offset_ >= static_cast<key_type>(std::size(bins_))) [[unlikely]] {
+                bins_.resize(static_cast<std::size_t>(key - offset_) + 1);
+            }
+            return bins_[static_cast<std::size_t>(key - offset_)];
+        }
+
+        double gamma_;                   ///< Ratio between the bounds of a bin.
+        double multiplier_;              ///< 1 / log(γ), to map a value to its bin.
+        std::vector<count_type> bins_{}; ///< Counts of the bins from offset_ on.
+        key_type offset_{0};             ///< Bin of the first counter.
+        count_type zero_{0};             ///< Number of zero or negative values.
+        count_type count_{0};            ///< Number of values.
+    };
+
+} // namespace spl::metrics::sketch
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "spl/metrics/sketch/config.hpp"
+#include "spl/metrics/sketch/ring.hpp"
+#include "spl/metrics/stream/sliding.hpp"
+#include "spl/types/price.hpp"
+
+#include <cstdint>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Exact aggregate of the price over a window of rotating buckets, e.g. the minimum or the maximum
+     *
+     * Every bucket keeps the aggregate of its slice of the window. A trade updates the newest bucket and the
+     * aggregate of the window, and rotating recomputes the latter from the buckets left.
+     *
+     * @tparam ObjectT The trade type (must have .price)
+     * @tparam OperationT Associative operation over two prices, e.g. stream::lowest
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Update (insert): O(1)
+     * - Rotation: O(buckets)
+     */
+    template <typename ObjectT, typename OperationT>
+    struct extremum {
+        using value_type = spl::types::price;
+
+        explicit extremum(config const& window) noexcept : buckets_{window.buckets, bucket{}} {}
+
+        [[nodiscard]] auto operator()() const noexcept -> value_type {
+            return total_.value;
+        }
+
+        auto operator()(ObjectT const& value) noexcept -> void {
+            add(buckets_.newest(), value.price);
+            add(total_, value.price);
+        }
+
+        auto rotate() noexcept -> void {
+            buckets_.rotate() = bucket{};
+            total_            = bucket{};
+            for (auto const& current : buckets_) {
+                if (current.count != 0) {
+                    add(total_, current.value);
+                }
+            }
+        }
+
+    private:
+        struct bucket {
+            value_type value{};     ///< Aggregate of the prices.
+            std::uint64_t count{0}; ///< Number of prices, the aggregate is meaningless without any.
+        };
+
+        constexpr static auto add(bucket& target, value_type price) noexcept -> void {
+            target.value = target.count == 0 ? price : OperationT{}(target.value, price);
+            ++target.count;
+        }
+
+        bucket total_{};        ///< Aggregate of the window.
+        ring<bucket> buckets_;  ///< Aggregate of every bucket.
+    };
+
+    template <typename ObjectT>
+    using min = extremum<ObjectT, spl::metrics::stream::lowest>;
+
+    template <typename ObjectT>
+    using max = extremum<ObjectT, spl::metrics::stream::highest>;
+
+} // namespace spl::metrics::sketch
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "spl/metrics/sketch/config.hpp"
+#include "spl/metrics/sketch/ring.hpp"
+#include "spl/types/price.hpp"
+
+#include <cstdint>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Exact mean price over a window of rotating buckets
+     *
+     * Every bucket keeps the sum of its price mantissas in 128 bits and its count, and so does the window: a trade
+     * adds to both, and rotating subtracts the oldest bucket. The division happens once per query, rounded half up.
+     *
+     * @tparam ObjectT The trade type (must have .price)
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Update (insert): O(1)
+     * - Rotation: O(1)
+     */
+    template <typename ObjectT>
+    struct mean {
+        using value_type = spl::types::price;
+        using wide_type  = __int128_t;
+
+        explicit mean(config const& window) noexcept : buckets_{window.buckets, bucket{}} {}
+
+        [[nodiscard]] auto operator()() const noexcept -> value_type {
+            if (total_.count == 0) [[unlikely]] {
+                return value_type::zero();
+            }
+            using rounding_mode = typename value_type::rounding_mode;
+            auto const count    = static_cast<wide_type>(total_.count);
+            auto const rounded  = total_.sum < 0
+                                      ? -value_type::round_value<rounding_mode::half_up>(-total_.sum, count)
+                                      : value_type::round_value<rounding_mode::half_up>(total_.sum, count);
+            return value_type::from_shifted(static_cast<typename value_type::mantissa_type>(rounded));
+        }
+
+        auto operator()(ObjectT const& value) noexcept -> void {
+            auto const mantissa = static_cast<wide_type>(value.price.shifted());
+            auto& newest        = buckets_.newest();
+            newest.sum += mantissa;
+            newest.count += 1;
+            total_.sum += mantissa;
+            total_.count += 1;
+        }
+
+        auto rotate() noexcept -> void {
+            auto& expired = buckets_.rotate();
+            total_.sum -= expired.sum;
+            total_.count -= expired.count;
+            expired = bucket{};
+        }
+
+    private:
+        struct bucket {
+            wide_type sum{0};       ///< Sum of the price mantissas.
+            std::uint64_t count{0}; ///< Number of prices.
+        };
+
+        bucket total_{};       ///< Sums of the window.
+        ring<bucket> buckets_; ///< Sums of every bucket.
+    };
+
+} // namespace spl::metrics::sketch
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "spl/meta/list.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/result.hpp"
+#include "spl/metrics/sketch/config.hpp"
+#include "spl/metrics/timeline.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Computes the metrics of a time window listed in PoliciesT without storing its trades, for windows too
+     * long to keep, e.g. 24 hours of a liquid pair. Only the policies with a `sketch` implementation can be listed.
+     *
+     * The window is split into `buckets` slices of period / buckets, epoch-aligned, and every metric summarises each
+     * slice on its own: when a trade starts a new slice, the slices past the window are expired whole. The window
+     * thus covers the current slice and the previous buckets - 1, between period - period / buckets and period, and
+     * the memory depends on the number of buckets, not on the number of trades. Zero buckets is taken as one.
+     * ContainerT is unused, and WindowT must be window::time, they only keep the parameters of the other multimeters.
+     * `update` only adds the trade to the buckets, and `snapshot` reads the metrics.
+     */
+    template <typename ObjectT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename PoliciesT                      = spl::metrics::policy::price,  //
+              typename WindowT                        = spl::metrics::window::time>
+    struct multimeter {
+        static_assert(std::is_same_v<WindowT, spl::metrics::window::time>,
+                      "spl::metrics::sketch::multimeter expires its buckets by time");
+
+        using result_type = spl::metrics::result<PoliciesT>;
+
+        constexpr explicit multimeter(std::chrono::nanoseconds period = std::chrono::milliseconds{100}) noexcept :
+            multimeter{config{.period = period}} {}
+
+        constexpr explicit multimeter(config const& window) noexcept :
+            buckets_{std::max<std::size_t>(window.buckets, 1)},
+            width_{std::max(window.period / static_cast<std::int64_t>(buckets_), std::chrono::nanoseconds{1})},
+            metrics_{make(config{.period = window.period, .buckets = buckets_, .accuracy = window.accuracy},
+                          static_cast<metrics_type*>(nullptr))} {}
+
+        template <typename InstanceT>
+        requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
+        [[nodiscard]] constexpr auto operator()(InstanceT&& instance) noexcept -> result_type {
+            update(std::forward<InstanceT>(instance));
+            return snapshot();
+        }
+
+        /**
+         * @brief Adds the trade to the newest bucket, after expiring the buckets it pushes out of the window.
+         */
+        template <typename InstanceT>
+        requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
+        constexpr auto update(InstanceT&& instance) noexcept -> void {
+            timestamp_ = PredicateT{}(instance);
+            if (auto const slice = timestamp_ / width_; slice > slice_) [[unlikely]] {
+                // Unsigned, so that the first trade, after the lowest slice, expires every bucket
+                auto const elapsed = static_cast<std::uint64_t>(slice) - static_cast<std::uint64_t>(slice_);
+                for (auto step = std::min<std::uint64_t>(elapsed, buckets_); step > 0; --step) {
+                    std::apply([](auto&... metrics) { (metrics.rotate(), ...); }, metrics_);
+                }
+                slice_ = slice;
+            }
+            std::apply([&](auto&... metrics) { (metrics(instance), ...); }, metrics_);
+            dirty_ = true;
+        }
+
+        /**
+         * @brief Metrics of the window as of the last update, only computed again after a new one.
+         */
+        [[nodiscard]] constexpr auto snapshot() noexcept -> result_type const& {
+            if (dirty_) {
+                snapshot_.timestamp = timestamp_;
+                spl::meta::for_each<PoliciesT>([&]<typename PolicyT>(PolicyT) {
+                    PolicyT::fill(snapshot_, std::get<metric_type<PolicyT>>(metrics_));
+                });
+                dirty_ = false;
+            }
+            return snapshot_;
+        }
+
+    private:
+        template <typename PolicyT>
+        using metric_type = typename PolicyT::template sketch<ObjectT>;
+
+        using metrics_type = spl::meta::as_tuple<spl::meta::unique<spl::meta::transformed<metric_type, PoliciesT>>>;
+
+        template <typename... MetricsT>
+        constexpr static auto make(config const& window, std::tuple<MetricsT...>*) noexcept -> metrics_type {
+            return metrics_type{MetricsT{window}...};
+        }
+
+        std::size_t buckets_;                                          ///< Number of buckets of the window.
+        std::chrono::nanoseconds width_;                               ///< Length of the slice of a bucket.
+        std::int64_t slice_{std::numeric_limits<std::int64_t>::min()}; ///< Slice of the newest bucket.
+        metrics_type metrics_;
+        std::chrono::nanoseconds timestamp_{}; ///< Timestamp of the last update.
+        result_type snapshot_{};               ///< Metrics as of the last snapshot.
+        bool dirty_{false};                    ///< Whether an update came after the last snapshot.
+    };
+
+} // namespace spl::metrics::sketch
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "spl/metrics/sketch/config.hpp"
+#include "spl/metrics/sketch/ddsketch.hpp"
+#include "spl/metrics/sketch/ring.hpp"
+#include "spl/types/price.hpp"
+
+#include <cmath>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Approximate quantiles of the price over a window of rotating buckets, in memory independent of the
+     * number of trades
+     *
+     * Every bucket has a ddsketch of the price mantissas of its slice of the window, and a running sketch merges
+     * them all: a trade is inserted into both, and rotating erases the oldest bucket from the running sketch before
+     * reusing it. Quantiles are within the configured relative accuracy of the price of that rank; the median is the
+     * lower one of an even window rather than the average of the two middle prices.
+     *
+     * @tparam ObjectT The trade type (must have .price)
+     *
+     * @par Complexity
+     * - Query: O(B) with B the number of bins of the running sketch
+     * - Update (insert): O(1)
+     * - Rotation: O(B)
+     */
+    template <typename ObjectT>
+    struct quantiles {
+        using value_type = spl::types::price;
+
+        explicit quantiles(config const& window) noexcept :
+            total_{window.accuracy}, buckets_{window.buckets, ddsketch{window.accuracy}} {}
+
+        /**
+         * @brief Median price of the window.
+         */
+        [[nodiscard]] auto operator()() const noexcept -> value_type {
+            return quantile(0.5);
+        }
+
+        /**
+         * @brief Price of the q-quantile of the window, e.g. 0.99 for the 99th percentile.
+         */
+        [[nodiscard]] auto quantile(double q) const noexcept -> value_type {
+            return value_type::from_shifted(std::llround(total_.quantile(q)));
+        }
+
+        [[nodiscard]] auto sketch() const noexcept -> ddsketch const& {
+            return total_;
+        }
+
+        auto operator()(ObjectT const& value) noexcept -> void {
+            auto const mantissa = static_cast<double>(value.price.shifted());
+            total_.insert(mantissa);
+            buckets_.newest().insert(mantissa);
+        }
+
+        auto rotate() noexcept -> void {
+            auto& expired = buckets_.rotate();
+            total_.erase(expired);
+            expired.clear();
+        }
+
+    private:
+        ddsketch total_;          ///< Merge of the sketches of every bucket.
+        ring<ddsketch> buckets_;  ///< Sketch of every bucket.
+    };
+
+} // namespace spl::metrics::sketch
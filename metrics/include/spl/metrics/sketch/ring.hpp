@@ -0,0 +1,52 @@
+#pragma once
+
+#include "spl/result/contract.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace spl::metrics::sketch {
+
+    /**
+     * @brief Fixed number of buckets summarising consecutive slices of a window, the newest one receiving the events.
+     * Rotating reuses the oldest bucket as the new newest one, which the caller expires and resets.
+     */
+    template <typename ValueT>
+    struct ring {
+        using value_type = ValueT;
+
+        ring(std::size_t size, value_type const& value) noexcept : values_(size, value) {
+            spl::expects(size > 0, "A ring needs at least one bucket");
+        }
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t {
+            return std::size(values_);
+        }
+
+        [[nodiscard]] auto newest() noexcept -> value_type& {
+            return values_[head_];
+        }
+
+        /**
+         * @brief Makes the oldest bucket the newest one and returns it, still holding the expired slice.
+         */
+        [[nodiscard]] auto rotate() noexcept -> value_type& {
+            head_ = head_ + 1 == std::size(values_) ? 0 : head_ + 1;
+            return values_[head_];
+        }
+
+        [[nodiscard]] auto begin() const noexcept {
+            return std::begin(values_);
+        }
+
+        [[nodiscard]] auto end() const noexcept {
+            return std::end(values_);
+        }
+
+    private:
+        std::vector<value_type> values_; ///< Buckets, in rotation order from head_ on.
+        std::size_t head_{0};            ///< Index of the newest bucket.
+    };
+
+} // namespace spl::metrics::sketch
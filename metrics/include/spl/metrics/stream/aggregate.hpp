@@ -0,0 +1,59 @@
+#pragma once
+
+#include "spl/concepts/monoid.hpp"
+#include "spl/metrics/stream/flat_fat.hpp"
+#include "spl/metrics/timeline.hpp"
+
+#include <cstddef>
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief O(log N) streaming aggregate of any monoid over the window, e.g. one of spl::metrics::monoid
+     *
+     * Every trade is lifted into the monoid and pushed onto a flat_fat, and expired trades are popped by count,
+     * oldest first, so the monoid needs no inverse and may be non-commutative (first and last price).
+     *
+     * @tparam ObjectT The object type stored in the timeline
+     * @tparam MonoidT The aggregation, lifting an ObjectT into its value (see spl::concepts::monoid_of)
+     * @tparam ContainerT The underlying container type for the timeline
+     * @tparam PredicateT Predicate to extract timestamp from ObjectT
+     *
+     * @par Complexity
+     * - Query: O(log N)
+     * - Update (insert): O(log N)
+     * - Update (remove): O(log N) per removed element
+     *
+     */
+    template <typename ObjectT,                                     //
+              typename MonoidT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    requires spl::concepts::monoid_of<MonoidT, ObjectT>
+    struct aggregate {
+        using value_type = typename MonoidT::value_type;
+
+        constexpr aggregate() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator()() const noexcept -> value_type {
+            return tree_();
+        }
+
+        template <typename IteratorT>
+        constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
+            auto count = std::size_t{0};
+            for (auto it = begin; it != end; ++it) {
+                ++count;
+            }
+            tree_.pop(count);
+        }
+
+        constexpr auto operator()(ObjectT const& value) noexcept -> void {
+            tree_.push(MonoidT::lift(value));
+        }
+
+    private:
+        spl::metrics::stream::flat_fat<MonoidT> tree_{}; ///< Lifted trades of the window, oldest first
+    };
+
+} // namespace spl::metrics::stream
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "spl/concepts/monoid.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief FIFO queue aggregating its values with a monoid over a flat, array-backed binary tree (FlatFAT)
+     *
+     * The leaves are a ring of a power of two capacity, every inner node holds the combination of its two children
+     * and a removed value becomes the identity. Pushing or popping a value updates its path to the root, and the
+     * aggregate of the queue combines the inner nodes covering it, at most two ranges when it wraps around the ring,
+     * so the order of a non-commutative monoid is kept. A full ring doubles and rebuilds its tree, and then keeps
+     * its capacity, so a steady window allocates nothing.
+     *
+     * @tparam MonoidT The aggregation, see spl::concepts::monoid
+     *
+     * @par Complexity
+     * - Query: O(log N)
+     * - Push: O(log N), O(N) when the ring grows
+     * - Pop: O(log N)
+     */
+    template <spl::concepts::monoid MonoidT>
+    struct flat_fat {
+        using value_type = typename MonoidT::value_type;
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr auto capacity() const noexcept -> std::size_t {
+            return capacity_;
+        }
+
+        /**
+         * @brief Aggregate of the values in the queue, oldest first, or the identity if it is empty.
+         */
+        [[nodiscard]] constexpr auto operator()() const noexcept -> value_type {
+            if (head_ + size_ <= capacity_) {
+                return query(head_, head_ + size_);
+            }
+            return MonoidT::combine(query(head_, capacity_), query(0, head_ + size_ - capacity_));
+        }
+
+        constexpr auto push(value_type const& value) noexcept -> void {
+            if (size_ == capacity_) [[unlikely]] {
+                grow();
+            }
+            assign((head_ + size_) & (capacity_ - 1), value);
+            ++size_;
+        }
+
+        /**
+         * @brief Removes the `count` oldest values, or all of them if there are fewer.
+         */
+        constexpr auto pop(std::size_t count = 1) noexcept -> void {
+            for (; count > 0 and size_ > 0; --count, --size_) {
+                assign(head_, MonoidT::identity());
+                head_ = (head_ + 1) & (capacity_ - 1);
+            }
+        }
+
+    private:
+        constexpr auto assign(std::size_t index, value_type const& value) noexcept -> void {
+            auto node   = index + capacity_;
+            tree_[node] = value;
+            for (node /= 2; node > 0; node /= 2) {
+                tree_[node] = MonoidT::combine(tree_[2 * node], tree_[2 * node + 1]);
+            }
+        }
+
+        /**
+         * @brief Combination of the leaves in [first, last), bottom up from both ends so that the order is kept.
+         */
+        [[nodiscard]] constexpr auto query(std::size_t first, std::size_t last) const noexcept -> value_type {
+            auto left  = MonoidT::identity();
+            auto right = MonoidT::identity();
+            for (first += capacity_, last += capacity_; first < last; first /= 2, last /= 2) {
+                if (first & 1) {
+                    left = MonoidT::combine(left, tree_[first++]);
+                }
+                if (last & 1) {
+                    right = MonoidT::combine(tree_[--last], right);
+                }
+            }
+            return MonoidT::combine(left, right);
+        }
+
+        /**
+         * @brief Doubles the ring, moving the values to its start in FIFO order, and rebuilds the inner nodes.
+         */
+        constexpr auto grow() noexcept -> void {
+            auto const capacity = std::max<std::size_t>(minimum, capacity_ * 2);
+            auto tree           = std::vector<value_type>(2 * capacity, MonoidT::identity());
+            for (std::size_t index = 0; index < size_; ++index) {
+                tree[capacity + index] = tree_[capacity_ + ((head_ + index) & (capacity_ - 1))];
+            }
+            for (auto node = capacity - 1; node > 0; --node) {
+                tree[node] = MonoidT::combine(tree[2 * node], tree[2 * node + 1]);
+            }
+            tree_     = std::move(tree);
+            capacity_ = capacity;
+            head_     = 0;
+        }
+
+        constexpr static auto minimum = std::size_t{16}; ///< Capacity of the first ring, a power of two.
+
+        std::vector<value_type> tree_{}; ///< Inner nodes at [1, capacity), leaves at [capacity, 2 capacity).
+        std::size_t capacity_{0};        ///< Number of leaves, a power of two.
+        std::size_t head_{0};            ///< Leaf of the oldest value.
+        std::size_t size_{0};            ///< Number of values in the queue.
+    };
+
+} // namespace spl::metrics::stream
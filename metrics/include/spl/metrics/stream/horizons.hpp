@@ -0,0 +1,117 @@
+#pragma once
+
+#include "spl/meta/list.hpp"
+#include "spl/metrics/timeline.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/result.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief Computes the metrics listed in PoliciesT over HorizonsV time windows of the same stream at once, e.g.
+     * 1 s, 1 m, 5 m and 15 m. Events are stored once, for as long as the longest window needs them, and every
+     * window keeps an expiry cursor into them along with its own incrementally updated metrics.
+     *
+     * @par Complexity
+     * - Update: the cost of one stream::multimeter update per window, without the copy of the event per window
+     * - Memory: the events of the longest window, plus the state of the metrics of every window
+     */
+    template <typename ObjectT,                                     //
+              std::size_t HorizonsV,                                //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename PoliciesT                      = spl::metrics::policy::price>
+    struct horizons {
+        static_assert(HorizonsV > 0, "spl::metrics::stream::horizons needs at least one window");
+
+        using duration_type = std::chrono::nanoseconds;
+        using periods_type  = std::array<duration_type, HorizonsV>;
+        using result_type   = std::array<spl::metrics::result<PoliciesT>, HorizonsV>;
+
+        constexpr explicit horizons(periods_type const& periods) noexcept {
+            for (std::size_t index = 0; index < HorizonsV; ++index) {
+                windows_[index].period = periods[index];
+            }
+        }
+
+        [[nodiscard]] constexpr static auto size() noexcept -> std::size_t {
+            return HorizonsV;
+        }
+
+        /**
+         * @brief Number of events stored, i.e. those of the longest window.
+         */
+        [[nodiscard]] constexpr auto stored() const noexcept -> std::size_t {
+            return std::size(values_);
+        }
+
+        template <typename InstanceT>
+        requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
+        [[nodiscard]] constexpr auto operator()(InstanceT&& instance) noexcept -> result_type {
+            values_.emplace_back(std::forward<InstanceT>(instance));
+            auto const& reference = values_.back();
+            auto const timestamp  = PredicateT{}(reference);
+
+            auto results = result_type{};
+            auto oldest  = offset_ + std::size(values_);
+            for (std::size_t index = 0; index < HorizonsV; ++index) {
+                auto& window = windows_[index];
+                expire(window, timestamp);
+                std::apply([&](auto&... metrics) { (metrics(reference), ...); }, window.metrics);
+
+                auto& result     = results[index];
+                result.timestamp = timestamp;
+                spl::meta::for_each<PoliciesT>([&]<typename PolicyT>(PolicyT) {
+                    PolicyT::fill(result, std::get<metric_type<PolicyT>>(window.metrics));
+                });
+                oldest = std::min(oldest, window.cursor);
+            }
+
+            // Only the events no window covers anymore are dropped, i.e. those before the longest window
+            values_.erase(std::begin(values_), std::next(std::begin(values_), oldest - offset_));
+            offset_ = oldest;
+            return results;
+        }
+
+    private:
+        template <typename PolicyT>
+        using metric_type = typename PolicyT::template stream<ObjectT, ContainerT, PredicateT>;
+
+        using metrics_type = spl::meta::as_tuple<spl::meta::unique<spl::meta::transformed<metric_type, PoliciesT>>>;
+
+        struct horizon {
+            duration_type period{}; ///< Length of the window.
+            std::size_t cursor{0};  ///< Absolute index of the first event of the window.
+            metrics_type metrics{}; ///< Metrics of the events from the cursor on.
+        };
+
+        /**
+         * @brief Moves the cursor of the window past the events that are `period` or older than `last`, and removes
+         * them from its metrics, the same events spl::metrics::timeline::flush would drop.
+         */
+        constexpr auto expire(horizon& window, duration_type last) noexcept -> void {
+            auto const first = std::next(std::begin(values_), window.cursor - offset_);
+            auto const iter  = std::find_if(first, std::end(values_), [&](auto&& value) {
+                return (last - PredicateT{}(value)) < window.period;
+            });
+            if (first == iter) [[likely]] {
+                return;
+            }
+
+            std::apply([&](auto&... metrics) { (metrics(first, iter), ...); }, window.metrics);
+            window.cursor += static_cast<std::size_t>(std::distance(first, iter));
+        }
+
+        ContainerT<ObjectT> values_{};             ///< Events of the longest window, in arrival order.
+        std::size_t offset_{0};                    ///< Absolute index of the first stored event.
+        std::array<horizon, HorizonsV> windows_{}; ///< Cursor and metrics of every window.
+    };
+
+} // namespace spl::metrics::stream
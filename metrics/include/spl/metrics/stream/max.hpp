@@ -16,7 +16,7 @@ namespace spl::metrics::stream {
      * Uses the sliding window maximum algorithm for ultra-low latency queries.
      *
      * @tparam ObjectT The object type stored in the timeline (must have .price)
-     * @tparam ContainerT The underlying container type for the timeline
+     * @tparam ContainerT The underlying container type for the timeline and the monotonic deque
      * @tparam PredicateT Predicate to extract timestamp from ObjectT
      *
      * @par Complexity
@@ -60,14 +60,15 @@ namespace spl::metrics::stream {
 
         constexpr auto operator()(ObjectT const& value) noexcept -> void {
             auto const price = value.price;
+            while (not std::empty(monotonic_deque_) and monotonic_deque_.back().price < price) {
+                monotonic_deque_.pop_back();
+            }
+
+            // Equal prices share an entry, whose count is what their expiries decrement
             if (not std::empty(monotonic_deque_) and monotonic_deque_.back().price == price) {
                 ++monotonic_deque_.back().count;
                 return;
             }
-
-            while (not std::empty(monotonic_deque_) and monotonic_deque_.back().price <= price) {
-                monotonic_deque_.pop_back();
-            }
             monotonic_deque_.push_back({price, 1});
         }
 
@@ -78,7 +79,7 @@ namespace spl::metrics::stream {
             }
         }
 
-        std::deque<entry> monotonic_deque_{}; ///< Monotonic deque of {price, count} in decreasing price order
+        ContainerT<entry> monotonic_deque_{}; ///< Monotonic deque of {price, count} in decreasing price order
     };
 
 } // namespace spl::metrics::stream
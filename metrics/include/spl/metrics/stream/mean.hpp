@@ -1,25 +1,30 @@
 #pragma once
 
 #include "spl/metrics/timeline.hpp"
-#include "spl/result/result.hpp"
 #include "spl/types/price.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace spl::metrics::stream {
 
     /**
-     * @brief O(1) streaming arithmetic mean (average price)
+     * @brief O(1) streaming arithmetic mean (average price), variance and standard deviation
      *
-     * Maintains running sum and count for constant-time mean calculation.
-     * Formula: mean = sum(prices) / count
+     * Maintains the running sums of the price mantissas and of their squares in 128 bits, so that sliding over
+     * hours of trades neither drifts nor converts to floating point. The division happens once per query, rounded
+     * half up. The variance is the population variance of the window.
+     * Formula: mean = sum(prices) / count, variance = sum(prices²) / count - mean²
      *
      * @tparam ObjectT The object type stored in the timeline (must have .price)
      * @tparam ContainerT The underlying container type for the timeline
      * @tparam PredicateT Predicate to extract timestamp from ObjectT
      *
      * @par Complexity
-     * - Query: O(1)
+     * - Query: O(1) for the mean and the variance, O(log V) for the standard deviation
      * - Update (insert): O(1)
-     * - Update (remove): O(1) where k is number of removed elements, amortized O(1)
+     * - Update (remove): O(1) per removed element
      *
      */
     template <typename ObjectT,                                     //
@@ -27,29 +32,107 @@ namespace spl::metrics::stream {
               typename PredicateT                     = internal::timeline_predicate>
     struct mean {
         using value_type = spl::types::price;
+        using wide_type  = __int128_t;
 
         constexpr mean() noexcept = default;
 
         [[nodiscard]] constexpr auto operator()() const noexcept -> spl::types::price {
-            return value_type::from(accumulated_ / static_cast<double>(count_));
+            if (count_ == 0) [[unlikely]] {
+                return value_type::zero();
+            }
+            return narrow(round(sum_, static_cast<wide_type>(count_)));
+        }
+
+        /**
+         * @brief Population variance of the prices, in price² expressed at the price scale.
+         */
+        [[nodiscard]] constexpr auto variance() const noexcept -> spl::types::price {
+            if (count_ == 0) [[unlikely]] {
+                return value_type::zero();
+            }
+            auto const count = static_cast<wide_type>(count_);
+            return narrow(round(spread(), count * count * value_type::scale()));
+        }
+
+        /**
+         * @brief Population standard deviation of the prices.
+         */
+        [[nodiscard]] constexpr auto deviation() const noexcept -> spl::types::price {
+            if (count_ == 0) [[unlikely]] {
+                return value_type::zero();
+            }
+            auto const count   = static_cast<wide_type>(count_);
+            auto const squared = round(spread(), count * count);
+            auto const root    = sqrt(squared);
+            return narrow(squared - root * root > root ? root + 1 : root);
         }
 
         template <typename IteratorT>
         constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
             for (auto it = begin; it != end; ++it) {
-                accumulated_ -= static_cast<double>(it->price);
+                auto const mantissa = static_cast<wide_type>(it->price.shifted());
+                sum_ -= mantissa;
+                squares_ -= mantissa * mantissa;
                 --count_;
             }
         }
 
         constexpr auto operator()(ObjectT const& value) noexcept -> void {
-            accumulated_ += static_cast<double>(value.price);
+            auto const mantissa = static_cast<wide_type>(value.price.shifted());
+            sum_ += mantissa;
+            squares_ += mantissa * mantissa;
             ++count_;
         }
 
     private:
-        double accumulated_{0.0}; ///< Running sum of all prices
-        std::size_t count_{0};    ///< Count of elements in window
+        /**
+         * @brief count² × variance on the mantissas, i.e. count × sum(prices²) - sum(prices)², computed around the
+         * truncated mean so that the intermediate products stay within 128 bits for any realistic window.
+         */
+        [[nodiscard]] constexpr auto spread() const noexcept -> wide_type {
+            auto const count = static_cast<wide_type>(count_);
+            auto quotient    = sum_ / count;
+            auto remainder   = sum_ - quotient * count;
+            if (remainder < 0) {
+                quotient -= 1;
+                remainder += count;
+            }
+            auto const centered = squares_ - quotient * quotient * count - 2 * quotient * remainder;
+            return centered * count - remainder * remainder;
+        }
+
+        [[nodiscard]] constexpr static auto round(wide_type value, wide_type divisor) noexcept -> wide_type {
+            using rounding_mode = typename value_type::rounding_mode;
+            if (value < 0) {
+                return -value_type::round_value<rounding_mode::half_up>(-value, divisor);
+            }
+            return value_type::round_value<rounding_mode::half_up>(value, divisor);
+        }
+
+        [[nodiscard]] constexpr static auto sqrt(wide_type value) noexcept -> wide_type {
+            if (value <= 0) {
+                return 0;
+            }
+            auto root = static_cast<wide_type>(std::sqrt(static_cast<double>(value)));
+            while (root * root > value) {
+                --root;
+            }
+            while ((root + 1) * (root + 1) <= value) {
+                ++root;
+            }
+            return root;
+        }
+
+        [[nodiscard]] constexpr static auto narrow(wide_type value) noexcept -> spl::types::price {
+            using mantissa_type = typename value_type::mantissa_type;
+            using limits        = std::numeric_limits<mantissa_type>;
+            return value_type::from_shifted(static_cast<mantissa_type>(
+                std::clamp<wide_type>(value, limits::lowest(), limits::max())));
+        }
+
+        wide_type sum_{0};     ///< Sum of the price mantissas
+        wide_type squares_{0}; ///< Sum of the squared price mantissas
+        std::size_t count_{0}; ///< Count of elements in window
     };
 
 } // namespace spl::metrics::stream
@@ -3,31 +3,33 @@
 #include "spl/metrics/timeline.hpp"
 #include "spl/result/result.hpp"
 #include "spl/types/price.hpp"
-#include "spl/container/flat_unordered_set.hpp"
 
 #include <queue>
 #include <vector>
 #include <chrono>
+#include <cstddef>
+#include <iterator>
 
 namespace spl::metrics::stream {
 
     /**
      * @brief O(log N) streaming median using dual heaps with lazy deletion
      *
-     * Maintains two heaps: max-heap for lower half, min-heap for upper half.
-     * Uses lazy deletion to handle element removal efficiently by storing removed
-     * objects in an unordered_set and cleaning them up when they reach heap tops.
+     * Maintains two heaps: max-heap for lower half, min-heap for upper half, ordered by price and then by insertion
+     * index so that every object has a single place in that order. Uses lazy deletion to handle element removal
+     * efficiently: the timeline always expires its oldest objects first, so every object is tagged with its
+     * insertion index and the ones below the expired count are cleaned up when they reach heap tops. The order tells
+     * which half an expired object was in, and the halves are balanced on their live objects only. Unlike a set of
+     * removed objects, this never allocates once the heaps have reached their largest size.
      *
-     * @tparam ObjectT The object type stored in the timeline
-     *                 Requirements: .price, .timestamp, .sequence fields
-     *                 Must be hashable (std::hash<ObjectT>) and equality comparable
+     * @tparam ObjectT The object type stored in the timeline (must have .price)
      * @tparam ContainerT The underlying container type for the timeline
      * @tparam PredicateT Predicate to extract timestamp from ObjectT
      *
      * @par Complexity
      * - Query: O(1) - returns median from heap tops
      * - Insert: O(log N) amortized - heap push + rebalance + cleanup
-     * - Remove: O(1) average - hash set insertion, O(log N) amortized for cleanup (per element)
+     * - Remove: O(1) - counter update, O(log N) amortized for cleanup (per element)
      *
      */
     template <typename ObjectT,                                     //
@@ -40,35 +42,49 @@ namespace spl::metrics::stream {
         constexpr median() noexcept = default;
 
         [[nodiscard]] constexpr auto operator()() const noexcept -> spl::types::price {
-            if (max_heap_.size() > min_heap_.size()) {
+            if (lower_size_ > upper_size_) {
                 return max_heap_.top().price;
-            } else if (max_heap_.size() < min_heap_.size()) {
+            } else if (lower_size_ < upper_size_) {
                 return min_heap_.top().price;
+            } else if (lower_size_ == 0) [[unlikely]] {
+                return value_type::zero();
             }
-            // Equal sizes: return average
-            auto const lower = max_heap_.top().price;
-            auto const upper = min_heap_.top().price;
-            return value_type::from((static_cast<double>(lower) + static_cast<double>(upper)) / 2.0);
+            // Equal sizes: return average, on the mantissas so that it is exact up to the last digit
+            auto const lower = max_heap_.top().price.shifted();
+            auto const upper = min_heap_.top().price.shifted();
+            return value_type::from_shifted(lower + (upper - lower) / 2);
         }
 
         template <typename IteratorT>
         constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
             for (auto it = begin; it != end; ++it) {
-                removed_objects_.insert(*it);
+                auto const expired = entry{it->price, expired_++};
+                auto const lower   = lower_size_ != 0 and not comparator_max{}(max_heap_.top(), expired);
+                if (lower or upper_size_ == 0) {
+                    lower_size_ -= (lower_size_ != 0);
+                } else {
+                    --upper_size_;
+                }
             }
 
             cleanup_heaps();
+            rebalance();
         }
 
         constexpr auto operator()(ObjectT const& value) noexcept -> void {
-            if (max_heap_.empty() || value.price <= max_heap_.top().price) {
-                max_heap_.push(value);
+            auto const inserted = entry{value.price, inserted_++};
+            // Routed by the live top of the lower half, or by the upper half once the lower one has expired
+            auto const lower = lower_size_ != 0 ? not comparator_max{}(max_heap_.top(), inserted)
+                                                : upper_size_ == 0 or comparator_max{}(inserted, min_heap_.top());
+            if (lower) {
+                max_heap_.push(inserted);
+                ++lower_size_;
             } else {
-                min_heap_.push(value);
+                min_heap_.push(inserted);
+                ++upper_size_;
             }
 
             rebalance();
-            cleanup_heaps();
         }
 
     private:
@@ -77,69 +93,66 @@ namespace spl::metrics::stream {
          * @complexity O(log N) per removed element
          */
         constexpr auto cleanup_heaps() noexcept -> void {
-            while (!max_heap_.empty()) {
-                if (removed_objects_.count(max_heap_.top())) {
-                    removed_objects_.erase(max_heap_.top());
-                    max_heap_.pop();
-                } else {
-                    break;
-                }
+            while (!max_heap_.empty() && max_heap_.top().index < expired_) {
+                max_heap_.pop();
             }
 
-            while (!min_heap_.empty()) {
-                if (removed_objects_.count(min_heap_.top())) {
-                    removed_objects_.erase(min_heap_.top());
-                    min_heap_.pop();
-                } else {
-                    break;
-                }
+            while (!min_heap_.empty() && min_heap_.top().index < expired_) {
+                min_heap_.pop();
             }
         }
 
         /**
-         * @brief Maintain heap size balance (sizes differ by at most 1)
+         * @brief Maintain the balance of the live objects (counts differ by at most 1), leaving live heap tops
          * @complexity O(log N)
          */
         constexpr auto rebalance() noexcept -> void {
-            if (max_heap_.size() > min_heap_.size() + 1) {
+            while (lower_size_ > upper_size_ + 1 and not max_heap_.empty()) {
                 min_heap_.push(max_heap_.top());
                 max_heap_.pop();
-            } else if (min_heap_.size() > max_heap_.size() + 1) {
+                --lower_size_;
+                ++upper_size_;
+                cleanup_heaps();
+            }
+            while (upper_size_ > lower_size_ + 1 and not min_heap_.empty()) {
                 max_heap_.push(min_heap_.top());
                 min_heap_.pop();
+                --upper_size_;
+                ++lower_size_;
+                cleanup_heaps();
             }
+            cleanup_heaps();
         }
 
+        struct entry {
+            value_type price;  ///< Price of the object
+            std::size_t index; ///< Position in the insertion order
+        };
+
         struct comparator_max {
-            [[nodiscard]] constexpr auto operator()(ObjectT const& a, ObjectT const& b) const noexcept -> bool {
-                if (a.price == b.price) [[unlikely]] {
-                    if (a.timestamp == b.timestamp) [[unlikely]] {
-                        return a.sequence > b.sequence;
-                    }
-                    return a.timestamp > b.timestamp;
+            [[nodiscard]] constexpr auto operator()(entry const& lhs, entry const& rhs) const noexcept -> bool {
+                if (lhs.price == rhs.price) [[unlikely]] {
+                    return lhs.index < rhs.index;
                 }
-                return a.price < b.price;
+                return lhs.price < rhs.price;
             }
         };
 
         struct comparator_min {
-            [[nodiscard]] constexpr auto operator()(ObjectT const& a, ObjectT const& b) const noexcept -> bool {
-                if (a.price == b.price) [[unlikely]] {
-                    if (a.timestamp == b.timestamp) [[unlikely]] {
-                        return a.sequence > b.sequence;
-                    }
-                    return a.timestamp > b.timestamp;
-                }
-                return a.price > b.price;
+            [[nodiscard]] constexpr auto operator()(entry const& lhs, entry const& rhs) const noexcept -> bool {
+                return comparator_max{}(rhs, lhs);
             }
         };
 
-        using max_heap_type = std::priority_queue<ObjectT, std::vector<ObjectT>, comparator_max>;
-        using min_heap_type = std::priority_queue<ObjectT, std::vector<ObjectT>, comparator_min>;
+        using max_heap_type = std::priority_queue<entry, std::vector<entry>, comparator_max>;
+        using min_heap_type = std::priority_queue<entry, std::vector<entry>, comparator_min>;
 
         max_heap_type max_heap_{};
         min_heap_type min_heap_{};
-        spl::container::flat_unordered_set<ObjectT> removed_objects_{};
+        std::size_t lower_size_{0}; ///< Live objects of the max-heap
+        std::size_t upper_size_{0}; ///< Live objects of the min-heap
+        std::size_t inserted_{0};   ///< Objects pushed since construction
+        std::size_t expired_{0};    ///< Objects expired since construction, always the oldest ones
     };
 
 } // namespace spl::metrics::stream
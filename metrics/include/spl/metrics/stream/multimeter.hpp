@@ -1,41 +1,68 @@
 #pragma once
 
+#include "spl/meta/list.hpp"
 #include "spl/metrics/timeline.hpp"
-#include "spl/metrics/metrics.hpp"
-#include "spl/metrics/stream/median.hpp"
-#include "spl/metrics/stream/max.hpp"
-#include "spl/metrics/stream/min.hpp"
-#include "spl/metrics/stream/mean.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/result.hpp"
+
+#include <tuple>
 
 namespace spl::metrics::stream {
 
+    /**
+     * @brief Computes the metrics of a time window listed in PoliciesT, updating every one of them in O(1) or
+     * O(log N) per event. Metrics left out of the list keep no state and cost nothing per event. WindowT is the
+     * spl::metrics::window the events expire by, e.g. `multimeter<..., window::count>{window::count{500}}`.
+     *
+     * `update` only maintains the metrics, and `snapshot` reads them, once after any number of updates: consumers
+     * sampling on a timer pay the queries, e.g. the median, at their own rate rather than on every event.
+     */
     template <typename ObjectT,                                     //
               template <typename...> class ContainerT = std::deque, //
-              typename PredicateT                     = internal::timeline_predicate>
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename PoliciesT                      = spl::metrics::policy::price,  //
+              typename WindowT                        = spl::metrics::window::time>
     struct multimeter {
+        using result_type = spl::metrics::result<PoliciesT>;
+
         template <typename... ArgsT>
         constexpr explicit multimeter(ArgsT&&... args) noexcept :
             timeline_{std::forward<ArgsT>(args)...} {}
 
         template <typename InstanceT>
         requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
-        [[nodiscard]] constexpr auto operator()(InstanceT&& instance) noexcept -> spl::metrics::metrics {
-            auto& reference      = timeline_.emplace_back(std::forward<InstanceT>(instance));
-            auto const timestamp = PredicateT{}(reference);
-            timeline_.flush(timestamp, [this](auto first, auto last) {
-                median_(first, last);
-                max_(first, last);
-                min_(first, last);
-                mean_(first, last);
+        [[nodiscard]] constexpr auto operator()(InstanceT&& instance) noexcept -> result_type {
+            update(std::forward<InstanceT>(instance));
+            return snapshot();
+        }
+
+        /**
+         * @brief Adds the event to the window and expires the ones it pushes out, without reading the metrics.
+         */
+        template <typename InstanceT>
+        requires std::is_same_v<std::decay_t<InstanceT>, ObjectT>
+        constexpr auto update(InstanceT&& instance) noexcept -> void {
+            auto& reference = timeline_.template emplace_back<false>(std::forward<InstanceT>(instance));
+            timestamp_      = PredicateT{}(reference);
+            timeline_.flush(timestamp_, [this](auto first, auto last) {
+                std::apply([&](auto&... metrics) { (metrics(first, last), ...); }, metrics_);
             });
-            emit(reference, median_, max_, min_, mean_);
-            return spl::metrics::metrics{
-                .minimum   = min_(),
-                .maximum   = max_(),
-                .median    = median_(),
-                .mean      = mean_(),
-                .timestamp = timestamp,
-            };
+            std::apply([&](auto&... metrics) { emit(reference, metrics...); }, metrics_);
+            dirty_ = true;
+        }
+
+        /**
+         * @brief Metrics of the window as of the last update, only computed again after a new one.
+         */
+        [[nodiscard]] constexpr auto snapshot() noexcept -> result_type const& {
+            if (dirty_) {
+                snapshot_.timestamp = timestamp_;
+                spl::meta::for_each<PoliciesT>([&]<typename PolicyT>(PolicyT) {
+                    PolicyT::fill(snapshot_, std::get<metric_type<PolicyT>>(metrics_));
+                });
+                dirty_ = false;
+            }
+            return snapshot_;
         }
 
     private:
@@ -44,11 +71,14 @@ namespace spl::metrics::stream {
             (std::forward<SubscribersT>(subscribers)(instance), ...);
         }
 
-        spl::metrics::timeline<ObjectT, ContainerT, PredicateT> timeline_;
-        spl::metrics::stream::median<ObjectT, ContainerT, PredicateT> median_;
-        spl::metrics::stream::max<ObjectT, ContainerT, PredicateT> max_;
-        spl::metrics::stream::min<ObjectT, ContainerT, PredicateT> min_;
-        spl::metrics::stream::mean<ObjectT, ContainerT, PredicateT> mean_;
+        template <typename PolicyT>
+        using metric_type = typename PolicyT::template stream<ObjectT, ContainerT, PredicateT>;
+
+        spl::metrics::timeline<ObjectT, ContainerT, PredicateT, WindowT> timeline_;
+        spl::meta::as_tuple<spl::meta::unique<spl::meta::transformed<metric_type, PoliciesT>>> metrics_;
+        std::chrono::nanoseconds timestamp_{}; ///< Timestamp of the last update.
+        result_type snapshot_{};               ///< Metrics as of the last snapshot.
+        bool dirty_{false};                    ///< Whether an update came after the last snapshot.
     };
 
 } // namespace spl::metrics::stream
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "spl/metrics/stream/two_stack.hpp"
+#include "spl/metrics/timeline.hpp"
+#include "spl/types/price.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace spl::metrics::stream {
+
+    /// Minimum of two prices, to aggregate a sliding window with.
+    struct lowest {
+        [[nodiscard]] constexpr auto operator()(spl::types::price lhs, spl::types::price rhs) const noexcept
+            -> spl::types::price {
+            return std::min(lhs, rhs);
+        }
+    };
+
+    /// Maximum of two prices, to aggregate a sliding window with.
+    struct highest {
+        [[nodiscard]] constexpr auto operator()(spl::types::price lhs, spl::types::price rhs) const noexcept
+            -> spl::types::price {
+            return std::max(lhs, rhs);
+        }
+    };
+
+    /**
+     * @brief O(1) amortized streaming aggregate of the price over a two_stack, e.g. the minimum or the maximum
+     *
+     * Unlike the monotonic deque of stream::min and stream::max, removals drop exactly as many prices as the timeline
+     * expired, oldest first, whatever their value. Any associative operation works, it needs no inverse.
+     *
+     * @tparam ObjectT The object type stored in the timeline (must have .price)
+     * @tparam OperationT Associative operation over two prices, e.g. stream::lowest
+     * @tparam ContainerT The underlying container type for the timeline
+     * @tparam PredicateT Predicate to extract timestamp from ObjectT
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Update (insert): O(1)
+     * - Update (remove): O(1) amortized per removed element
+     *
+     */
+    template <typename ObjectT,                                     //
+              typename OperationT,                                  //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    struct sliding {
+        using value_type = spl::types::price;
+
+        constexpr sliding() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator()() const noexcept -> value_type {
+            return std::empty(stack_) ? value_type::zero() : stack_();
+        }
+
+        template <typename IteratorT>
+        constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
+            auto count = std::size_t{0};
+            for (auto it = begin; it != end; ++it) {
+                ++count;
+            }
+            stack_.pop(count);
+        }
+
+        constexpr auto operator()(ObjectT const& value) noexcept -> void {
+            stack_.push(value.price);
+        }
+
+    private:
+        spl::metrics::stream::two_stack<value_type, OperationT> stack_{}; ///< Prices of the window, oldest first
+    };
+
+    template <typename ObjectT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    using sliding_min = sliding<ObjectT, lowest, ContainerT, PredicateT>;
+
+    template <typename ObjectT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    using sliding_max = sliding<ObjectT, highest, ContainerT, PredicateT>;
+
+} // namespace spl::metrics::stream
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "spl/metrics/timeline.hpp"
+
+#include <cstdint>
+#include <iterator>
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief O(1) streaming trade count
+     *
+     * @tparam ObjectT The object type stored in the timeline
+     * @tparam ContainerT The underlying container type for the timeline
+     * @tparam PredicateT Predicate to extract timestamp from ObjectT
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Update (insert): O(1)
+     * - Update (remove): O(1) for random access iterators, O(k) otherwise
+     *
+     */
+    template <typename ObjectT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    struct trades {
+        using value_type = std::uint64_t;
+
+        constexpr trades() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator()() const noexcept -> value_type {
+            return count_;
+        }
+
+        template <typename IteratorT>
+        constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
+            count_ -= static_cast<value_type>(std::distance(begin, end));
+        }
+
+        constexpr auto operator()(ObjectT const&) noexcept -> void {
+            ++count_;
+        }
+
+    private:
+        value_type count_{0}; ///< Count of elements in window
+    };
+
+} // namespace spl::metrics::stream
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief FIFO queue that aggregates its values with an associative operation, e.g. the minimum, the maximum or a
+     * sum, without needing an inverse to remove them.
+     *
+     * Values are pushed onto a back stack, which keeps the aggregate of all of them. The front stack holds, for each
+     * of its values, the aggregate of that value and those pushed after it down to the back stack, so the aggregate
+     * of the queue combines the top of the front stack with the aggregate of the back stack. Popping from an empty
+     * front stack first moves the back stack onto it, computing those suffix aggregates. Both stacks are contiguous
+     * and keep their capacity, so a steady window allocates nothing.
+     *
+     * @tparam ValueT The aggregated value type
+     * @tparam OperationT Associative binary operation, called as OperationT{}(older, newer)
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Push: O(1)
+     * - Pop: O(1) amortized, O(N) when the back stack is moved onto the front one
+     */
+    template <typename ValueT, typename OperationT>
+    struct two_stack {
+        using value_type = ValueT;
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return std::empty(front_) and std::empty(back_);
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+            return std::size(front_) + std::size(back_);
+        }
+
+        /**
+         * @brief Aggregate of the values in the queue, which must not be empty.
+         */
+        [[nodiscard]] constexpr auto operator()() const noexcept -> value_type {
+            if (std::empty(front_)) {
+                return aggregate_;
+            }
+            if (std::empty(back_)) {
+                return front_.back();
+            }
+            return OperationT{}(front_.back(), aggregate_);
+        }
+
+        constexpr auto push(value_type const& value) noexcept -> void {
+            aggregate_ = std::empty(back_) ? value : OperationT{}(aggregate_, value);
+            back_.push_back(value);
+        }
+
+        /**
+         * @brief Removes the `count` oldest values, or all of them if there are fewer.
+         */
+        constexpr auto pop(std::size_t count = 1) noexcept -> void {
+            while (count > 0 and not empty()) {
+                if (std::empty(front_)) {
+                    flip();
+                }
+                auto const removed = std::min(count, std::size(front_));
+                front_.resize(std::size(front_) - removed);
+                count -= removed;
+            }
+        }
+
+        constexpr auto clear() noexcept -> void {
+            front_.clear();
+            back_.clear();
+        }
+
+    private:
+        /**
+         * @brief Moves the back stack onto the front one, newest value first, so that the oldest ends up on top.
+         */
+        constexpr auto flip() noexcept -> void {
+            auto aggregate = back_.back();
+            front_.push_back(aggregate);
+            for (auto it = std::next(std::rbegin(back_)); it != std::rend(back_); ++it) {
+                aggregate = OperationT{}(*it, aggregate);
+                front_.push_back(aggregate);
+            }
+            back_.clear();
+        }
+
+        std::vector<value_type> front_{}; ///< Suffix aggregates, the oldest value's on top.
+        std::vector<value_type> back_{};  ///< Values pushed since the last flip, the newest on top.
+        value_type aggregate_{};          ///< Aggregate of the back stack.
+    };
+
+} // namespace spl::metrics::stream
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "spl/metrics/timeline.hpp"
+#include "spl/types/price.hpp"
+#include "spl/types/quantity.hpp"
+
+#include <limits>
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief O(1) streaming base and quote volume, with the base volume split by aggressor side
+     *
+     * Maintains running sums of the quantity and price × quantity mantissas in 128 bits, so that adding and removing
+     * trades is exact. Totals that no longer fit the 64-bit mantissa of the result saturate at its maximum.
+     *
+     * @tparam ObjectT The object type stored in the timeline (must have .price, .quantity and .side, an enumeration
+     *                 with buy and sell)
+     * @tparam ContainerT The underlying container type for the timeline
+     * @tparam PredicateT Predicate to extract timestamp from ObjectT
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Update (insert): O(1)
+     * - Update (remove): O(1) per removed element
+     *
+     */
+    template <typename ObjectT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    struct volume {
+        using wide_type = __int128_t;
+
+        struct value_type {
+            spl::types::quantity base; ///< Sum of quantities
+            spl::types::price quote;   ///< Sum of price × quantity
+            spl::types::quantity buy;  ///< Sum of quantities a buyer aggressed
+            spl::types::quantity sell; ///< Sum of quantities a seller aggressed
+        };
+
+        constexpr volume() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator()() const noexcept -> value_type {
+            using rounding_mode = typename spl::types::price::rounding_mode;
+            auto const scale    = static_cast<wide_type>(spl::types::quantity::scale());
+            auto const quote    = spl::types::price::round_value<rounding_mode::half_up>(quote_, scale);
+            return value_type{
+                .base  = narrow<spl::types::quantity>(base_),
+                .quote = narrow<spl::types::price>(quote),
+                .buy   = narrow<spl::types::quantity>(buy_),
+                .sell  = narrow<spl::types::quantity>(sell_),
+            };
+        }
+
+        template <typename IteratorT>
+        constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
+            for (auto it = begin; it != end; ++it) {
+                accumulate<-1>(*it);
+            }
+        }
+
+        constexpr auto operator()(ObjectT const& value) noexcept -> void {
+            accumulate<1>(value);
+        }
+
+    private:
+        template <int SignV>
+        constexpr auto accumulate(ObjectT const& value) noexcept -> void {
+            using side_type     = decltype(value.side);
+            auto const quantity = static_cast<wide_type>(value.quantity.shifted()) * SignV;
+            base_ += quantity;
+            quote_ += quantity * value.price.shifted();
+            if (value.side == side_type::buy) {
+                buy_ += quantity;
+            } else if (value.side == side_type::sell) {
+                sell_ += quantity;
+            }
+        }
+
+        template <typename DecimalT>
+        [[nodiscard]] constexpr static auto narrow(wide_type value) noexcept -> DecimalT {
+            using mantissa_type = typename DecimalT::mantissa_type;
+            constexpr auto high = static_cast<wide_type>(std::numeric_limits<mantissa_type>::max());
+            constexpr auto low  = static_cast<wide_type>(std::numeric_limits<mantissa_type>::lowest());
+            return DecimalT::from_shifted(static_cast<mantissa_type>(value > high ? high : value < low ? low : value));
+        }
+
+        wide_type base_{0};  ///< Sum of quantity mantissas
+        wide_type quote_{0}; ///< Sum of price × quantity mantissas, at the scale of both
+        wide_type buy_{0};   ///< Sum of quantity mantissas of buyer-aggressed trades
+        wide_type sell_{0};  ///< Sum of quantity mantissas of seller-aggressed trades
+    };
+
+} // namespace spl::metrics::stream
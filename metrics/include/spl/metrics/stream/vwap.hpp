@@ -0,0 +1,63 @@
+#pragma once
+
+#include "spl/metrics/timeline.hpp"
+#include "spl/types/price.hpp"
+#include "spl/types/quantity.hpp"
+
+namespace spl::metrics::stream {
+
+    /**
+     * @brief O(1) streaming volume-weighted average price
+     *
+     * Maintains the running sums of price × quantity and of quantity on the mantissas, in 128 bits, so that
+     * sliding over hours of trades never loses a digit. The division happens once per query, rounded half up.
+     * Formula: vwap = sum(price × quantity) / sum(quantity)
+     *
+     * @tparam ObjectT The object type stored in the timeline (must have .price and .quantity)
+     * @tparam ContainerT The underlying container type for the timeline
+     * @tparam PredicateT Predicate to extract timestamp from ObjectT
+     *
+     * @par Complexity
+     * - Query: O(1)
+     * - Update (insert): O(1)
+     * - Update (remove): O(1) per removed element
+     *
+     */
+    template <typename ObjectT,                                     //
+              template <typename...> class ContainerT = std::deque, //
+              typename PredicateT                     = internal::timeline_predicate>
+    struct vwap {
+        using value_type = spl::types::price;
+        using wide_type  = __int128_t;
+
+        constexpr vwap() noexcept = default;
+
+        [[nodiscard]] constexpr auto operator()() const noexcept -> spl::types::price {
+            if (volume_ <= 0) [[unlikely]] {
+                return value_type::zero();
+            }
+            using rounding_mode = typename value_type::rounding_mode;
+            using mantissa_type = typename value_type::mantissa_type;
+            auto const rounded  = value_type::round_value<rounding_mode::half_up>(notional_, volume_);
+            return value_type::from_shifted(static_cast<mantissa_type>(rounded));
+        }
+
+        template <typename IteratorT>
+        constexpr auto operator()(IteratorT begin, IteratorT end) noexcept -> void {
+            for (auto it = begin; it != end; ++it) {
+                notional_ -= static_cast<wide_type>(it->price.shifted()) * it->quantity.shifted();
+                volume_ -= it->quantity.shifted();
+            }
+        }
+
+        constexpr auto operator()(ObjectT const& value) noexcept -> void {
+            notional_ += static_cast<wide_type>(value.price.shifted()) * value.quantity.shifted();
+            volume_ += value.quantity.shifted();
+        }
+
+    private:
+        wide_type notional_{0}; ///< Sum of price × quantity mantissas, at the scale of both
+        wide_type volume_{0};   ///< Sum of quantity mantissas
+    };
+
+} // namespace spl::metrics::stream
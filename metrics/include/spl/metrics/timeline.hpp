@@ -1,10 +1,13 @@
 #pragma once
 
+#include "spl/metrics/window.hpp"
+
 #include <deque>
 #include <chrono>
 #include <algorithm>
 #include <utility>
 #include <iterator>
+#include <type_traits>
 
 namespace spl::metrics {
 
@@ -17,9 +20,14 @@ namespace spl::metrics {
         };
     } // namespace internal
 
+    /**
+     * @brief Events of a sliding window in arrival order. The WindowT policy decides which ones have expired, see
+     * spl::metrics::window; the default keeps those of the last period.
+     */
     template <typename T,                                           //
               template <typename...> class ContainerT = std::deque, //
-              typename PredicateT                     = internal::timeline_predicate>
+              typename PredicateT                     = internal::timeline_predicate, //
+              typename WindowT                        = spl::metrics::window::time>
     struct timeline {
         using value_type      = T;
         using duration_type   = std::chrono::nanoseconds;
@@ -29,8 +37,13 @@ namespace spl::metrics {
         using reference       = typename container_type::reference;
         using const_reference = typename container_type::const_reference;
         using predicate_type  = PredicateT;
+        using window_type     = WindowT;
+
+        constexpr timeline(duration_type period) noexcept
+        requires std::is_same_v<WindowT, spl::metrics::window::time>
+            : window_{period} {}
 
-        constexpr timeline(duration_type period) noexcept : period_{period} {}
+        constexpr explicit timeline(window_type window) noexcept : window_{window} {}
 
         [[nodiscard]] constexpr auto duration() const noexcept -> duration_type {
             if (std::size(values_) < 2) {
@@ -107,6 +120,7 @@ namespace spl::metrics {
         template <bool FlushV, typename... ArgsT>
         [[nodiscard]] constexpr auto emplace_back(ArgsT&&... args) noexcept -> reference {
             values_.emplace_back(std::forward<ArgsT>(args)...);
+            window_.push(values_.back());
             if constexpr (FlushV) {
                 flush();
             }
@@ -114,6 +128,7 @@ namespace spl::metrics {
         }
 
         constexpr auto pop_front() noexcept -> void {
+            window_.pop(values_.front());
             if constexpr (requires { values_.pop_front(); }) {
                 values_.pop_front();
             } else {
@@ -122,6 +137,7 @@ namespace spl::metrics {
         }
 
         constexpr auto clear() noexcept -> void {
+            window_.clear();
             values_.clear();
         }
 
@@ -129,42 +145,23 @@ namespace spl::metrics {
             if (std::empty(values_)) {
                 return;
             }
-
-            if (duration() < period_) [[likely]] {
-                return;
-            }
-
             return flush(predicate_type{}(values_.back()));
         }
 
         constexpr auto flush(duration_type last) noexcept -> void {
-            auto const first    = predicate_type{}(values_.front());
-            auto const duration = last - first;
-            if (duration < period_) [[likely]] {
-                return;
-            }
-
-            auto const iter = std::find_if(std::cbegin(values_), std::cend(values_),
-                                           [&](auto&& value) { return (last - predicate_type{}(value)) < period_; });
-            values_.erase(std::begin(values_), iter);
+            flush(last, [](auto, auto) {});
         }
 
+        /**
+         * @brief Erases the events the window expired as of `last`, handing them to the handler first.
+         */
         template <typename HandlerT>
         constexpr auto flush(duration_type last, HandlerT&& handler) noexcept -> void {
-            auto const first    = predicate_type{}(values_.front());
-            auto const duration = last - first;
-            if (duration < period_) [[likely]] {
-                return;
-            }
-
-            auto const iter = std::find_if(std::begin(values_), std::end(values_),
-                                           [&](auto&& value) { return (last - predicate_type{}(value)) < period_; });
-            handler(std::begin(values_), iter);
-            values_.erase(std::begin(values_), iter);
+            window_.template flush<predicate_type>(values_, last, std::forward<HandlerT>(handler));
         }
 
     private:
-        duration_type period_;
+        window_type window_;
         container_type values_{};
     };
 
@@ -4,7 +4,8 @@ namespace spl::metrics {
 
     enum class type {
         scan,
-        stream
+        stream,
+        sketch
     };
 
 } // namespace spl::metrics
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "spl/types/quantity.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+
+/**
+ * @brief Window policies of a spl::metrics::timeline: which of the stored events have expired. A policy sees every
+ * event pushed, popped or cleared, and on flush hands the expired ones, always the oldest, to the handler before they
+ * are erased.
+ */
+namespace spl::metrics::window {
+
+    /**
+     * @brief The events of the last `period`, the default. Memory grows with the event rate.
+     */
+    struct time {
+        std::chrono::nanoseconds period; ///< Length of the window.
+
+        template <typename ObjectT>
+        constexpr auto push(ObjectT const&) noexcept -> void {}
+
+        template <typename ObjectT>
+        constexpr auto pop(ObjectT const&) noexcept -> void {}
+
+        constexpr auto clear() noexcept -> void {}
+
+        template <typename PredicateT, typename ContainerT, typename HandlerT>
+        constexpr auto flush(ContainerT& values, std::chrono::nanoseconds last, HandlerT&& handler) noexcept -> void {
+            auto const first    = PredicateT{}(values.front());
+            auto const duration = last - first;
+            if (duration < period) [[likely]] {
+                return;
+            }
+
+            auto const iter = std::find_if(std::begin(values), std::end(values),
+                                           [&](auto&& value) { return (last - PredicateT{}(value)) < period; });
+            handler(std::begin(values), iter);
+            values.erase(std::begin(values), iter);
+        }
+    };
+
+    /**
+     * @brief The last `size` events, whatever their timestamps.
+     */
+    struct count {
+        std::size_t size; ///< Number of events in the window.
+
+        template <typename ObjectT>
+        constexpr auto push(ObjectT const&) noexcept -> void {}
+
+        template <typename ObjectT>
+        constexpr auto pop(ObjectT const&) noexcept -> void {}
+
+        constexpr auto clear() noexcept -> void {}
+
+        template <typename PredicateT, typename ContainerT, typename HandlerT>
+        constexpr auto flush(ContainerT& values, std::chrono::nanoseconds, HandlerT&& handler) noexcept -> void {
+            if (std::size(values) <= size) [[likely]] {
+                return;
+            }
+
+            auto const iter = std::next(std::begin(values), static_cast<std::ptrdiff_t>(std::size(values) - size));
+            handler(std::begin(values), iter);
+            values.erase(std::begin(values), iter);
+        }
+    };
+
+    /**
+     * @brief The last events of the stream adding up to `amount` of quantity, i.e. the newest ones without which
+     * less than `amount` would have traded, and at most `capacity` of them so that tiny trades cannot grow it
+     * without bound.
+     */
+    struct volume {
+        spl::types::quantity amount;                ///< Traded quantity the window covers.
+        std::size_t capacity{std::size_t{1} << 16}; ///< Maximum number of events in the window.
+        __int128_t total{0};                        ///< Sum of the quantity mantissas of the events stored.
+
+        template <typename ObjectT>
+        constexpr auto push(ObjectT const& value) noexcept -> void {
+            total += value.quantity.shifted();
+        }
+
+        template <typename ObjectT>
+        constexpr auto pop(ObjectT const& value) noexcept -> void {
+            total -= value.quantity.shifted();
+        }
+
+        constexpr auto clear() noexcept -> void {
+            total = 0;
+        }
+
+        template <typename PredicateT, typename ContainerT, typename HandlerT>
+        constexpr auto flush(ContainerT& values, std::chrono::nanoseconds, HandlerT&& handler) noexcept -> void {
+            auto const target = static_cast<__int128_t>(amount.shifted());
+            auto stored       = std::size(values);
+            auto iter         = std::begin(values);
+            while (stored > 1 and (stored > capacity or total - iter->quantity.shifted() >= target)) {
+                total -= iter->quantity.shifted();
+                --stored;
+                ++iter;
+            }
+            if (iter == std::begin(values)) [[likely]] {
+                return;
+            }
+
+            handler(std::begin(values), iter);
+            values.erase(std::begin(values), iter);
+        }
+    };
+
+    /**
+     * @brief The events of the last `period`, but never more than the last `size` of them, so that a burst cannot
+     * grow the window without bound.
+     */
+    struct capped {
+        std::chrono::nanoseconds period; ///< Length of the window.
+        std::size_t size;                ///< Maximum number of events in the window.
+
+        template <typename ObjectT>
+        constexpr auto push(ObjectT const&) noexcept -> void {}
+
+        template <typename ObjectT>
+        constexpr auto pop(ObjectT const&) noexcept -> void {}
+
+        constexpr auto clear() noexcept -> void {}
+
+        template <typename PredicateT, typename ContainerT, typename HandlerT>
+        constexpr auto flush(ContainerT& values, std::chrono::nanoseconds last, HandlerT&& handler) noexcept -> void {
+            auto const stored = std::size(values);
+            if (stored <= size and (last - PredicateT{}(values.front())) < period) [[likely]] {
+                return;
+            }
+
+            auto const excess = static_cast<std::ptrdiff_t>(stored > size ? stored - size : 0);
+            auto const iter   = std::find_if(std::next(std::begin(values), excess), std::end(values),
+                                             [&](auto&& value) { return (last - PredicateT{}(value)) < period; });
+            handler(std::begin(values), iter);
+            values.erase(std::begin(values), iter);
+        }
+    };
+
+} // namespace spl::metrics::window
@@ -0,0 +1,140 @@
+#include "generator.hpp"
+#include "spl/metrics/monoid.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/stream/aggregate.hpp"
+#include "spl/metrics/stream/flat_fat.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/metrics/timeline.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <string>
+
+using namespace spl::protocol;
+
+using trade_summary = feeder::trade::trade_summary;
+using timeline_type = spl::metrics::timeline<trade_summary>;
+
+namespace {
+
+    // Concatenation, associative but not commutative, so that any reordering shows
+    struct concatenation {
+        using value_type = std::string;
+
+        static auto identity() -> value_type {
+            return {};
+        }
+
+        static auto combine(value_type const& lhs, value_type const& rhs) -> value_type {
+            return lhs + rhs;
+        }
+    };
+
+    template <typename MonoidT, typename ContainerT>
+    auto fold(ContainerT const& values) -> typename MonoidT::value_type {
+        auto result = MonoidT::identity();
+        for (auto const& value : values) {
+            result = MonoidT::combine(result, MonoidT::lift(value));
+        }
+        return result;
+    }
+
+} // namespace
+
+static_assert(spl::concepts::monoid<concatenation>);
+static_assert(spl::concepts::monoid_of<spl::metrics::monoid::ohlc, trade_summary>);
+static_assert(not spl::concepts::monoid_of<concatenation, trade_summary>);
+
+TEST(AggregateTest, FlatFatKeepsTheOrderWhileWrappingAndGrowing) {
+    auto tree     = spl::metrics::stream::flat_fat<concatenation>{};
+    auto expected = std::deque<std::string>{};
+    auto rng      = std::mt19937{42};
+    auto action   = std::uniform_int_distribution<int>{0, 4};
+    auto letter   = std::uniform_int_distribution<int>{'a', 'z'};
+
+    EXPECT_EQ(tree(), std::string{});
+    for (auto step = 0; step < 5'000; ++step) {
+        // Pops are rarer than pushes for the first half and as frequent for the second, so the ring wraps and grows
+        if (action(rng) < (step < 2'500 ? 1 : 2) and not std::empty(expected)) {
+            tree.pop();
+            expected.pop_front();
+        } else {
+            auto const value = std::string(1, static_cast<char>(letter(rng)));
+            tree.push(value);
+            expected.push_back(value);
+        }
+
+        ASSERT_EQ(std::size(tree), std::size(expected));
+        auto joined = std::string{};
+        for (auto const& value : expected) {
+            joined += value;
+        }
+        ASSERT_EQ(tree(), joined);
+    }
+    EXPECT_GE(tree.capacity(), std::size(expected));
+}
+
+TEST(AggregateTest, MonoidsMatchAFoldOfTheWindow) {
+    auto timeline = timeline_type{std::chrono::milliseconds(20)};
+    auto ohlc     = spl::metrics::stream::aggregate<trade_summary, spl::metrics::monoid::ohlc>{};
+    auto sides    = spl::metrics::stream::aggregate<trade_summary, spl::metrics::monoid::sides>{};
+    auto volume   = spl::metrics::stream::aggregate<trade_summary, spl::metrics::monoid::volume>{};
+
+    // Trades close to 10, 1 ms apart on average and mostly sold, so that every side and price moves the aggregates
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.count             = 5'000;
+    config.min_price         = 9.99;
+    config.max_price         = 10.01;
+    config.events_per_second = 1'000.0;
+    config.buy_ratio         = 0.4;
+    config.min_quantity      = 0.000001;
+    config.max_quantity      = 1.0;
+    auto const trades        = spl::metrics::benchmark::trade_generator{config}.generate();
+
+    EXPECT_EQ(ohlc().trades, 0);
+    for (auto const& generated : trades) {
+        auto const& trade = timeline.emplace_back<false>(generated);
+        timeline.flush(trade.timestamp, [&](auto begin, auto end) {
+            ohlc(begin, end);
+            sides(begin, end);
+            volume(begin, end);
+        });
+        ohlc(trade);
+        sides(trade);
+        volume(trade);
+
+        ASSERT_EQ(ohlc(), fold<spl::metrics::monoid::ohlc>(timeline));
+        ASSERT_EQ(sides(), fold<spl::metrics::monoid::sides>(timeline));
+        ASSERT_EQ(volume(), fold<spl::metrics::monoid::volume>(timeline));
+    }
+}
+
+TEST(AggregateTest, PoliciesFillTheWindowAggregates) {
+    using policies = spl::meta::list<spl::metrics::policy::ohlc, spl::metrics::policy::sides>;
+    auto meter     = spl::metrics::stream::multimeter<trade_summary, std::deque,
+                                                      spl::metrics::internal::timeline_predicate, policies>{
+        std::chrono::seconds(2)};
+
+    auto const trade = [](common::aggressor_side side, spl::types::price price, std::int64_t seconds) {
+        return trade_summary{
+            .side = side, .price = price, .quantity = 1.0_q, .timestamp = std::chrono::seconds(seconds)};
+    };
+    std::ignore = meter(trade(common::aggressor_side::buy, 100.0_p, 1));
+    std::ignore = meter(trade(common::aggressor_side::sell, 120.0_p, 2));
+    std::ignore = meter(trade(common::aggressor_side::sell, 90.0_p, 2));
+    auto const result = meter(trade(common::aggressor_side::buy, 110.0_p, 3));
+
+    // The first trade expired, so the window opens at the second one
+    EXPECT_EQ(result.open, 120.0_p);
+    EXPECT_EQ(result.high, 120.0_p);
+    EXPECT_EQ(result.low, 90.0_p);
+    EXPECT_EQ(result.close, 110.0_p);
+    EXPECT_EQ(result.buy_trades, 1);
+    EXPECT_EQ(result.sell_trades, 2);
+
+    spl::metrics::metrics const record = result;
+    EXPECT_EQ(record.minimum, 90.0_p);
+    EXPECT_EQ(record.maximum, 120.0_p);
+}
@@ -0,0 +1,76 @@
+#include "generator.hpp"
+#include "spl/core/allocation.hpp"
+#include "spl/container/ring.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <span>
+#include <vector>
+
+SPL_ALLOCATION_HOOK()
+
+using trade_summary = spl::protocol::feeder::trade::trade_summary;
+using multimeter    = spl::metrics::stream::multimeter<trade_summary, spl::container::ring>;
+
+// Uniform prices around 100 with one trade every millisecond on average, the first 20k warm the multimeter up
+static auto generate() -> std::vector<trade_summary> {
+    auto const config = spl::metrics::benchmark::trade_generator::config{
+        .count = 30 * 1000, .min_price = 95.0, .max_price = 105.0, .events_per_second = 1000.0};
+    return spl::metrics::benchmark::trade_generator{config}.generate();
+}
+
+TEST(AllocationTest, TrackerCountsTheHook) {
+    auto tracker = spl::allocation::tracker{};
+    {
+        auto const values = std::vector<int>(128);
+        EXPECT_EQ(tracker.allocations(), 1);
+        EXPECT_EQ(tracker.bytes(), 128 * sizeof(int));
+    }
+    EXPECT_EQ(tracker.deallocations(), 1);
+
+    tracker.reset();
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(tracker.deallocations(), 0);
+}
+
+TEST(AllocationTest, StreamMultimeterSteadyStateDoesNotAllocate) {
+    constexpr auto window = std::chrono::seconds{1};
+
+    auto const trades   = generate();
+    auto const warmup   = std::span{trades}.first(20 * 1000);
+    auto const measured = std::span{trades}.subspan(20 * 1000);
+
+    auto meter = multimeter{window};
+    for (auto const& trade : warmup) {
+        std::ignore = meter(trade);
+    }
+
+    auto const tracker = spl::allocation::tracker{};
+    for (auto const& trade : measured) {
+        std::ignore = meter(trade);
+    }
+    EXPECT_EQ(tracker.allocations(), 0);
+    EXPECT_EQ(tracker.deallocations(), 0);
+}
+
+TEST(AllocationTest, StreamMultimeterOverDequeAllocates) {
+    constexpr auto window = std::chrono::seconds{1};
+
+    auto const trades   = generate();
+    auto const warmup   = std::span{trades}.first(20 * 1000);
+    auto const measured = std::span{trades}.subspan(20 * 1000);
+
+    auto meter = spl::metrics::stream::multimeter<trade_summary>{window};
+    for (auto const& trade : warmup) {
+        std::ignore = meter(trade);
+    }
+
+    // std::deque frees and allocates a block every few hundred trades of a sliding window
+    auto const tracker = spl::allocation::tracker{};
+    for (auto const& trade : measured) {
+        std::ignore = meter(trade);
+    }
+    EXPECT_GT(tracker.allocations(), 0);
+}
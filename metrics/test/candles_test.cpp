@@ -0,0 +1,165 @@
+#include "generator.hpp"
+#include "spl/metrics/candles.hpp"
+#include "spl/protocol/feeder/candlestick/candlestick.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+
+using namespace spl::protocol;
+
+using trade_summary = feeder::trade::trade_summary;
+using candlestick   = feeder::candlestick::candlestick;
+
+template <std::size_t IntervalsV>
+using candles_type = spl::metrics::candles<trade_summary, candlestick, IntervalsV>;
+
+namespace {
+
+    auto trade(spl::types::price price, spl::types::quantity quantity, std::chrono::nanoseconds timestamp,
+               common::sequence sequence = 0) -> trade_summary {
+        return trade_summary{
+            .side      = common::aggressor_side::buy,
+            .price     = price,
+            .quantity  = quantity,
+            .sequence  = sequence,
+            .timestamp = timestamp,
+        };
+    }
+
+    template <std::size_t IntervalsV>
+    auto replay(candles_type<IntervalsV>& builder, std::vector<trade_summary> const& trades)
+        -> std::vector<candlestick> {
+        auto emitted = std::vector<candlestick>{};
+        for (auto const& value : trades) {
+            builder(value, [&](candlestick const& candle) { emitted.push_back(candle); });
+        }
+        return emitted;
+    }
+
+    auto completed(std::vector<candlestick> const& emitted, std::chrono::nanoseconds interval)
+        -> std::vector<candlestick> {
+        auto result = std::vector<candlestick>{};
+        for (auto const& candle : emitted) {
+            if (candle.complete and candle.ending - candle.starting == interval) {
+                result.push_back(candle);
+            }
+        }
+        return result;
+    }
+
+} // namespace
+
+TEST(CandlesTest, EmitsPartialUpdatesUntilTheCandleCloses) {
+    auto builder = candles_type<1>{{std::chrono::seconds(1)}};
+    auto emitted = replay(builder, {
+                                       trade(100.0_p, 1.0_q, std::chrono::milliseconds(1'100), 1),
+                                       trade(105.0_p, 2.0_q, std::chrono::milliseconds(1'500), 2),
+                                       trade(95.0_p, 1.0_q, std::chrono::milliseconds(1'900), 3),
+                                       trade(101.0_p, 1.0_q, std::chrono::milliseconds(2'000), 4),
+                                   });
+
+    ASSERT_EQ(std::size(emitted), 5);
+    EXPECT_FALSE(emitted[0].complete);
+    EXPECT_EQ(emitted[1].high, 105.0_p);
+    EXPECT_FALSE(emitted[2].complete);
+
+    auto const& closed = emitted[3];
+    EXPECT_TRUE(closed.complete);
+    EXPECT_EQ(closed.open, 100.0_p);
+    EXPECT_EQ(closed.high, 105.0_p);
+    EXPECT_EQ(closed.low, 95.0_p);
+    EXPECT_EQ(closed.close, 95.0_p);
+    EXPECT_EQ(closed.volume, 4.0_q);
+    EXPECT_EQ(closed.trades, 3);
+    EXPECT_EQ(closed.sequence, 3);
+    EXPECT_EQ(closed.starting, std::chrono::seconds(1));
+    EXPECT_EQ(closed.ending, std::chrono::seconds(2));
+
+    EXPECT_FALSE(emitted[4].complete);
+    EXPECT_EQ(emitted[4].open, 101.0_p);
+    EXPECT_EQ(emitted[4].starting, std::chrono::seconds(2));
+}
+
+TEST(CandlesTest, ClosesWithoutATrade) {
+    auto builder = candles_type<2>{{std::chrono::seconds(1), std::chrono::seconds(10)}};
+    std::ignore  = replay(builder, {trade(100.0_p, 1.0_q, std::chrono::milliseconds(500))});
+
+    auto emitted = std::vector<candlestick>{};
+    builder.close(std::chrono::seconds(1), [&](candlestick const& candle) { emitted.push_back(candle); });
+    ASSERT_EQ(std::size(emitted), 1);
+    EXPECT_TRUE(emitted[0].complete);
+    EXPECT_EQ(emitted[0].ending, std::chrono::seconds(1));
+
+    builder.close(std::chrono::seconds(10), [&](candlestick const& candle) { emitted.push_back(candle); });
+    ASSERT_EQ(std::size(emitted), 2);
+    EXPECT_TRUE(emitted[1].complete);
+    EXPECT_EQ(emitted[1].starting, std::chrono::seconds(0));
+    EXPECT_EQ(emitted[1].ending, std::chrono::seconds(10));
+    EXPECT_EQ(emitted[1].close, 100.0_p);
+}
+
+TEST(CandlesTest, AlignsDailyCandlesToMidnight) {
+    auto const day    = std::chrono::days(1);
+    auto const noon   = std::chrono::days(20'000) + std::chrono::hours(12);
+    auto builder      = candles_type<2>{{std::chrono::seconds(1), day}};
+    auto const update = replay(builder, {trade(100.0_p, 1.0_q, noon)});
+
+    ASSERT_EQ(std::size(update), 2);
+    EXPECT_EQ(update[1].starting, std::chrono::days(20'000));
+    EXPECT_EQ(update[1].ending, std::chrono::days(20'001));
+    EXPECT_FALSE(update[1].complete);
+}
+
+TEST(CandlesTest, RollUpsMatchCandlesBuiltFromTheTrades) {
+    // Trades of random sizes, 0.7 s apart on average
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.count             = 5'000;
+    config.min_price         = 95.0;
+    config.max_price         = 105.0;
+    config.events_per_second = 1.0 / 0.7;
+    config.arrivals          = spl::metrics::benchmark::arrival_model::poisson;
+    config.min_quantity      = 0.000001;
+    config.max_quantity      = 1.0;
+    auto const trades        = spl::metrics::benchmark::trade_generator{config}.generate();
+
+    auto const intervals = std::array<std::chrono::nanoseconds, 3>{std::chrono::seconds(1), std::chrono::seconds(15),
+                                                                   std::chrono::minutes(1)};
+    auto rolled          = candles_type<3>{intervals};
+    auto const emitted   = replay(rolled, trades);
+    for (auto const interval : intervals) {
+        auto direct         = candles_type<1>{{interval}};
+        auto const expected = completed(replay(direct, trades), interval);
+        auto const actual   = completed(emitted, interval);
+        ASSERT_FALSE(std::empty(expected));
+        ASSERT_EQ(std::size(actual), std::size(expected));
+        for (std::size_t index = 0; index < std::size(expected); ++index) {
+            EXPECT_EQ(actual[index].open, expected[index].open);
+            EXPECT_EQ(actual[index].high, expected[index].high);
+            EXPECT_EQ(actual[index].low, expected[index].low);
+            EXPECT_EQ(actual[index].close, expected[index].close);
+            EXPECT_EQ(actual[index].volume, expected[index].volume);
+            EXPECT_EQ(actual[index].trades, expected[index].trades);
+            EXPECT_EQ(actual[index].starting, expected[index].starting);
+            EXPECT_EQ(actual[index].sequence, expected[index].sequence);
+        }
+    }
+
+    // The partial update of every interval always covers the same trades as the finest candles it rolls up
+    auto builder = candles_type<3>{intervals};
+    auto volume  = spl::types::quantity::zero();
+    auto minute  = std::chrono::nanoseconds::zero();
+    for (auto const& value : trades) {
+        if (auto const current = value.timestamp - value.timestamp % std::chrono::minutes(1); current != minute) {
+            minute = current;
+            volume = spl::types::quantity::zero();
+        }
+        volume += value.quantity;
+        auto last = candlestick{};
+        builder(value, [&](candlestick const& candle) { last = candle; });
+        EXPECT_FALSE(last.complete);
+        EXPECT_EQ(last.volume, volume);
+        EXPECT_EQ(last.starting, minute);
+    }
+}
@@ -0,0 +1,98 @@
+#include "generator.hpp"
+#include "spl/container/ring.hpp"
+#include "spl/metrics/stream/horizons.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <vector>
+
+using namespace spl::protocol;
+
+using trade_summary  = feeder::trade::trade_summary;
+using predicate_type = spl::metrics::internal::timeline_predicate;
+
+// Trades around 100 with exponential gaps of `spacing` on average, so that every window expires a few at a time
+static auto generate(std::size_t count, std::chrono::nanoseconds spacing, std::uint32_t seed)
+    -> std::vector<trade_summary> {
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.seed              = seed;
+    config.count             = count;
+    config.min_price         = 95.0;
+    config.max_price         = 105.0;
+    config.events_per_second = 1e9 / static_cast<double>(spacing.count());
+    config.arrivals          = spl::metrics::benchmark::arrival_model::poisson;
+    config.min_quantity      = 0.000001;
+    config.max_quantity      = 1.0;
+    return spl::metrics::benchmark::trade_generator{config}.generate();
+}
+
+static auto equal(spl::metrics::result<spl::metrics::policy::all> const& lhs,
+                  spl::metrics::result<spl::metrics::policy::all> const& rhs) -> bool {
+    return lhs.minimum == rhs.minimum and lhs.maximum == rhs.maximum and lhs.median == rhs.median and
+           lhs.mean == rhs.mean and lhs.timestamp == rhs.timestamp and lhs.vwap == rhs.vwap and
+           lhs.volume == rhs.volume and lhs.notional == rhs.notional and lhs.buy_volume == rhs.buy_volume and
+           lhs.sell_volume == rhs.sell_volume and lhs.trades == rhs.trades and lhs.variance == rhs.variance and
+           lhs.deviation == rhs.deviation and lhs.open == rhs.open and lhs.close == rhs.close and
+           lhs.buy_trades == rhs.buy_trades and lhs.sell_trades == rhs.sell_trades;
+}
+
+TEST(HorizonsTest, MatchesOneMultimeterPerWindow) {
+    using multimeter_type = spl::metrics::stream::multimeter<trade_summary, std::deque, predicate_type,
+                                                             spl::metrics::policy::all>;
+    using horizons_type   = spl::metrics::stream::horizons<trade_summary, 3, std::deque, predicate_type,
+                                                           spl::metrics::policy::all>;
+
+    constexpr auto periods = std::array<std::chrono::nanoseconds, 3>{
+        std::chrono::milliseconds{100}, std::chrono::seconds{1}, std::chrono::seconds{5}};
+
+    auto multimeters = std::array{multimeter_type{periods[0]}, multimeter_type{periods[1]},
+                                  multimeter_type{periods[2]}};
+    auto horizons    = horizons_type{periods};
+
+    for (auto const& trade : generate(50'000, std::chrono::milliseconds{1}, 42)) {
+        auto const results = horizons(trade);
+        for (std::size_t index = 0; index < std::size(periods); ++index) {
+            auto const expected = multimeters[index](trade);
+            ASSERT_TRUE(equal(results[index], expected)) << "window " << index << " at " << trade.timestamp;
+        }
+    }
+}
+
+TEST(HorizonsTest, StoresTheEventsOfTheLongestWindowOnly) {
+    using horizons_type = spl::metrics::stream::horizons<trade_summary, 2>;
+
+    auto horizons = horizons_type{{std::chrono::seconds{10}, std::chrono::seconds{2}}};
+    for (std::int64_t second = 1; second <= 20; ++second) {
+        std::ignore = horizons(trade_summary{.price = 100.0_p, .timestamp = std::chrono::seconds{second}});
+    }
+
+    // The 10 s window holds the trades of seconds 11 to 20, the 2 s one a subset of them
+    EXPECT_EQ(horizons.stored(), 10);
+
+    auto const results = horizons(trade_summary{.price = 200.0_p, .timestamp = std::chrono::seconds{21}});
+    EXPECT_EQ(horizons.stored(), 10);
+    EXPECT_EQ(results[0].mean, 110.0_p);
+    EXPECT_EQ(results[1].mean, 150.0_p);
+    EXPECT_EQ(results[0].minimum, 100.0_p);
+    EXPECT_EQ(results[1].maximum, 200.0_p);
+}
+
+TEST(HorizonsTest, RunsOverARing) {
+    using horizons_type = spl::metrics::stream::horizons<trade_summary, 4, spl::container::ring>;
+
+    auto horizons = horizons_type{{std::chrono::milliseconds{10}, std::chrono::milliseconds{100},
+                                   std::chrono::milliseconds{500}, std::chrono::seconds{1}}};
+    auto last     = horizons_type::result_type{};
+    for (auto const& trade : generate(20'000, std::chrono::microseconds{500}, 7)) {
+        last = horizons(trade);
+    }
+
+    for (std::size_t index = 1; index < horizons_type::size(); ++index) {
+        EXPECT_LE(last[index].minimum, last[index - 1].minimum);
+        EXPECT_GE(last[index].maximum, last[index - 1].maximum);
+    }
+}
@@ -1,3 +1,4 @@
+#include "generator.hpp"
 #include "spl/metrics/timeline.hpp"
 #include "spl/metrics/stream/mean.hpp"
 #include "spl/metrics/scan/mean.hpp"
@@ -394,3 +395,75 @@ TEST(MeanTest, SequentialAddAndRemove) {
         verify_against_scan(timeline, mean_stream);
     }
 }
+
+TEST(MeanTest, ExactAfterSliding) {
+    auto timeline    = timeline_type{std::chrono::seconds(1)};
+    auto mean_stream = spl::metrics::stream::mean<feeder::trade::trade_summary>{};
+
+    // Prices over two orders of magnitude, where a sum rounded on every step would drift
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.count             = 100'000;
+    config.min_price         = 1'000.0;
+    config.max_price         = 100'000.0;
+    config.events_per_second = 1'000.0;
+    auto const trades        = spl::metrics::benchmark::trade_generator{config}.generate();
+
+    auto const expected = [&]() {
+        auto sum = __int128_t{0};
+        for (auto const& trade : timeline) {
+            sum += trade.price.shifted();
+        }
+        auto const count = static_cast<__int128_t>(std::size(timeline));
+        return spl::types::price::from_shifted(static_cast<std::int64_t>((sum + count / 2) / count));
+    };
+
+    for (std::size_t i = 0; i < std::size(trades); ++i) {
+        auto const& trade = timeline.emplace_back<false>(trades[i]);
+        timeline.flush(trade.timestamp, [&](auto begin, auto end) { mean_stream(begin, end); });
+        mean_stream(trade);
+        if (i % 997 == 0) {
+            ASSERT_EQ(mean_stream(), expected()) << "at trade " << i;
+        }
+    }
+    EXPECT_EQ(mean_stream(), expected());
+}
+
+TEST(MeanTest, VarianceAndDeviation) {
+    auto timeline    = timeline_type{std::chrono::seconds(10)};
+    auto mean_stream = spl::metrics::stream::mean<feeder::trade::trade_summary>{};
+
+    for (auto const price : {2.0_p, 4.0_p, 4.0_p, 4.0_p, 5.0_p, 5.0_p, 7.0_p, 9.0_p}) {
+        add(timeline, price, 1'000'000'000, mean_stream);
+    }
+
+    EXPECT_EQ(mean_stream(), 5.0_p);
+    EXPECT_EQ(mean_stream.variance(), 4.0_p);
+    EXPECT_EQ(mean_stream.deviation(), 2.0_p);
+}
+
+TEST(MeanTest, DeviationRoundsToTheNearestMantissa) {
+    auto timeline    = timeline_type{std::chrono::seconds(10)};
+    auto mean_stream = spl::metrics::stream::mean<feeder::trade::trade_summary>{};
+
+    add(timeline, 100.0_p, 1'000'000'000, mean_stream);
+    add(timeline, 101.0_p, 2'000'000'000, mean_stream);
+    add(timeline, 103.0_p, 3'000'000'000, mean_stream);
+
+    // mean = 101.333..., variance = 14 / 9, deviation = 1.247219128924647
+    EXPECT_EQ(mean_stream(), 101.33333333_p);
+    EXPECT_EQ(mean_stream.variance(), 1.55555556_p);
+    EXPECT_EQ(mean_stream.deviation(), 1.24721913_p);
+}
+
+TEST(MeanTest, VarianceOfIdenticalPricesIsZero) {
+    auto timeline    = timeline_type{std::chrono::seconds(100)};
+    auto mean_stream = spl::metrics::stream::mean<feeder::trade::trade_summary>{};
+
+    for (int i = 0; i < 1000; ++i) {
+        add(timeline, 65432.12345678_p, static_cast<int64_t>(i) * 1'000'000, mean_stream);
+    }
+
+    EXPECT_EQ(mean_stream(), 65432.12345678_p);
+    EXPECT_EQ(mean_stream.variance(), spl::types::price::zero());
+    EXPECT_EQ(mean_stream.deviation(), spl::types::price::zero());
+}
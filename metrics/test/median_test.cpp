@@ -508,3 +508,24 @@ TEST(MedianTest, EvenToOddTransition) {
 
     verify_against_scan(timeline, median_stream);
 }
+
+TEST(MedianTest, InsertAfterTheLowerHalfExpired) {
+    auto timeline      = timeline_type{std::chrono::seconds(10)};
+    auto median_stream = spl::metrics::stream::median<feeder::trade::trade_summary>{};
+
+    add(timeline, 10.0_p, 1'000'000'000, median_stream);
+    add(timeline, 20.0_p, 2'000'000'000, median_stream);
+
+    // Only 10 expires, and it was the whole lower half
+    timeline.flush(std::chrono::nanoseconds(11'500'000'000), [&](auto begin, auto end) { median_stream(begin, end); });
+    EXPECT_EQ(median_stream(), 20.0_p);
+
+    // Above the remaining value, then between the remaining ones
+    add(timeline, 30.0_p, 11'500'000'000, median_stream);
+    EXPECT_EQ(median_stream(), 25.0_p);
+    add(timeline, 25.0_p, 11'600'000'000, median_stream);
+    EXPECT_EQ(median_stream(), 25.0_p);
+    add(timeline, 22.0_p, 11'700'000'000, median_stream);
+    EXPECT_EQ(median_stream(), 23.5_p);
+    verify_against_scan(timeline, median_stream);
+}
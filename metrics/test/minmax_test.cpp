@@ -1,12 +1,19 @@
+#include "generator.hpp"
 #include "spl/metrics/timeline.hpp"
 #include "spl/metrics/stream/max.hpp"
 #include "spl/metrics/stream/min.hpp"
+#include "spl/metrics/stream/sliding.hpp"
+#include "spl/metrics/stream/two_stack.hpp"
 #include "spl/metrics/scan/max.hpp"
 #include "spl/metrics/scan/min.hpp"
 #include "spl/protocol/feeder/trade/trade_summary.hpp"
 
 #include <gtest/gtest.h>
+#include <deque>
+#include <functional>
+#include <numeric>
 #include <random>
+#include <string>
 
 using namespace spl::protocol;
 
@@ -471,3 +478,53 @@ TEST(MinMaxTest, ComplexScenarioWithMultipleFlushes) {
     });
     verify_against_scan(timeline, min_stream, max_stream);
 }
+
+TEST(MinMaxTest, TwoStackKeepsTheOrderOfTheOperation) {
+    auto stack    = spl::metrics::stream::two_stack<std::string, std::plus<>>{};
+    auto expected = std::deque<std::string>{};
+    auto rng      = std::mt19937{42};
+    auto action   = std::uniform_int_distribution<int>{0, 2};
+    auto letter   = std::uniform_int_distribution<int>{'a', 'z'};
+
+    for (auto step = 0; step < 2'000; ++step) {
+        if (action(rng) == 0 and not std::empty(expected)) {
+            stack.pop();
+            expected.pop_front();
+        } else {
+            auto const value = std::string(1, static_cast<char>(letter(rng)));
+            stack.push(value);
+            expected.push_back(value);
+        }
+
+        ASSERT_EQ(std::size(stack), std::size(expected));
+        if (not std::empty(expected)) {
+            ASSERT_EQ(stack(), std::accumulate(std::begin(expected), std::end(expected), std::string{}));
+        }
+    }
+}
+
+TEST(MinMaxTest, SlidingMatchesTheScanWhileSliding) {
+    auto timeline   = timeline_type{std::chrono::milliseconds(50)};
+    auto min_stream = spl::metrics::stream::sliding_min<feeder::trade::trade_summary>{};
+    auto max_stream = spl::metrics::stream::sliding_max<feeder::trade::trade_summary>{};
+
+    // Trades close to 10, 2.5 ms apart on average, so that every 50 ms window expires a few at a time
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.count             = 5'000;
+    config.min_price         = 9.99;
+    config.max_price         = 10.01;
+    config.events_per_second = 400.0;
+    auto const trades        = spl::metrics::benchmark::trade_generator{config}.generate();
+
+    EXPECT_EQ(min_stream(), spl::types::price::zero());
+    for (auto const& generated : trades) {
+        auto const& trade = timeline.emplace_back<false>(generated);
+        timeline.flush(trade.timestamp, [&](auto begin, auto end) {
+            min_stream(begin, end);
+            max_stream(begin, end);
+        });
+        min_stream(trade);
+        max_stream(trade);
+        verify_against_scan(timeline, min_stream, max_stream);
+    }
+}
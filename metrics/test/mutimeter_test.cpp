@@ -1,3 +1,4 @@
+#include "generator.hpp"
 #include "spl/metrics/scan/multimeter.hpp"
 #include "spl/metrics/stream/multimeter.hpp"
 #include "spl/protocol/feeder/trade/trade_summary.hpp"
@@ -118,6 +119,50 @@ TYPED_TEST(MultimeterTest, EvenNumberOfTradesMedian) {
     EXPECT_DOUBLE_EQ(static_cast<double>(last_result.mean), 25.0);
 }
 
+TYPED_TEST(MultimeterTest, ExpiredTradesLeaveTheMetrics) {
+    auto base_time = std::chrono::steady_clock::now().time_since_epoch();
+
+    // The 500ms window slides past the first two trades: 10 and 20 expire, 30, 40 and 50 remain
+    std::vector<double> prices = {10.0, 20.0, 30.0, 40.0, 50.0};
+    spl::metrics::metrics last_result;
+
+    for (size_t i = 0; i < prices.size(); ++i) {
+        auto trade  = this->create_trade(prices[i], i + 1, base_time + std::chrono::milliseconds{i * 200});
+        last_result = (*this->multimeter_)(trade);
+    }
+
+    EXPECT_DOUBLE_EQ(static_cast<double>(last_result.minimum), 30.0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(last_result.maximum), 50.0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(last_result.median), 40.0);
+    EXPECT_DOUBLE_EQ(static_cast<double>(last_result.mean), 40.0);
+}
+
+TYPED_TEST(MultimeterTest, SnapshotReadsTheLastUpdate) {
+    auto base_time = std::chrono::steady_clock::now().time_since_epoch();
+    auto eager     = TypeParam{std::chrono::milliseconds{500}};
+
+    // Updates alone read nothing, a snapshot after them matches the result of the last event
+    std::vector<double> prices = {10.0, 20.0, 30.0, 40.0, 50.0};
+    auto expected              = typename TypeParam::result_type{};
+    for (size_t i = 0; i < prices.size(); ++i) {
+        auto trade = this->create_trade(prices[i], i + 1, base_time + std::chrono::milliseconds{i * 200});
+        expected   = eager(trade);
+        this->multimeter_->update(trade);
+    }
+
+    auto const& snapshot = this->multimeter_->snapshot();
+    EXPECT_EQ(snapshot.timestamp, expected.timestamp);
+    EXPECT_EQ(snapshot.minimum, expected.minimum);
+    EXPECT_EQ(snapshot.maximum, expected.maximum);
+    EXPECT_EQ(snapshot.median, expected.median);
+    EXPECT_EQ(snapshot.mean, expected.mean);
+    EXPECT_EQ(&this->multimeter_->snapshot(), &snapshot);
+
+    // A new update is read by the next snapshot
+    this->multimeter_->update(this->create_trade(5.0, 6, base_time + std::chrono::milliseconds{1'000}));
+    EXPECT_DOUBLE_EQ(static_cast<double>(this->multimeter_->snapshot().minimum), 5.0);
+}
+
 // Cross-implementation consistency test using typed test
 template <typename MultimeterType>
 class MultimeterConsistencyTest : public ::testing::Test {
@@ -129,7 +174,7 @@ protected:
     trade_summary create_trade(double price, std::uint64_t sequence, std::chrono::nanoseconds timestamp) {
         return trade_summary{.instrument_id = spl::protocol::common::instrument_id{1},
                              .exchange_id   = spl::protocol::common::exchange_id::coinbase,
-                             .trade_id      = spl::protocol::common::trade_id{static_cast<char>(sequence)},
+                             .trade_id      = spl::protocol::common::trade_id{std::to_string(sequence)},
                              .side          = spl::protocol::common::aggressor_side::sell,
                              .price         = spl::protocol::common::price::from(price),
                              .quantity      = spl::protocol::common::quantity::from(1.0),
@@ -183,4 +228,26 @@ TYPED_TEST(MultimeterConsistencyTest, DuplicatePricesHandling) {
         EXPECT_GE(static_cast<double>(result.median), static_cast<double>(result.minimum));
         EXPECT_LE(static_cast<double>(result.median), static_cast<double>(result.maximum));
     }
-}
\ No newline at end of file
+}
+TEST(MultimeterSlidingTest, StreamMatchesScanWhileSliding) {
+    auto stream = StreamMultimeter{std::chrono::milliseconds{200}};
+    auto scan   = ScanMultimeter{std::chrono::milliseconds{200}};
+
+    // Trades between 90 and 110, 10 ms apart on average, so that every 200 ms window expires a few at a time
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.count             = 5'000;
+    config.min_price         = 90.0;
+    config.max_price         = 110.0;
+    config.events_per_second = 100.0;
+    auto const trades        = spl::metrics::benchmark::trade_generator{config}.generate();
+
+    for (std::size_t i = 0; i < std::size(trades); ++i) {
+        auto const& trade   = trades[i];
+        auto const expected = scan(trade);
+        auto const result   = stream(trade);
+        ASSERT_EQ(result.minimum, expected.minimum) << "at trade " << i;
+        ASSERT_EQ(result.maximum, expected.maximum) << "at trade " << i;
+        ASSERT_EQ(result.median, expected.median) << "at trade " << i;
+        ASSERT_NEAR(static_cast<double>(result.mean), static_cast<double>(expected.mean), 1e-6) << "at trade " << i;
+    }
+}
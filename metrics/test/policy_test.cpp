@@ -0,0 +1,142 @@
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/scan/multimeter.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <deque>
+
+using namespace spl::protocol;
+
+using trade_summary  = feeder::trade::trade_summary;
+using predicate_type = spl::metrics::internal::timeline_predicate;
+using extrema_type   = spl::meta::list<spl::metrics::policy::minimum, spl::metrics::policy::maximum>;
+
+template <typename PoliciesT>
+using stream_type = spl::metrics::stream::multimeter<trade_summary, std::deque, predicate_type, PoliciesT>;
+
+template <typename PoliciesT>
+using scan_type = spl::metrics::scan::multimeter<trade_summary, std::deque, predicate_type, PoliciesT>;
+
+namespace {
+
+    template <typename ResultT>
+    concept has_extrema = requires(ResultT value) { value.minimum, value.maximum; };
+
+    template <typename ResultT>
+    concept has_median = requires(ResultT value) { value.median; };
+
+    template <typename ResultT>
+    concept has_vwap = requires(ResultT value) { value.vwap; };
+
+    auto const first  = trade_summary{.side      = common::aggressor_side::buy,
+                                      .price     = 100.0_p,
+                                      .quantity  = 1.0_q,
+                                      .timestamp = std::chrono::seconds(1)};
+    auto const second = trade_summary{.side      = common::aggressor_side::sell,
+                                      .price     = 200.0_p,
+                                      .quantity  = 3.0_q,
+                                      .timestamp = std::chrono::seconds(2)};
+
+} // namespace
+
+TEST(PolicyTest, ResultHasTheFieldsOfThePolicies) {
+    using extrema = spl::metrics::result<extrema_type>;
+    using flow    = spl::metrics::result<spl::metrics::policy::flow>;
+
+    static_assert(has_extrema<extrema> and not has_median<extrema> and not has_vwap<extrema>);
+    static_assert(has_vwap<flow> and not has_extrema<flow> and not has_median<flow>);
+    static_assert(requires(flow value) { value.volume, value.buy_volume, value.sell_volume, value.trades; });
+}
+
+TEST(PolicyTest, StreamComputesOnlyTheListedPolicies) {
+    auto extrema = stream_type<extrema_type>{std::chrono::seconds(10)};
+    auto flow    = stream_type<spl::metrics::policy::flow>{std::chrono::seconds(10)};
+
+    std::ignore        = extrema(first);
+    std::ignore        = flow(first);
+    auto const prices  = extrema(second);
+    auto const volumes = flow(second);
+
+    EXPECT_EQ(prices.minimum, 100.0_p);
+    EXPECT_EQ(prices.maximum, 200.0_p);
+    EXPECT_EQ(prices.timestamp, std::chrono::seconds(2));
+
+    EXPECT_EQ(volumes.vwap, 175.0_p);
+    EXPECT_EQ(volumes.volume, 4.0_q);
+    EXPECT_EQ(volumes.notional, 700.0_p);
+    EXPECT_EQ(volumes.buy_volume, 1.0_q);
+    EXPECT_EQ(volumes.sell_volume, 3.0_q);
+    EXPECT_EQ(volumes.trades, 2);
+}
+
+TEST(PolicyTest, ScanComputesOnlyTheListedPolicies) {
+    auto extrema = scan_type<extrema_type>{std::chrono::seconds(10)};
+
+    std::ignore       = extrema(first);
+    auto const prices = extrema(second);
+
+    EXPECT_EQ(prices.minimum, 100.0_p);
+    EXPECT_EQ(prices.maximum, 200.0_p);
+}
+
+TEST(PolicyTest, ConvertsToThePriceRecord) {
+    auto meter = stream_type<spl::metrics::policy::all>{std::chrono::seconds(10)};
+
+    std::ignore                        = meter(first);
+    auto const result                  = meter(second);
+    spl::metrics::metrics const record = result;
+
+    EXPECT_EQ(record.minimum, 100.0_p);
+    EXPECT_EQ(record.maximum, 200.0_p);
+    EXPECT_EQ(record.mean, 150.0_p);
+    EXPECT_EQ(record.timestamp, std::chrono::seconds(2));
+
+    // The other fields stay in the result
+    EXPECT_EQ(result.vwap, 175.0_p);
+    EXPECT_EQ(result.sell_volume, 3.0_q);
+    EXPECT_EQ(result.trades, 2);
+}
+
+TEST(PolicyTest, LeavesThePriceStatisticsOutOfTheListAtZero) {
+    auto meter = stream_type<spl::metrics::policy::flow>{std::chrono::seconds(10)};
+
+    std::ignore                        = meter(first);
+    spl::metrics::metrics const record = meter(second);
+
+    EXPECT_EQ(record.minimum, spl::types::price::zero());
+    EXPECT_EQ(record.median, spl::types::price::zero());
+    EXPECT_EQ(record.timestamp, std::chrono::seconds(2));
+}
+
+TEST(PolicyTest, SkippingTheMedianShrinksTheMultimeter) {
+    using extrema = stream_type<extrema_type>;
+    using price   = stream_type<spl::metrics::policy::price>;
+    EXPECT_LT(sizeof(extrema), sizeof(price));
+}
+
+TEST(PolicyTest, PoliciesShareTheirMetric) {
+    using price      = stream_type<spl::metrics::policy::price>;
+    using dispersion = stream_type<spl::meta::joined<spl::metrics::policy::price,
+                                                     spl::meta::list<spl::metrics::policy::dispersion>>>;
+    // Only the cached snapshot grows, by the fields of the dispersion
+    EXPECT_EQ(sizeof(dispersion) - sizeof(dispersion::result_type), sizeof(price) - sizeof(price::result_type));
+
+    auto meter        = dispersion{std::chrono::seconds(10)};
+    std::ignore       = meter(first);
+    auto const result = meter(second);
+    EXPECT_EQ(result.mean, 150.0_p);
+    EXPECT_EQ(result.variance, 2500.0_p);
+    EXPECT_EQ(result.deviation, 50.0_p);
+}
+
+TEST(PolicyTest, SlidingExtremaReplaceTheDeque) {
+    using sliding = spl::meta::list<spl::metrics::policy::sliding_minimum, spl::metrics::policy::sliding_maximum>;
+    static_assert(has_extrema<spl::metrics::result<sliding>> and not has_median<spl::metrics::result<sliding>>);
+
+    auto meter        = stream_type<sliding>{std::chrono::seconds(10)};
+    std::ignore       = meter(first);
+    auto const result = meter(second);
+    EXPECT_EQ(result.minimum, 100.0_p);
+    EXPECT_EQ(result.maximum, 200.0_p);
+}
@@ -0,0 +1,175 @@
+#include "generator.hpp"
+#include "spl/metrics/multimeter.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/sketch/ddsketch.hpp"
+#include "spl/metrics/sketch/multimeter.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace spl::protocol;
+
+using trade_summary  = feeder::trade::trade_summary;
+using predicate_type = spl::metrics::internal::timeline_predicate;
+using quantiles_type = spl::meta::list<spl::metrics::policy::minimum, spl::metrics::policy::maximum,
+                                       spl::metrics::policy::median, spl::metrics::policy::mean,
+                                       spl::metrics::policy::tail>;
+using sketch_type    = spl::metrics::sketch::multimeter<trade_summary, std::deque, predicate_type, quantiles_type>;
+
+namespace {
+
+    constexpr auto accuracy = 0.001;
+
+    // Exact value of rank ⌊q (n - 1)⌋, the one the sketch approximates
+    auto exact(std::vector<double> values, double q) -> double {
+        auto const rank = static_cast<std::size_t>(q * static_cast<double>(std::size(values) - 1));
+        std::ranges::nth_element(values, std::next(std::begin(values), static_cast<std::ptrdiff_t>(rank)));
+        return values[rank];
+    }
+
+    // Trades around 100, `gap` nanoseconds apart on average
+    auto generate(std::size_t count, std::int64_t gap) -> std::vector<trade_summary> {
+        auto config              = spl::metrics::benchmark::trade_generator::config{};
+        config.count             = count;
+        config.min_price         = 95.0;
+        config.max_price         = 105.0;
+        config.events_per_second = 1e9 / static_cast<double>(gap);
+        return spl::metrics::benchmark::trade_generator{config}.generate();
+    }
+
+} // namespace
+
+TEST(SketchTest, QuantilesAreWithinTheRelativeAccuracy) {
+    auto rng    = std::mt19937{7};
+    auto values = std::lognormal_distribution<double>{0.0, 2.0};
+    auto sketch = spl::metrics::sketch::ddsketch{accuracy};
+    auto exacts = std::vector<double>{};
+    for (std::size_t index = 0; index < 100'000; ++index) {
+        exacts.push_back(values(rng));
+        sketch.insert(exacts.back());
+    }
+
+    for (auto const q : {0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0}) {
+        auto const expected = exact(exacts, q);
+        EXPECT_NEAR(sketch.quantile(q), expected, expected * accuracy * 1.0001) << "q = " << q;
+    }
+}
+
+TEST(SketchTest, ErasingAMergedSketchRestoresTheQuantiles) {
+    auto kept    = spl::metrics::sketch::ddsketch{accuracy};
+    auto expired = spl::metrics::sketch::ddsketch{accuracy};
+    for (auto value = 1.0; value < 100.0; value += 1.0) {
+        kept.insert(value);
+        expired.insert(value * 1'000.0);
+    }
+    auto const median = kept.quantile(0.5);
+    auto const bins   = kept.bins();
+
+    kept.merge(expired);
+    EXPECT_EQ(kept.count(), 198);
+    EXPECT_GT(kept.quantile(0.75), 1'000.0);
+
+    kept.erase(expired);
+    EXPECT_EQ(kept.count(), 99);
+    EXPECT_DOUBLE_EQ(kept.quantile(0.5), median);
+    EXPECT_GT(kept.bins(), bins);
+}
+
+TEST(SketchTest, MultimeterMatchesTheTradesOfItsBuckets) {
+    auto const period = std::chrono::nanoseconds{std::chrono::seconds(1)};
+    auto const window = spl::metrics::sketch::config{.period = period, .buckets = 10, .accuracy = accuracy};
+    auto const width  = period / 10;
+    auto const trades = generate(5'000, 500'000);
+    auto multimeter   = sketch_type{window};
+    for (std::size_t index = 0; index < std::size(trades); ++index) {
+        auto const result = multimeter(trades[index]);
+
+        // Trades of the current slice and of the nine before it
+        auto const oldest = trades[index].timestamp / width - 9;
+        auto prices       = std::vector<double>{};
+        auto sum          = 0.0;
+        for (std::size_t other = 0; other <= index; ++other) {
+            if (trades[other].timestamp / width >= oldest) {
+                prices.push_back(static_cast<double>(trades[other].price));
+                sum += prices.back();
+            }
+        }
+
+        ASSERT_EQ(static_cast<double>(result.minimum), std::ranges::min(prices));
+        ASSERT_EQ(static_cast<double>(result.maximum), std::ranges::max(prices));
+        ASSERT_NEAR(static_cast<double>(result.mean), sum / static_cast<double>(std::size(prices)), 1e-6);
+        auto const median = exact(prices, 0.5);
+        auto const p99    = exact(prices, 0.99);
+        ASSERT_NEAR(static_cast<double>(result.median), median, median * accuracy * 1.0001);
+        ASSERT_NEAR(static_cast<double>(result.p99), p99, p99 * accuracy * 1.0001);
+    }
+}
+
+TEST(SketchTest, ZeroBucketsIsOneBucket) {
+    auto const trades = generate(1'000, 500'000);
+    auto none         = sketch_type{spl::metrics::sketch::config{.period = std::chrono::seconds(1), .buckets = 0}};
+    auto one          = sketch_type{spl::metrics::sketch::config{.period = std::chrono::seconds(1), .buckets = 1}};
+    for (auto const& trade : trades) {
+        auto const expected = one(trade);
+        auto const result   = none(trade);
+        ASSERT_EQ(result.minimum, expected.minimum);
+        ASSERT_EQ(result.maximum, expected.maximum);
+        ASSERT_EQ(result.median, expected.median);
+        ASSERT_EQ(result.p99, expected.p99);
+    }
+}
+
+TEST(SketchTest, MemoryDoesNotGrowWithTheWindow) {
+    auto const trades = generate(200'000, 5'000);
+    auto multimeter   = spl::metrics::sketch::quantiles<trade_summary>{
+        spl::metrics::sketch::config{.period = std::chrono::hours(24), .buckets = 24}};
+    for (std::size_t index = 0; index < 1'000; ++index) {
+        multimeter(trades[index]);
+    }
+    auto const bins = multimeter.sketch().bins();
+    for (auto const& trade : trades) {
+        multimeter(trade);
+    }
+    EXPECT_EQ(multimeter.sketch().count(), 201'000);
+    EXPECT_LE(multimeter.sketch().bins(), bins * 2);
+}
+
+TEST(SketchTest, IsAThirdMultimeterType) {
+    using multimeter = spl::metrics::multimeter<spl::metrics::type::sketch, trade_summary>;
+    static_assert(std::is_same_v<multimeter, spl::metrics::sketch::multimeter<trade_summary>>);
+
+    auto sketch    = multimeter{std::chrono::seconds(10)};
+    std::ignore    = sketch(trade_summary{.price = 100.0_p, .timestamp = std::chrono::seconds(1)});
+    auto const two = sketch(trade_summary{.price = 300.0_p, .timestamp = std::chrono::seconds(2)});
+    EXPECT_EQ(two.minimum, 100.0_p);
+    EXPECT_EQ(two.maximum, 300.0_p);
+    EXPECT_EQ(two.mean, 200.0_p);
+    EXPECT_NEAR(static_cast<double>(two.median), 100.0, 100.0 * 0.0001);
+
+    // Past the window, only the newest bucket is left
+    auto const late = sketch(trade_summary{.price = 200.0_p, .timestamp = std::chrono::seconds(30)});
+    EXPECT_EQ(late.minimum, 200.0_p);
+    EXPECT_EQ(late.maximum, 200.0_p);
+}
+
+TEST(SketchTest, SnapshotReadsTheLastUpdate) {
+    auto const trades = generate(1'000, 500'000);
+    auto eager        = sketch_type{std::chrono::seconds(1)};
+    auto lazy         = sketch_type{std::chrono::seconds(1)};
+    auto expected     = sketch_type::result_type{};
+    for (auto const& trade : trades) {
+        expected = eager(trade);
+        lazy.update(trade);
+    }
+
+    auto const& snapshot = lazy.snapshot();
+    EXPECT_EQ(snapshot.timestamp, expected.timestamp);
+    EXPECT_EQ(snapshot.minimum, expected.minimum);
+    EXPECT_EQ(snapshot.median, expected.median);
+    EXPECT_EQ(snapshot.p99, expected.p99);
+}
@@ -0,0 +1,116 @@
+#include "generator.hpp"
+#include "spl/metrics/timeline.hpp"
+#include "spl/metrics/stream/trades.hpp"
+#include "spl/metrics/stream/volume.hpp"
+#include "spl/metrics/stream/vwap.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace spl::protocol;
+
+using timeline_type = spl::metrics::timeline<feeder::trade::trade_summary>;
+
+template <typename... MetricsT>
+constexpr auto add(timeline_type& timeline, spl::types::price price, spl::types::quantity quantity,
+                   common::aggressor_side side, int64_t timestamp, MetricsT&... metrics) -> void {
+    auto const& trade = timeline.emplace_back<false>(feeder::trade::trade_summary{
+        .side      = side,
+        .price     = price,
+        .quantity  = quantity,
+        .timestamp = std::chrono::nanoseconds(timestamp),
+    });
+    timeline.flush(trade.timestamp, [&](auto first, auto last) { (metrics(first, last), ...); });
+    (metrics(trade), ...);
+}
+
+// Exact VWAP of the timeline, rounded half up like the stream
+static auto expected_vwap(timeline_type const& timeline) -> spl::types::price {
+    auto notional = __int128_t{0};
+    auto volume   = __int128_t{0};
+    for (auto const& trade : timeline) {
+        notional += static_cast<__int128_t>(trade.price.shifted()) * trade.quantity.shifted();
+        volume += trade.quantity.shifted();
+    }
+    return spl::types::price::from_shifted(static_cast<std::int64_t>((notional + volume / 2) / volume));
+}
+
+TEST(VwapTest, WeightsByQuantity) {
+    auto timeline    = timeline_type{std::chrono::seconds(10)};
+    auto vwap_stream = spl::metrics::stream::vwap<feeder::trade::trade_summary>{};
+
+    add(timeline, 100.0_p, 1.0_q, common::aggressor_side::buy, 1'000'000'000, vwap_stream);
+    add(timeline, 200.0_p, 3.0_q, common::aggressor_side::sell, 2'000'000'000, vwap_stream);
+
+    EXPECT_EQ(vwap_stream(), 175.0_p);
+}
+
+TEST(VwapTest, EmptyWindowIsZero) {
+    auto const vwap_stream = spl::metrics::stream::vwap<feeder::trade::trade_summary>{};
+    EXPECT_EQ(vwap_stream(), spl::types::price::zero());
+}
+
+TEST(VwapTest, ExactAfterSliding) {
+    auto timeline    = timeline_type{std::chrono::seconds(1)};
+    auto vwap_stream = spl::metrics::stream::vwap<feeder::trade::trade_summary>{};
+
+    // Large prices and sizes, so that the sums of the window need the 128 bits
+    auto config              = spl::metrics::benchmark::trade_generator::config{};
+    config.count             = 100'000;
+    config.min_price         = 9'000.0;
+    config.max_price         = 11'000.0;
+    config.events_per_second = 1'000.0;
+    config.min_quantity      = 0.000001;
+    config.max_quantity      = 50.0;
+    auto const trades        = spl::metrics::benchmark::trade_generator{config}.generate();
+
+    for (std::size_t i = 0; i < std::size(trades); ++i) {
+        add(timeline, trades[i].price, trades[i].quantity, trades[i].side, trades[i].timestamp.count(), vwap_stream);
+        if (i % 997 == 0) {
+            ASSERT_EQ(vwap_stream(), expected_vwap(timeline)) << "at trade " << i;
+        }
+    }
+    EXPECT_EQ(vwap_stream(), expected_vwap(timeline));
+}
+
+TEST(VolumeTest, SplitsByAggressorSide) {
+    auto timeline      = timeline_type{std::chrono::seconds(10)};
+    auto volume_stream = spl::metrics::stream::volume<feeder::trade::trade_summary>{};
+
+    add(timeline, 100.0_p, 1.5_q, common::aggressor_side::buy, 1'000'000'000, volume_stream);
+    add(timeline, 200.0_p, 0.25_q, common::aggressor_side::sell, 2'000'000'000, volume_stream);
+    add(timeline, 300.0_p, 2.0_q, common::aggressor_side::none, 3'000'000'000, volume_stream);
+
+    auto const result = volume_stream();
+    EXPECT_EQ(result.base, 3.75_q);
+    EXPECT_EQ(result.quote, 800.0_p);
+    EXPECT_EQ(result.buy, 1.5_q);
+    EXPECT_EQ(result.sell, 0.25_q);
+}
+
+TEST(VolumeTest, ExpiresWithTheWindow) {
+    auto timeline      = timeline_type{std::chrono::seconds(2)};
+    auto volume_stream = spl::metrics::stream::volume<feeder::trade::trade_summary>{};
+    auto trades_stream = spl::metrics::stream::trades<feeder::trade::trade_summary>{};
+
+    add(timeline, 100.0_p, 1.0_q, common::aggressor_side::buy, 1'000'000'000, volume_stream, trades_stream);
+    add(timeline, 100.0_p, 2.0_q, common::aggressor_side::sell, 2'000'000'000, volume_stream, trades_stream);
+    add(timeline, 100.0_p, 4.0_q, common::aggressor_side::sell, 3'500'000'000, volume_stream, trades_stream);
+
+    auto const result = volume_stream();
+    EXPECT_EQ(result.base, 6.0_q);
+    EXPECT_EQ(result.buy, spl::types::quantity::zero());
+    EXPECT_EQ(result.sell, 6.0_q);
+    EXPECT_EQ(trades_stream(), 2);
+}
+
+TEST(VolumeTest, SaturatesInsteadOfWrapping) {
+    auto timeline      = timeline_type{std::chrono::seconds(10)};
+    auto volume_stream = spl::metrics::stream::volume<feeder::trade::trade_summary>{};
+
+    auto const huge = spl::types::quantity::from_shifted(std::numeric_limits<std::int64_t>::max() / 2 + 1);
+    add(timeline, 1.0_p, huge, common::aggressor_side::buy, 1'000'000'000, volume_stream);
+    add(timeline, 1.0_p, huge, common::aggressor_side::buy, 2'000'000'000, volume_stream);
+
+    EXPECT_EQ(volume_stream().base, spl::types::quantity::max());
+}
@@ -0,0 +1,141 @@
+#include "generator.hpp"
+#include "spl/metrics/policy.hpp"
+#include "spl/metrics/scan/multimeter.hpp"
+#include "spl/metrics/stream/multimeter.hpp"
+#include "spl/metrics/timeline.hpp"
+#include "spl/metrics/window.hpp"
+#include "spl/protocol/feeder/trade/trade_summary.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+using namespace spl::protocol;
+
+using trade_summary  = feeder::trade::trade_summary;
+using predicate_type = spl::metrics::internal::timeline_predicate;
+
+template <typename WindowT>
+using timeline_type = spl::metrics::timeline<trade_summary, std::deque, predicate_type, WindowT>;
+
+template <typename WindowT>
+using stream_type =
+    spl::metrics::stream::multimeter<trade_summary, std::deque, predicate_type, spl::metrics::policy::price, WindowT>;
+
+template <typename WindowT>
+using scan_type =
+    spl::metrics::scan::multimeter<trade_summary, std::deque, predicate_type, spl::metrics::policy::price, WindowT>;
+
+// Trades around 100 of random sizes, about 100 per second
+static auto generate(std::size_t count) -> std::vector<trade_summary> {
+    auto config         = spl::metrics::benchmark::trade_generator::config{};
+    config.count        = count;
+    config.min_price    = 95.0;
+    config.max_price    = 105.0;
+    config.min_quantity = 0.000001;
+    config.max_quantity = 1.0;
+    return spl::metrics::benchmark::trade_generator{config}.generate();
+}
+
+TEST(WindowTest, CountKeepsTheLastEvents) {
+    auto const trades = generate(1'000);
+    auto timeline     = timeline_type<spl::metrics::window::count>{spl::metrics::window::count{64}};
+    auto expired      = std::size_t{0};
+    for (std::size_t index = 0; index < std::size(trades); ++index) {
+        std::ignore = timeline.emplace_back<false>(trades[index]);
+        timeline.flush(trades[index].timestamp,
+                       [&](auto first, auto last) { expired += static_cast<std::size_t>(std::distance(first, last)); });
+        ASSERT_EQ(std::size(timeline), std::min<std::size_t>(index + 1, 64));
+        EXPECT_EQ(timeline.back().timestamp, trades[index].timestamp);
+        EXPECT_EQ(expired + std::size(timeline), index + 1);
+    }
+}
+
+TEST(WindowTest, VolumeKeepsTheShortestSuffixWithTheAmount) {
+    auto const trades = generate(1'000);
+    auto const amount = 10.0_q;
+    auto timeline     = timeline_type<spl::metrics::window::volume>{spl::metrics::window::volume{.amount = amount}};
+    for (std::size_t index = 0; index < std::size(trades); ++index) {
+        std::ignore = timeline.emplace_back(trades[index]);
+
+        // Shortest run of the newest trades adding up to the amount, recomputed from scratch
+        auto expected = std::size_t{0};
+        auto total    = spl::types::quantity::zero();
+        while (expected <= index and total < amount) {
+            total += trades[index - expected].quantity;
+            ++expected;
+        }
+        ASSERT_EQ(std::size(timeline), expected);
+    }
+}
+
+TEST(WindowTest, VolumeForgetsPoppedAndClearedEvents) {
+    auto const trade = trade_summary{.price = 100.0_p, .quantity = 4.0_q, .timestamp = std::chrono::seconds(1)};
+    auto timeline    = timeline_type<spl::metrics::window::volume>{spl::metrics::window::volume{.amount = 10.0_q}};
+    for (std::size_t index = 0; index < 3; ++index) {
+        std::ignore = timeline.emplace_back(trade);
+    }
+    ASSERT_EQ(std::size(timeline), 3);
+
+    // 8 left after the pop, the next trade is needed to reach 10 again and none of the stored ones expire
+    timeline.pop_front();
+    std::ignore = timeline.emplace_back(trade);
+    EXPECT_EQ(std::size(timeline), 3);
+
+    // Nothing left after the clear, two trades add up to 8 and both stay
+    timeline.clear();
+    std::ignore = timeline.emplace_back(trade);
+    std::ignore = timeline.emplace_back(trade);
+    EXPECT_EQ(std::size(timeline), 2);
+}
+
+TEST(WindowTest, CappedKeepsTheLastEventsOfThePeriod) {
+    auto const trades = generate(1'000);
+    auto const period = std::chrono::milliseconds(200);
+    auto timeline     = timeline_type<spl::metrics::window::capped>{spl::metrics::window::capped{period, 16}};
+    for (std::size_t index = 0; index < std::size(trades); ++index) {
+        std::ignore = timeline.emplace_back(trades[index]);
+
+        auto expected = std::size_t{0};
+        while (expected <= index and expected < 16 and
+               trades[index].timestamp - trades[index - expected].timestamp < period) {
+            ++expected;
+        }
+        ASSERT_EQ(std::size(timeline), expected);
+    }
+}
+
+TEST(WindowTest, BurstsStayWithinTheCap) {
+    auto const burst = trade_summary{.price = 100.0_p, .quantity = 0.000001_q, .timestamp = std::chrono::seconds(1)};
+    auto capped = timeline_type<spl::metrics::window::capped>{
+        spl::metrics::window::capped{.period = std::chrono::seconds(60), .size = 1'024}};
+    auto volume = timeline_type<spl::metrics::window::volume>{
+        spl::metrics::window::volume{.amount = 1'000'000.0_q, .capacity = 1'024}};
+    for (std::size_t index = 0; index < 100'000; ++index) {
+        std::ignore = capped.emplace_back(burst);
+        std::ignore = volume.emplace_back(burst);
+    }
+    EXPECT_EQ(std::size(capped), 1'024);
+    EXPECT_EQ(std::size(volume), 1'024);
+}
+
+TEST(WindowTest, MultimetersAgreeOverACountWindow) {
+    auto const trades = generate(2'000);
+    auto const window = spl::metrics::window::count{100};
+    auto stream       = stream_type<spl::metrics::window::count>{window};
+    auto scan         = scan_type<spl::metrics::window::count>{window};
+    for (std::size_t index = 0; index < std::size(trades); ++index) {
+        auto const streamed = stream(trades[index]);
+        auto const scanned  = scan(trades[index]);
+        auto const first    = std::next(std::begin(trades), static_cast<std::ptrdiff_t>(index < 100 ? 0 : index - 99));
+        auto const last     = std::next(std::begin(trades), static_cast<std::ptrdiff_t>(index + 1));
+        auto const [lowest, highest] =
+            std::minmax_element(first, last, [](auto const& lhs, auto const& rhs) { return lhs.price < rhs.price; });
+        ASSERT_EQ(streamed.minimum, lowest->price);
+        ASSERT_EQ(streamed.maximum, highest->price);
+        ASSERT_EQ(scanned.minimum, lowest->price);
+        ASSERT_EQ(scanned.maximum, highest->price);
+        ASSERT_EQ(streamed.median, scanned.median);
+    }
+}
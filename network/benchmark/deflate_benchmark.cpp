@@ -0,0 +1,142 @@
+#include "corpus.hpp"
+
+#include <boost/beast/zlib/deflate_stream.hpp>
+#include <boost/beast/zlib/inflate_stream.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Configuration
+namespace {
+    constexpr std::size_t FIXED_MESSAGES = 5000;
+    constexpr std::size_t OUTPUT_BUFFER  = 64 * 1024;
+    constexpr std::uint32_t SEED         = 42;
+    constexpr int WINDOW_BITS            = 15;
+    constexpr int MEMORY_LEVEL           = 8;
+
+    // Every permessage-deflate message is flushed with Z_SYNC_FLUSH and the trailing 00 00 FF FF is not sent.
+    constexpr std::size_t SYNC_TAIL = 4;
+} // namespace
+
+// Message generator: Bybit publicTrade frames with a few trades each, close to what the feed sends
+static std::vector<std::string> generate_messages() {
+    return spl::exchange::benchmark::bybit_frames(FIXED_MESSAGES, 1, 4, SEED).frames;
+}
+
+// Compresses every message the way a server does, reusing the window between messages or not
+static std::vector<std::string> compress(std::vector<std::string> const& messages, int level, bool takeover) {
+    auto frames  = std::vector<std::string>{};
+    auto deflate = boost::beast::zlib::deflate_stream{};
+    deflate.reset(level, WINDOW_BITS, MEMORY_LEVEL, boost::beast::zlib::Strategy::normal);
+    frames.reserve(std::size(messages));
+
+    auto output = std::string(OUTPUT_BUFFER, '\0');
+    for (auto const& message : messages) {
+        if (not takeover) {
+            deflate.reset();
+        }
+        auto params      = boost::beast::zlib::z_params{};
+        params.next_in   = message.data();
+        params.avail_in  = message.size();
+        params.next_out  = output.data();
+        params.avail_out = output.size();
+
+        auto error = boost::beast::error_code{};
+        deflate.write(params, boost::beast::zlib::Flush::sync, error);
+        frames.emplace_back(output.data(), params.total_out);
+    }
+    return frames;
+}
+
+static auto record(benchmark::State& state, std::vector<std::string> const& messages,
+                   std::vector<std::string> const& frames, std::size_t tail) -> void {
+    auto raw  = std::size_t{0};
+    auto wire = std::size_t{0};
+    for (std::size_t i = 0; i < std::size(messages); ++i) {
+        raw += std::size(messages[i]);
+        wire += std::size(frames[i]) - tail;
+    }
+
+    state.SetItemsProcessed(state.iterations() * std::size(messages));
+    state.SetBytesProcessed(state.iterations() * raw);
+    state.counters["raw_bytes_per_msg"]  = static_cast<double>(raw) / std::size(messages);
+    state.counters["wire_bytes_per_msg"] = static_cast<double>(wire) / std::size(messages);
+    state.counters["wire_ratio"]         = static_cast<double>(wire) / raw;
+}
+
+// Baseline: uncompressed frames, the only cost on the inbound path is moving the payload
+static void BM_Uncompressed(benchmark::State& state) {
+    auto const messages = generate_messages();
+    auto output         = std::string(OUTPUT_BUFFER, '\0');
+
+    for (auto _ : state) {
+        for (auto const& message : messages) {
+            std::memcpy(output.data(), message.data(), message.size());
+            benchmark::DoNotOptimize(output.data());
+        }
+        benchmark::ClobberMemory();
+    }
+
+    record(state, messages, messages, 0);
+}
+
+// Inflate with a single context kept for the whole connection (context takeover, the default)
+static void BM_InflatePersistent(benchmark::State& state) {
+    auto const messages = generate_messages();
+    auto const frames   = compress(messages, static_cast<int>(state.range(0)), true);
+    auto output         = std::string(OUTPUT_BUFFER, '\0');
+
+    for (auto _ : state) {
+        auto inflate = boost::beast::zlib::inflate_stream{};
+        inflate.reset(WINDOW_BITS);
+        for (auto const& frame : frames) {
+            auto params      = boost::beast::zlib::z_params{};
+            params.next_in   = frame.data();
+            params.avail_in  = frame.size();
+            params.next_out  = output.data();
+            params.avail_out = output.size();
+
+            auto error = boost::beast::error_code{};
+            inflate.write(params, boost::beast::zlib::Flush::sync, error);
+            benchmark::DoNotOptimize(params.total_out);
+        }
+    }
+
+    record(state, messages, frames, SYNC_TAIL);
+    state.counters["level"] = state.range(0);
+}
+
+// Inflate with the context reset on every message (no_context_takeover negotiated)
+static void BM_InflateReset(benchmark::State& state) {
+    auto const messages = generate_messages();
+    auto const frames   = compress(messages, static_cast<int>(state.range(0)), false);
+    auto output         = std::string(OUTPUT_BUFFER, '\0');
+
+    for (auto _ : state) {
+        auto inflate = boost::beast::zlib::inflate_stream{};
+        for (auto const& frame : frames) {
+            inflate.reset(WINDOW_BITS);
+            auto params      = boost::beast::zlib::z_params{};
+            params.next_in   = frame.data();
+            params.avail_in  = frame.size();
+            params.next_out  = output.data();
+            params.avail_out = output.size();
+
+            auto error = boost::beast::error_code{};
+            inflate.write(params, boost::beast::zlib::Flush::sync, error);
+            benchmark::DoNotOptimize(params.total_out);
+        }
+    }
+
+    record(state, messages, frames, SYNC_TAIL);
+    state.counters["level"] = state.range(0);
+}
+
+// Benchmark registrations: Arg(compression_level used by the server)
+BENCHMARK(BM_Uncompressed)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InflatePersistent)->Arg(1)->Arg(6)->Arg(9)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InflateReset)->Arg(1)->Arg(6)->Arg(9)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -8,4 +8,7 @@ namespace spl::network::client {
 
     using tcp = socket::stream<boost::asio::ip::tcp>;
 
+    template <socket::tuning TuningV>
+    using tuned_tcp = socket::stream<boost::asio::ip::tcp, TuningV>;
+
 }
\ No newline at end of file
@@ -7,4 +7,7 @@ namespace spl::network::client {
 
     using tls = socket::layer::ssl<client::tcp>;
 
+    template <socket::tuning TuningV>
+    using tuned_tls = socket::layer::ssl<client::tuned_tcp<TuningV>>;
+
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "spl/network/socket/datagram.hpp"
+#include "spl/network/socket/layer/multicast.hpp"
 
 #include <boost/asio/ip/udp.hpp>
 
@@ -8,4 +9,9 @@ namespace spl::network::client {
 
     using udp = socket::datagram<boost::asio::ip::udp>;
 
-}
\ No newline at end of file
+    using multicast = socket::layer::multicast<udp>;
+
+    template <std::size_t BatchV, std::size_t DatagramV>
+    using batched_multicast = socket::layer::multicast<udp, BatchV, DatagramV>;
+
+} // namespace spl::network::client
@@ -9,4 +9,10 @@ namespace spl::network::client {
     using ws  = socket::layer::websocket<client::tcp>;
     using wss = socket::layer::websocket<client::tls>;
 
+    template <socket::tuning TuningV>
+    using tuned_wss = socket::layer::websocket<client::tuned_tls<TuningV>>;
+
+    template <socket::layer::deflate CompressionV, socket::tuning TuningV = socket::tuning{}>
+    using deflated_wss = socket::layer::websocket<client::tuned_tls<TuningV>, CompressionV>;
+
 } // namespace spl::network::client
\ No newline at end of file
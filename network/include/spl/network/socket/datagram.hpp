@@ -176,14 +176,14 @@ namespace spl::network::socket {
     template <typename ConstBufferSequenceT>
     constexpr auto datagram<ProtocolT>::write_some(ConstBufferSequenceT&& buffers, error_code& error_code) noexcept
         -> std::size_t {
-        return datagram_socket_.write_some(buffers, error_code);
+        return datagram_socket_.send(buffers, 0, error_code);
     }
 
     template <typename ProtocolT>
     template <typename MutableBufferSequenceT>
     constexpr auto datagram<ProtocolT>::read_some(MutableBufferSequenceT&& buffers, error_code& error_code) noexcept
         -> std::size_t {
-        return datagram_socket_.read_some(buffers, error_code);
+        return datagram_socket_.receive(buffers, 0, error_code);
     }
 
     template <typename ProtocolT>
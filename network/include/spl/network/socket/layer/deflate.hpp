@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+namespace spl::network::socket::layer {
+
+    /**
+     * @brief permessage-deflate (RFC 7692) settings negotiated by the websocket layer during the handshake.
+     *
+     * The structure is used as a non-type template parameter, so every connection type carries its own compression
+     * profile and exchange contracts can pick one by choosing their connection_type. With context takeover enabled
+     * the inflate window is kept alive across messages, so the inbound path reuses a single inflate context for the
+     * whole lifetime of the connection and inflates straight into the caller's buffer.
+     */
+    struct deflate {
+        bool enabled{false};          ///< Offer permessage-deflate in the handshake.
+        int window_bits{15};          ///< LZ77 window requested for both directions, in the [9, 15] range.
+        bool context_takeover{true};  ///< Keep the compression context between messages.
+        int compression_level{1};     ///< Level used for the outbound messages, in the [0, 9] range.
+        int memory_level{8};          ///< Memory used by the outbound compressor, in the [1, 9] range.
+        std::size_t threshold{256};   ///< Outbound messages below this size are sent uncompressed.
+    };
+
+} // namespace spl::network::socket::layer
@@ -0,0 +1,318 @@
+#pragma once
+
+#include "spl/logger/logger.hpp"
+#include "spl/network/common/context.hpp"
+#include "spl/network/common/error_code.hpp"
+#include "spl/network/common/result.hpp"
+#include "spl/network/concepts/socket.hpp"
+#include "spl/result/result.hpp"
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/multicast.hpp>
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace spl::network::socket::layer {
+
+    /**
+     * @brief Receive side of a UDP multicast group on top of a datagram socket.
+     *
+     * The endpoint resolved by the router is the group, so connect() only records it: a connected UDP socket would
+     * filter out every datagram not sent from the group address itself. The socket is opened, bound to the group
+     * port and joined to the group during configure(), where a non-empty path ("/10.0.0.1") selects the interface.
+     *
+     * Reads drain up to BatchV datagrams with a single recvmmsg into the caller's buffer, which is used as a slab of
+     * BatchV slots of DatagramV bytes. The datagrams are then compacted back to back, so the decoder sees the same
+     * contiguous byte stream as with any other connection. The slab is made of 8-byte words, so datagrams sized in
+     * multiples of 8 stay aligned after the compaction and can be decoded in place.
+     *
+     * @tparam SocketT Datagram socket the group is joined on.
+     * @tparam BatchV Maximum number of datagrams read per call.
+     * @tparam DatagramV Size of a slot, larger datagrams are truncated by the kernel and dropped.
+     */
+    template <concepts::socket SocketT, std::size_t BatchV = 32, std::size_t DatagramV = 2048>
+    class multicast {
+        static_assert(BatchV > 0 and DatagramV > 0, "multicast requires a non-empty receive slab");
+        static_assert(DatagramV % sizeof(std::uint64_t) == 0, "multicast slots must keep the slab 8-byte aligned");
+
+    public:
+        using next_layer_type   = SocketT;
+        using protocol_type     = typename next_layer_type::protocol_type;
+        using lowest_layer_type = typename next_layer_type::lowest_layer_type;
+        using endpoint_type     = typename next_layer_type::endpoint_type;
+        using executor_type     = typename next_layer_type::executor_type;
+        using address_type      = boost::asio::ip::address;
+        using slab_type         = std::array<std::uint64_t, BatchV * DatagramV / sizeof(std::uint64_t)>;
+
+        constexpr static auto batch    = BatchV;
+        constexpr static auto datagram = DatagramV;
+
+        constexpr explicit multicast(context& context) noexcept;
+        constexpr multicast(multicast&& other) noexcept                    = default;
+        constexpr auto operator=(multicast&& other) noexcept -> multicast& = default;
+        constexpr ~multicast()                                             = default;
+
+        [[nodiscard]] constexpr auto close() noexcept -> result<void>;
+
+        template <typename EndPointIteratorT>
+        [[nodiscard]] constexpr auto connect(EndPointIteratorT first, EndPointIteratorT last) noexcept -> result<void>;
+
+        template <typename... IgnoredArgsT>
+        [[nodiscard]] constexpr auto configure(std::string const& host, std::string const& port,
+                                               std::string const& path, IgnoredArgsT&&... args) noexcept
+            -> result<void>;
+
+        [[nodiscard]] constexpr auto join(address_type const& group) noexcept -> result<void>;
+
+        [[nodiscard]] constexpr auto leave(address_type const& group) noexcept -> result<void>;
+
+        [[nodiscard]] constexpr auto get_executor() noexcept -> executor_type {
+            return next_layer().get_executor();
+        }
+
+        template <typename SettableSocketOption>
+        [[nodiscard]] constexpr auto set_option(SettableSocketOption&& option) noexcept -> result<void>;
+
+        template <typename GettableSocketOption>
+        [[nodiscard]] constexpr auto get_option(GettableSocketOption& option) const noexcept -> result<void>;
+
+        [[nodiscard]] constexpr auto local_endpoint() const noexcept -> result<endpoint_type>;
+
+        [[nodiscard]] constexpr auto remote_endpoint() const noexcept -> result<endpoint_type>;
+
+        [[nodiscard]] constexpr auto available() const noexcept -> result<std::size_t>;
+
+        [[nodiscard]] constexpr auto bytes_readable() noexcept -> result<std::size_t>;
+
+        [[nodiscard]] constexpr auto next_layer() const noexcept -> next_layer_type const&;
+
+        [[nodiscard]] constexpr auto next_layer() noexcept -> next_layer_type&;
+
+        [[nodiscard]] constexpr auto lowest_layer() const noexcept -> lowest_layer_type const&;
+
+        [[nodiscard]] constexpr auto lowest_layer() noexcept -> lowest_layer_type&;
+
+        [[nodiscard]] constexpr auto is_open() const noexcept -> bool;
+
+        template <typename ConstBufferSequenceT>
+        constexpr auto write(ConstBufferSequenceT&& buffers, error_code& error_code) noexcept -> std::size_t;
+
+        template <typename MutableBufferSequenceT>
+        constexpr auto read(MutableBufferSequenceT&& buffers, error_code& error_code) noexcept -> std::size_t;
+
+    private:
+        std::reference_wrapper<context> context_;
+        SocketT socket_;
+        endpoint_type group_{};
+        boost::asio::ip::address_v4 interface_{};
+        bool joined_{false};
+        std::array<::mmsghdr, BatchV> messages_{};
+        std::array<::iovec, BatchV> vectors_{};
+    };
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr multicast<SocketT, BatchV, DatagramV>::multicast(context& context) noexcept :
+        context_(context), socket_(context) {}
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::close() noexcept -> result<void> {
+        if (joined_) [[likely]] {
+            std::ignore = leave(group_.address());
+        }
+        return socket_.close();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    template <typename EndPointIteratorT>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::connect(EndPointIteratorT first,
+                                                                  EndPointIteratorT last) noexcept -> result<void> {
+        if (first == last) [[unlikely]] {
+            return failure(boost::asio::error::host_not_found);
+        }
+
+        auto const endpoint = static_cast<endpoint_type>(*first);
+        if (not endpoint.address().is_multicast()) [[unlikely]] {
+            logger::error("Multicast: {} is not a multicast group", endpoint.address().to_string());
+            return failure(boost::asio::error::invalid_argument);
+        }
+        group_ = endpoint;
+        return success();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    template <typename... IgnoredArgsT>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::configure(std::string const& host, std::string const& port,
+                                                                    std::string const& path,
+                                                                    IgnoredArgsT&&... args) noexcept -> result<void> {
+        auto error_code = network::error_code{};
+        auto& socket    = socket_.next_layer();
+        if (not socket.is_open()) [[likely]] {
+            socket.open(group_.protocol(), error_code);
+            if (error_code) [[unlikely]] {
+                return failure(error_code);
+            }
+        }
+
+        auto const device = std::string_view(path).substr(path.starts_with('/') ? 1 : 0);
+        if (not std::empty(device)) [[unlikely]] {
+            interface_ = boost::asio::ip::make_address_v4(device, error_code);
+            if (error_code) [[unlikely]] {
+                logger::error("Multicast: invalid interface address \"{}\"", device);
+                return failure(error_code);
+            }
+            err_return(set_option(boost::asio::ip::multicast::outbound_interface(interface_)));
+        }
+
+        err_return(set_option(boost::asio::socket_base::reuse_address(true)));
+        socket.bind(group_, error_code);
+        if (error_code) [[unlikely]] {
+            return failure(error_code);
+        }
+
+        err_return(join(group_.address()));
+        logger::info("Multicast: joined group {}:{} on interface {}", host, port, interface_.to_string());
+        return success();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::join(address_type const& group) noexcept -> result<void> {
+        if (group.is_v4()) [[likely]] {
+            err_return(set_option(boost::asio::ip::multicast::join_group(group.to_v4(), interface_)));
+        } else {
+            err_return(set_option(boost::asio::ip::multicast::join_group(group)));
+        }
+        joined_ = true;
+        return success();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::leave(address_type const& group) noexcept -> result<void> {
+        if (group.is_v4()) [[likely]] {
+            err_return(set_option(boost::asio::ip::multicast::leave_group(group.to_v4(), interface_)));
+        } else {
+            err_return(set_option(boost::asio::ip::multicast::leave_group(group)));
+        }
+        joined_ = false;
+        return success();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    template <typename SettableSocketOption>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::set_option(SettableSocketOption&& option) noexcept
+        -> result<void> {
+        return socket_.set_option(std::forward<SettableSocketOption>(option));
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    template <typename GettableSocketOption>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::get_option(GettableSocketOption& option) const noexcept
+        -> result<void> {
+        return socket_.get_option(option);
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::local_endpoint() const noexcept -> result<endpoint_type> {
+        return socket_.local_endpoint();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::remote_endpoint() const noexcept -> result<endpoint_type> {
+        return group_;
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::available() const noexcept -> result<std::size_t> {
+        return socket_.available();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::bytes_readable() noexcept -> result<std::size_t> {
+        // FIONREAD on a UDP socket only reports the size of the next datagram, so any pending datagram is announced
+        // as a full slab and the read drains as many as the batch allows.
+        auto const pending = err_return(socket_.bytes_readable());
+        return pending == 0 ? std::size_t{0} : BatchV * DatagramV;
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::next_layer() const noexcept -> next_layer_type const& {
+        return socket_;
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::next_layer() noexcept -> next_layer_type& {
+        return socket_;
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::lowest_layer() const noexcept -> lowest_layer_type const& {
+        return socket_.lowest_layer();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::lowest_layer() noexcept -> lowest_layer_type& {
+        return socket_.lowest_layer();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::is_open() const noexcept -> bool {
+        return socket_.is_open();
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    template <typename ConstBufferSequenceT>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::write(ConstBufferSequenceT&& buffers,
+                                                                error_code& error_code) noexcept -> std::size_t {
+        return socket_.next_layer().send_to(buffers, group_, 0, error_code);
+    }
+
+    template <concepts::socket SocketT, std::size_t BatchV, std::size_t DatagramV>
+    template <typename MutableBufferSequenceT>
+    constexpr auto multicast<SocketT, BatchV, DatagramV>::read(MutableBufferSequenceT&& buffers,
+                                                               error_code& error_code) noexcept -> std::size_t {
+        auto const region = boost::asio::mutable_buffer(boost::asio::buffer(buffers));
+        auto* const slab  = static_cast<char*>(region.data());
+        auto const slots  = std::min(BatchV, region.size() / DatagramV);
+        if (slots == 0) [[unlikely]] {
+            error_code = boost::asio::error::no_buffer_space;
+            return 0;
+        }
+
+        for (auto index = std::size_t{0}; index < slots; ++index) {
+            vectors_[index]                     = ::iovec{.iov_base = slab + index * DatagramV, .iov_len = DatagramV};
+            messages_[index]                    = ::mmsghdr{};
+            messages_[index].msg_hdr.msg_iov    = &vectors_[index];
+            messages_[index].msg_hdr.msg_iovlen = 1;
+        }
+
+        auto const handle   = socket_.next_layer().native_handle();
+        auto const received = ::recvmmsg(handle, messages_.data(), static_cast<unsigned int>(slots), MSG_DONTWAIT,
+                                         nullptr);
+        if (received < 0) [[unlikely]] {
+            if (errno != EAGAIN and errno != EWOULDBLOCK and errno != EINTR) [[unlikely]] {
+                error_code = network::error_code(errno, boost::asio::error::get_system_category());
+            }
+            return 0;
+        }
+
+        auto bytes = std::size_t{0};
+        for (auto index = std::size_t{0}; index < static_cast<std::size_t>(received); ++index) {
+            auto const length = static_cast<std::size_t>(messages_[index].msg_len);
+            if (messages_[index].msg_hdr.msg_flags & MSG_TRUNC) [[unlikely]] {
+                logger::warn("Multicast: dropping a datagram larger than {} bytes", DatagramV);
+                continue;
+            }
+            std::memmove(slab + bytes, slab + index * DatagramV, length);
+            bytes += length;
+        }
+        return bytes;
+    }
+
+} // namespace spl::network::socket::layer
@@ -14,6 +14,7 @@
 #include <boost/asio/ssl/host_name_verification.hpp>
 #include <boost/asio/ssl/stream.hpp>
 
+#include <chrono>
 #include <string_view>
 #include <utility>
 
@@ -25,8 +26,8 @@ namespace spl::network::socket::layer {
 
 namespace boost::beast::websocket {
 
-    inline void teardown(role_type role, spl::network::socket::layer::ssl<spl::network::client::tcp>& socket,
-                         error_code& error) {
+    template <typename SocketT>
+    inline void teardown(role_type role, spl::network::socket::layer::ssl<SocketT>& socket, error_code& error) {
         ignore_unused(role, socket, error);
     }
 
@@ -89,6 +90,8 @@ namespace spl::network::socket::layer {
 
         [[nodiscard]] constexpr auto is_open() const noexcept -> bool;
 
+        [[nodiscard]] constexpr auto received() const noexcept -> std::chrono::nanoseconds;
+
         [[nodiscard]] constexpr auto native_handle() noexcept -> native_handle_type;
 
         [[nodiscard]] constexpr auto ssl_context() const noexcept -> ssl_context_type const&;
@@ -250,6 +253,11 @@ namespace spl::network::socket::layer {
         return next_layer().is_open();
     }
 
+    template <concepts::socket SocketT>
+    constexpr auto ssl<SocketT>::received() const noexcept -> std::chrono::nanoseconds {
+        return next_layer().received();
+    }
+
     template <concepts::socket SocketT>
     template <typename ConstBufferSequenceT>
     constexpr auto ssl<SocketT>::write_some(ConstBufferSequenceT&& buffers, error_code& error) noexcept -> std::size_t {
@@ -4,6 +4,7 @@
 
 #include "spl/logger/logger.hpp"
 #include "spl/network/socket/layer/ssl.hpp"
+#include "spl/network/socket/layer/deflate.hpp"
 #include "spl/network/common/error_code.hpp"
 #include "spl/network/concepts/socket.hpp"
 #include "spl/network/socket/stream.hpp"
@@ -12,20 +13,21 @@
 #include <boost/beast/websocket.hpp>
 #include <boost/asio/ssl/error.hpp>
 
+#include <chrono>
 #include <exception>
 
 namespace spl::network::socket::layer {
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV = deflate{}>
     class websocket;
 
 }
 
 namespace boost::beast::websocket {
 
-    template <typename SocketT>
-    constexpr auto teardown(role_type role, spl::network::socket::layer::websocket<SocketT>& socket, error_code& error)
-        -> void {
+    template <typename SocketT, spl::network::socket::layer::deflate CompressionV>
+    constexpr auto teardown(role_type role, spl::network::socket::layer::websocket<SocketT, CompressionV>& socket,
+                            error_code& error) -> void {
         boost::ignore_unused(role, socket, error);
     }
 
@@ -38,8 +40,10 @@ namespace boost::beast::websocket {
 
 namespace spl::network::socket::layer {
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     class websocket {
+        static_assert(CompressionV.window_bits >= 9 and CompressionV.window_bits <= 15, "invalid deflate window");
+
     public:
         using next_layer_type   = SocketT;
         using protocol_type     = typename next_layer_type::protocol_type;
@@ -47,6 +51,8 @@ namespace spl::network::socket::layer {
         using endpoint_type     = typename next_layer_type::endpoint_type;
         using executor_type     = typename next_layer_type::executor_type;
 
+        constexpr static auto compression = CompressionV;
+
         constexpr explicit websocket(context& context) noexcept;
         constexpr websocket(websocket&& other) noexcept                    = default;
         constexpr auto operator=(websocket&& other) noexcept -> websocket& = default;
@@ -90,6 +96,8 @@ namespace spl::network::socket::layer {
 
         [[nodiscard]] constexpr auto is_open() const noexcept -> bool;
 
+        [[nodiscard]] constexpr auto received() const noexcept -> std::chrono::nanoseconds;
+
         [[nodiscard]] constexpr auto ping(std::string_view raw = "ping") noexcept -> result<void>;
 
         template <typename ConstBufferSequenceT>
@@ -109,12 +117,14 @@ namespace spl::network::socket::layer {
         boost::beast::websocket::stream<SocketT> wss_stream_;
     };
 
-    template <concepts::socket SocketT>
-    constexpr websocket<SocketT>::websocket(context& context) noexcept : context_(context), wss_stream_(context) {}
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr websocket<SocketT, CompressionV>::websocket(context& context) noexcept :
+        context_(context), wss_stream_(context) {}
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename SettableSocketOption>
-    constexpr auto websocket<SocketT>::set_option(SettableSocketOption&& option) noexcept -> result<void> {
+    constexpr auto websocket<SocketT, CompressionV>::set_option(SettableSocketOption&& option) noexcept
+        -> result<void> {
         try {
             wss_stream_.set_option(std::forward<SettableSocketOption>(option));
             return success();
@@ -124,9 +134,10 @@ namespace spl::network::socket::layer {
         }
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename GettableSocketOption>
-    constexpr auto websocket<SocketT>::get_option(GettableSocketOption& option) const noexcept -> result<void> {
+    constexpr auto websocket<SocketT, CompressionV>::get_option(GettableSocketOption& option) const noexcept
+        -> result<void> {
         try {
             wss_stream_.get_option(std::forward<GettableSocketOption>(option));
             return success();
@@ -136,8 +147,8 @@ namespace spl::network::socket::layer {
         }
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::local_endpoint() const noexcept -> result<endpoint_type> {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::local_endpoint() const noexcept -> result<endpoint_type> {
         auto error_code = network::error_code{};
         auto endpoint   = next_layer().local_endpoint(error_code);
         if (error_code) [[unlikely]] {
@@ -146,8 +157,8 @@ namespace spl::network::socket::layer {
         return endpoint;
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::remote_endpoint() const noexcept -> result<endpoint_type> {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::remote_endpoint() const noexcept -> result<endpoint_type> {
         auto error_code = network::error_code{};
         auto endpoint   = next_layer().remote_endpoint(error_code);
         if (error_code) [[unlikely]] {
@@ -156,77 +167,82 @@ namespace spl::network::socket::layer {
         return endpoint;
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::next_layer() const noexcept -> next_layer_type const& {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::next_layer() const noexcept -> next_layer_type const& {
         return wss_stream_.next_layer();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::next_layer() noexcept -> next_layer_type& {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::next_layer() noexcept -> next_layer_type& {
         return wss_stream_.next_layer();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::lowest_layer() const noexcept -> lowest_layer_type const& {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::lowest_layer() const noexcept -> lowest_layer_type const& {
         return wss_stream_.lowest_layer();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::lowest_layer() noexcept -> lowest_layer_type& {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::lowest_layer() noexcept -> lowest_layer_type& {
         return wss_stream_.lowest_layer();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::available() const noexcept -> result<std::size_t> {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::available() const noexcept -> result<std::size_t> {
         return next_layer().available();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::bytes_readable() noexcept -> result<std::size_t> {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::bytes_readable() noexcept -> result<std::size_t> {
         return next_layer().bytes_readable();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::is_open() const noexcept -> bool {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::is_open() const noexcept -> bool {
         return wss_stream_.is_open();
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::received() const noexcept -> std::chrono::nanoseconds {
+        return next_layer().received();
+    }
+
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename ConstBufferSequenceT>
-    constexpr auto websocket<SocketT>::write(ConstBufferSequenceT&& buffers, error_code& error_code) noexcept
-        -> std::size_t {
+    constexpr auto websocket<SocketT, CompressionV>::write(ConstBufferSequenceT&& buffers,
+                                                           error_code& error_code) noexcept -> std::size_t {
         return wss_stream_.write(std::forward<ConstBufferSequenceT>(buffers), error_code);
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename ConstBufferSequenceT>
-    constexpr auto websocket<SocketT>::write(ConstBufferSequenceT&& buffers) -> std::size_t {
+    constexpr auto websocket<SocketT, CompressionV>::write(ConstBufferSequenceT&& buffers) -> std::size_t {
         return wss_stream_.write(std::forward<ConstBufferSequenceT>(buffers));
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename MutableBufferSequenceT>
-    constexpr auto websocket<SocketT>::read(MutableBufferSequenceT&& buffers, error_code& error_code) noexcept
-        -> std::size_t {
+    constexpr auto websocket<SocketT, CompressionV>::read(MutableBufferSequenceT&& buffers,
+                                                          error_code& error_code) noexcept -> std::size_t {
         return wss_stream_.read(std::forward<MutableBufferSequenceT>(buffers), error_code);
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename MutableBufferSequenceT>
-    constexpr auto websocket<SocketT>::read(MutableBufferSequenceT&& buffers) -> std::size_t {
+    constexpr auto websocket<SocketT, CompressionV>::read(MutableBufferSequenceT&& buffers) -> std::size_t {
         return wss_stream_.read(std::forward<MutableBufferSequenceT>(buffers));
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename EndPointIteratorT>
-    constexpr auto websocket<SocketT>::connect(EndPointIteratorT first, EndPointIteratorT last) noexcept
+    constexpr auto websocket<SocketT, CompressionV>::connect(EndPointIteratorT first, EndPointIteratorT last) noexcept
         -> result<void> {
         return next_layer().connect(first, last);
     }
 
-    template <concepts::socket SocketT>
+    template <concepts::socket SocketT, deflate CompressionV>
     template <typename... IgnoredArgsT>
-    constexpr auto websocket<SocketT>::configure(std::string const& host, std::string const& port,
+    constexpr auto websocket<SocketT, CompressionV>::configure(std::string const& host, std::string const& port,
                                                  std::string const& path, IgnoredArgsT&&... args) noexcept
         -> result<void> {
         using namespace boost::beast::http;
@@ -239,6 +255,19 @@ namespace spl::network::socket::layer {
         timeout.keep_alive_pings  = true;
         err_return(set_option(timeout));
 
+        if constexpr (CompressionV.enabled) {
+            auto options                       = permessage_deflate{};
+            options.client_enable              = true;
+            options.client_max_window_bits     = CompressionV.window_bits;
+            options.server_max_window_bits     = CompressionV.window_bits;
+            options.client_no_context_takeover = not CompressionV.context_takeover;
+            options.server_no_context_takeover = not CompressionV.context_takeover;
+            options.compLevel                  = CompressionV.compression_level;
+            options.memLevel                   = CompressionV.memory_level;
+            options.msg_size_threshold         = CompressionV.threshold;
+            err_return(set_option(options));
+        }
+
         try {
             wss_stream_.handshake(std::format("{}:{}", host, port), path);
         } catch (std::exception& exception) {
@@ -248,8 +277,8 @@ namespace spl::network::socket::layer {
         return spl::success();
     }
 
-    template <concepts::socket SocketT>
-    constexpr auto websocket<SocketT>::close() noexcept -> result<void> {
+    template <concepts::socket SocketT, deflate CompressionV>
+    constexpr auto websocket<SocketT, CompressionV>::close() noexcept -> result<void> {
         auto error_code   = network::error_code{};
         auto const reason = boost::beast::websocket::close_reason(boost::beast::websocket::close_code::normal);
         wss_stream_.close(reason, error_code);
@@ -259,8 +288,8 @@ namespace spl::network::socket::layer {
         return next_layer().close();
     }
 
-    template <concepts::socket SocketT>
-    [[nodiscard]] constexpr auto websocket<SocketT>::ping(std::string_view raw) noexcept -> result<void> {
+    template <concepts::socket SocketT, deflate CompressionV>
+    [[nodiscard]] constexpr auto websocket<SocketT, CompressionV>::ping(std::string_view raw) noexcept -> result<void> {
         logger::debug("Sending ping in websocket connection with data=\"{}\"", raw);
         auto error_code = network::error_code{};
         wss_stream_.ping(boost::beast::websocket::ping_data{raw}, error_code);
@@ -5,23 +5,32 @@
 #include "spl/logger/logger.hpp"
 #include "spl/network/common/error_code.hpp"
 #include "spl/network/common/result.hpp"
+#include "spl/network/socket/tuning.hpp"
 
 #include <boost/asio/basic_stream_socket.hpp>
 #include <boost/asio/connect.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/core/role.hpp>
 
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
 #include <ranges>
 
+#include <linux/errqueue.h>
+#include <sys/uio.h>
+
 namespace spl::network::socket {
 
-    template <typename SocketT>
+    template <typename ProtocolT, tuning TuningV = tuning{}>
     class stream;
 }
 
 namespace boost::beast::websocket {
 
-    inline void teardown(role_type role, spl::network::socket::stream<asio::ip::tcp>& socket,
+    template <spl::network::socket::tuning TuningV>
+    inline void teardown(role_type role, spl::network::socket::stream<asio::ip::tcp, TuningV>& socket,
                          system::error_code& error) {
         ignore_unused(role, socket, error);
     }
@@ -30,7 +39,7 @@ namespace boost::beast::websocket {
 
 namespace spl::network::socket {
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     class stream {
     public:
         using next_layer_type   = boost::asio::basic_stream_socket<ProtocolT>;
@@ -39,8 +48,7 @@ namespace spl::network::socket {
         using endpoint_type     = typename next_layer_type::endpoint_type;
         using executor_type     = typename next_layer_type::executor_type;
 
-        constexpr static auto receive_buffer_size = 2048;
-        constexpr static auto send_buffer_size    = 2048;
+        constexpr static auto profile = TuningV;
 
         constexpr explicit stream(context& context) noexcept;
         constexpr stream(stream&& other) noexcept                    = default;
@@ -79,6 +87,8 @@ namespace spl::network::socket {
 
         [[nodiscard]] constexpr auto is_open() const noexcept -> bool;
 
+        [[nodiscard]] constexpr auto received() const noexcept -> std::chrono::nanoseconds;
+
         [[nodiscard]] constexpr auto get_executor() noexcept -> executor_type {
             return next_layer().lowest_layer().get_executor();
         }
@@ -108,22 +118,30 @@ namespace spl::network::socket {
         constexpr auto read(MutableBufferSequenceT&& buffers) -> std::size_t;
 
     private:
+        template <typename SettableSocketOption>
+        constexpr auto tune(SettableSocketOption&& option, std::string_view name) noexcept -> void;
+
+        template <typename MutableBufferSequenceT>
+        constexpr auto receive(MutableBufferSequenceT const& buffers, error_code& error_code) noexcept -> std::size_t;
+
         std::reference_wrapper<context> context_;
         boost::asio::basic_stream_socket<ProtocolT> stream_socket_;
         boost::asio::socket_base::bytes_readable command_{0};
+        std::chrono::nanoseconds received_{0};
     };
 
-    template <typename ProtocolT>
-    constexpr stream<ProtocolT>::stream(context& context) noexcept : context_(context), stream_socket_(context) {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr stream<ProtocolT, TuningV>::stream(context& context) noexcept :
+        context_(context), stream_socket_(context) {
         if (auto operation = set_option(boost::asio::socket_base::keep_alive(true))) {
             logger::error("Error while setting keep alive option for stream: {}", operation.error().message().data());
         }
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename EndPointIteratorT>
-    [[nodiscard]] constexpr auto stream<ProtocolT>::connect(EndPointIteratorT first, EndPointIteratorT last) noexcept
-        -> result<void> {
+    [[nodiscard]] constexpr auto stream<ProtocolT, TuningV>::connect(EndPointIteratorT first,
+                                                                     EndPointIteratorT last) noexcept -> result<void> {
         auto error_code = network::error_code{};
         boost::asio::connect(this->stream_socket_, first, last, error_code);
         if (error_code.failed()) [[unlikely]] {
@@ -132,17 +150,44 @@ namespace spl::network::socket {
         return success();
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename... IgnoredArgsT>
-    constexpr auto stream<ProtocolT>::configure([[maybe_unused]] IgnoredArgsT&&... args) noexcept -> result<void> {
-        // // @note https://stackoverflow.com/a/35434596
-        // err_return(set_option(boost::asio::socket_base::receive_buffer_size(receive_buffer_size)));
-        // err_return(set_option(boost::asio::socket_base::send_buffer_size(send_buffer_size)));
+    constexpr auto stream<ProtocolT, TuningV>::configure([[maybe_unused]] IgnoredArgsT&&... args) noexcept
+        -> result<void> {
+        // @note https://stackoverflow.com/a/35434596 the window scale is negotiated in the SYN, so a receive buffer
+        // set after connecting only grows up to the scale the kernel picked from its defaults.
+        if constexpr (TuningV.receive_buffer > 0) {
+            tune(option::receive_buffer(TuningV.receive_buffer), "SO_RCVBUF");
+        }
+        if constexpr (TuningV.send_buffer > 0) {
+            tune(option::send_buffer(TuningV.send_buffer), "SO_SNDBUF");
+        }
+        if constexpr (TuningV.no_delay) {
+            tune(option::no_delay(true), "TCP_NODELAY");
+        }
+        if constexpr (TuningV.busy_poll > 0) {
+            tune(option::busy_poll(TuningV.busy_poll), "SO_BUSY_POLL");
+        }
+        if constexpr (TuningV.quick_ack) {
+            tune(option::quick_ack(true), "TCP_QUICKACK");
+        }
+        if constexpr (TuningV.timestamping) {
+            tune(option::timestamping(option::software_receive_timestamps), "SO_TIMESTAMPING");
+        }
         return success();
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::close() noexcept -> result<void> {
+    template <typename ProtocolT, tuning TuningV>
+    template <typename SettableSocketOption>
+    constexpr auto stream<ProtocolT, TuningV>::tune(SettableSocketOption&& option, std::string_view name) noexcept
+        -> void {
+        if (auto const operation = set_option(std::forward<SettableSocketOption>(option)); failed(operation)) {
+            logger::warn("Unable to set socket option {}: {}", name, operation.error().message().data());
+        }
+    }
+
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::close() noexcept -> result<void> {
         auto error_code = network::error_code{};
         stream_socket_.close(error_code);
         if (error_code) [[unlikely]] {
@@ -151,9 +196,9 @@ namespace spl::network::socket {
         return success();
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename SettableSocketOption>
-    constexpr auto stream<ProtocolT>::set_option(SettableSocketOption&& option) noexcept -> result<void> {
+    constexpr auto stream<ProtocolT, TuningV>::set_option(SettableSocketOption&& option) noexcept -> result<void> {
         auto error_code = network::error_code{};
         stream_socket_.set_option(std::forward<SettableSocketOption>(option), error_code);
         if (error_code.failed()) [[unlikely]] {
@@ -162,9 +207,9 @@ namespace spl::network::socket {
         return success();
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename GettableSocketOption>
-    constexpr auto stream<ProtocolT>::get_option(GettableSocketOption& option) const noexcept -> result<void> {
+    constexpr auto stream<ProtocolT, TuningV>::get_option(GettableSocketOption& option) const noexcept -> result<void> {
         auto error_code = network::error_code{};
         stream_socket_.get_option(option, error_code);
         if (error_code.failed()) [[unlikely]] {
@@ -173,8 +218,8 @@ namespace spl::network::socket {
         return success();
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::local_endpoint() const noexcept -> result<endpoint_type> {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::local_endpoint() const noexcept -> result<endpoint_type> {
         auto error_code = network::error_code{};
         auto endpoint   = stream_socket_.local_endpoint(error_code);
         if (error_code.failed()) [[unlikely]] {
@@ -183,8 +228,8 @@ namespace spl::network::socket {
         return endpoint;
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::remote_endpoint() const noexcept -> result<endpoint_type> {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::remote_endpoint() const noexcept -> result<endpoint_type> {
         auto error_code = network::error_code{};
         auto endpoint   = stream_socket_.remote_endpoint(error_code);
         if (error_code.failed()) [[unlikely]] {
@@ -193,28 +238,28 @@ namespace spl::network::socket {
         return endpoint;
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::next_layer() const noexcept -> next_layer_type const& {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::next_layer() const noexcept -> next_layer_type const& {
         return stream_socket_;
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::next_layer() noexcept -> next_layer_type& {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::next_layer() noexcept -> next_layer_type& {
         return stream_socket_;
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::lowest_layer() const noexcept -> lowest_layer_type const& {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::lowest_layer() const noexcept -> lowest_layer_type const& {
         return stream_socket_.lowest_layer();
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::lowest_layer() noexcept -> lowest_layer_type& {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::lowest_layer() noexcept -> lowest_layer_type& {
         return stream_socket_.lowest_layer();
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::available() const noexcept -> result<std::size_t> {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::available() const noexcept -> result<std::size_t> {
         error_code error_code{};
         auto const result = stream_socket_.available(error_code);
         if (error_code) [[unlikely]] {
@@ -223,8 +268,8 @@ namespace spl::network::socket {
         return result;
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::bytes_readable() noexcept -> result<std::size_t> {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::bytes_readable() noexcept -> result<std::size_t> {
         error_code error_code{};
         stream_socket_.io_control(command_, error_code);
         if (error_code) [[unlikely]] {
@@ -233,60 +278,140 @@ namespace spl::network::socket {
         return command_.get();
     }
 
-    template <typename ProtocolT>
-    constexpr auto stream<ProtocolT>::is_open() const noexcept -> bool {
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::is_open() const noexcept -> bool {
         return stream_socket_.is_open();
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
+    constexpr auto stream<ProtocolT, TuningV>::received() const noexcept -> std::chrono::nanoseconds {
+        return received_;
+    }
+
+    template <typename ProtocolT, tuning TuningV>
     template <typename ConstBufferSequenceT>
-    constexpr auto stream<ProtocolT>::write_some(ConstBufferSequenceT&& buffers, error_code& error_code) noexcept
-        -> std::size_t {
+    constexpr auto stream<ProtocolT, TuningV>::write_some(ConstBufferSequenceT&& buffers,
+                                                          error_code& error_code) noexcept -> std::size_t {
         return stream_socket_.write_some(buffers, error_code);
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename ConstBufferSequenceT>
-    constexpr auto stream<ProtocolT>::write_some(ConstBufferSequenceT&& buffers) -> std::size_t {
+    constexpr auto stream<ProtocolT, TuningV>::write_some(ConstBufferSequenceT&& buffers) -> std::size_t {
         return stream_socket_.write_some(buffers);
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename MutableBufferSequenceT>
-    constexpr auto stream<ProtocolT>::read_some(MutableBufferSequenceT&& buffers, error_code& error_code) noexcept
-        -> std::size_t {
-        return stream_socket_.read_some(buffers, error_code);
+    constexpr auto stream<ProtocolT, TuningV>::read_some(MutableBufferSequenceT&& buffers,
+                                                         error_code& error_code) noexcept -> std::size_t {
+        auto const bytes = [&]() {
+            if constexpr (TuningV.timestamping) {
+                return receive(buffers, error_code);
+            } else {
+                return stream_socket_.read_some(buffers, error_code);
+            }
+        }();
+        if constexpr (TuningV.quick_ack) {
+            std::ignore = set_option(option::quick_ack(true));
+        }
+        return bytes;
+    }
+
+    template <typename ProtocolT, tuning TuningV>
+    template <typename MutableBufferSequenceT>
+    constexpr auto stream<ProtocolT, TuningV>::receive(MutableBufferSequenceT const& buffers,
+                                                       error_code& error_code) noexcept -> std::size_t {
+        constexpr auto maximum_vectors = std::size_t{16};
+        auto vectors                   = std::array<iovec, maximum_vectors>{};
+        auto count                     = std::size_t{0};
+        auto first                     = boost::asio::buffer_sequence_begin(buffers);
+        auto const last                = boost::asio::buffer_sequence_end(buffers);
+        for (; first != last and count < maximum_vectors; ++first) {
+            auto const buffer = boost::asio::mutable_buffer(*first);
+            if (buffer.size() != 0) {
+                vectors[count++] = iovec{.iov_base = buffer.data(), .iov_len = buffer.size()};
+            }
+        }
+
+        error_code = network::error_code{};
+        if (count == 0) [[unlikely]] {
+            return 0;
+        }
+
+        alignas(cmsghdr) auto control = std::array<char, CMSG_SPACE(sizeof(scm_timestamping))>{};
+        while (true) {
+            auto message           = msghdr{};
+            message.msg_iov        = std::data(vectors);
+            message.msg_iovlen     = count;
+            message.msg_control    = std::data(control);
+            message.msg_controllen = std::size(control);
+
+            auto const bytes = ::recvmsg(stream_socket_.native_handle(), &message, 0);
+            if (bytes > 0) [[likely]] {
+                for (auto* header = CMSG_FIRSTHDR(&message); header != nullptr;
+                     header       = CMSG_NXTHDR(&message, header)) {
+                    if (header->cmsg_level == SOL_SOCKET and header->cmsg_type == SO_TIMESTAMPING) {
+                        auto stamps = scm_timestamping{};
+                        std::memcpy(&stamps, CMSG_DATA(header), sizeof(stamps));
+                        received_ = std::chrono::seconds(stamps.ts[0].tv_sec) +
+                                    std::chrono::nanoseconds(stamps.ts[0].tv_nsec);
+                    }
+                }
+                return static_cast<std::size_t>(bytes);
+            }
+
+            if (bytes == 0) [[unlikely]] {
+                error_code = boost::asio::error::eof;
+                return 0;
+            }
+
+            if (errno == EINTR) {
+                continue;
+            }
+
+            if (errno == EAGAIN or errno == EWOULDBLOCK) {
+                stream_socket_.wait(boost::asio::socket_base::wait_read, error_code);
+                if (error_code) [[unlikely]] {
+                    return 0;
+                }
+                continue;
+            }
+
+            error_code = network::error_code(errno, boost::asio::error::get_system_category());
+            return 0;
+        }
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename MutableBufferSequenceT>
-    constexpr auto stream<ProtocolT>::read_some(MutableBufferSequenceT&& buffers) -> std::size_t {
+    constexpr auto stream<ProtocolT, TuningV>::read_some(MutableBufferSequenceT&& buffers) -> std::size_t {
         return stream_socket_.read_some(buffers);
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename ConstBufferSequenceT>
-    constexpr auto stream<ProtocolT>::write(ConstBufferSequenceT&& buffers, error_code& error_code) noexcept
+    constexpr auto stream<ProtocolT, TuningV>::write(ConstBufferSequenceT&& buffers, error_code& error_code) noexcept
         -> std::size_t {
         return stream_socket_.write(std::forward<ConstBufferSequenceT>(buffers), error_code);
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename ConstBufferSequenceT>
-    constexpr auto stream<ProtocolT>::write(ConstBufferSequenceT&& buffers) -> std::size_t {
+    constexpr auto stream<ProtocolT, TuningV>::write(ConstBufferSequenceT&& buffers) -> std::size_t {
         return stream_socket_.write(std::forward<ConstBufferSequenceT>(buffers));
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename MutableBufferSequenceT>
-    constexpr auto stream<ProtocolT>::read(MutableBufferSequenceT&& buffers, error_code& error_code) noexcept
+    constexpr auto stream<ProtocolT, TuningV>::read(MutableBufferSequenceT&& buffers, error_code& error_code) noexcept
         -> std::size_t {
         return stream_socket_.read(std::forward<MutableBufferSequenceT>(buffers), error_code);
     }
 
-    template <typename ProtocolT>
+    template <typename ProtocolT, tuning TuningV>
     template <typename MutableBufferSequenceT>
-    constexpr auto stream<ProtocolT>::read(MutableBufferSequenceT&& buffers) -> std::size_t {
+    constexpr auto stream<ProtocolT, TuningV>::read(MutableBufferSequenceT&& buffers) -> std::size_t {
         return stream_socket_.read(std::forward<MutableBufferSequenceT>(buffers));
     }
 
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <boost/asio/detail/socket_option.hpp>
+
+#include <linux/net_tstamp.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+namespace spl::network::socket {
+
+    /**
+     * @brief Kernel options applied to a stream socket once the connection is established.
+     *
+     * The structure is used as a non-type template parameter of the stream socket, so the profile is fixed per
+     * connection type and the read path only pays for the options that are enabled. Every option is best-effort:
+     * a kernel refusing one of them (i.e. SO_BUSY_POLL without CAP_NET_ADMIN) is logged and the connection goes on.
+     */
+    struct tuning {
+        int receive_buffer{0};     ///< SO_RCVBUF in bytes, 0 keeps the kernel default.
+        int send_buffer{0};        ///< SO_SNDBUF in bytes, 0 keeps the kernel default.
+        bool no_delay{false};      ///< TCP_NODELAY, disables Nagle on the outbound path.
+        int busy_poll{0};          ///< SO_BUSY_POLL in microseconds, 0 disables busy polling.
+        bool quick_ack{false};     ///< TCP_QUICKACK, re-armed after every read since the kernel clears it.
+        bool timestamping{false};  ///< SO_TIMESTAMPING, software receive timestamp attached to every read.
+    };
+
+    namespace profile {
+
+        constexpr auto standard = tuning{};
+
+        constexpr auto low_latency = tuning{
+            .receive_buffer = 4 * 1024 * 1024,
+            .send_buffer    = 0,
+            .no_delay       = true,
+            .busy_poll      = 50,
+            .quick_ack      = true,
+            .timestamping   = true,
+        };
+
+    } // namespace profile
+
+    namespace option {
+
+        using receive_buffer = boost::asio::detail::socket_option::integer<SOL_SOCKET, SO_RCVBUF>;
+        using send_buffer    = boost::asio::detail::socket_option::integer<SOL_SOCKET, SO_SNDBUF>;
+        using no_delay       = boost::asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_NODELAY>;
+        using busy_poll      = boost::asio::detail::socket_option::integer<SOL_SOCKET, SO_BUSY_POLL>;
+        using quick_ack      = boost::asio::detail::socket_option::boolean<IPPROTO_TCP, TCP_QUICKACK>;
+        using timestamping   = boost::asio::detail::socket_option::integer<SOL_SOCKET, SO_TIMESTAMPING>;
+
+        constexpr auto software_receive_timestamps = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+
+    } // namespace option
+
+} // namespace spl::network::socket
@@ -0,0 +1,96 @@
+#include "spl/network/client/udp.hpp"
+#include "spl/network/connector/router.hpp"
+
+#include <gtest/gtest.h>
+
+#include <boost/asio/ip/multicast.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace {
+
+    constexpr auto group     = "239.255.0.1";
+    constexpr auto port      = "30001";
+    constexpr auto interface = "/127.0.0.1";
+
+    auto make_publisher(spl::network::context& context) -> boost::asio::ip::udp::socket {
+        auto publisher = boost::asio::ip::udp::socket{context, boost::asio::ip::udp::v4()};
+        publisher.set_option(boost::asio::ip::multicast::outbound_interface(boost::asio::ip::address_v4::loopback()));
+        publisher.set_option(boost::asio::ip::multicast::enable_loopback(true));
+        publisher.set_option(boost::asio::ip::multicast::hops(0));
+        return publisher;
+    }
+
+    auto wait_readable(spl::network::client::multicast& connection) -> std::size_t {
+        for (auto attempt = 0; attempt < 100; ++attempt) {
+            if (auto const available = connection.bytes_readable().value(); available != 0) {
+                return available;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+        return 0;
+    }
+
+} // namespace
+
+TEST(MulticastTest, JoinGroupOnLoopback) {
+    auto context    = spl::network::context{};
+    auto router     = spl::network::connector::router<spl::network::client::multicast>{context};
+    auto connection = router.make_connection(group, port, interface);
+    ASSERT_TRUE(connection) << connection.error().message().data();
+    EXPECT_TRUE(connection.value().is_open());
+    EXPECT_EQ(connection.value().remote_endpoint().value().address().to_string(), group);
+    EXPECT_TRUE(connection.value().close());
+}
+
+TEST(MulticastTest, RejectsUnicastAddress) {
+    auto context    = spl::network::context{};
+    auto router     = spl::network::connector::router<spl::network::client::multicast>{context};
+    auto connection = router.make_connection("127.0.0.1", port, interface);
+    EXPECT_FALSE(connection);
+}
+
+TEST(MulticastTest, ReceivesDatagramBatchCompacted) {
+    auto context    = spl::network::context{};
+    auto router     = spl::network::connector::router<spl::network::client::multicast>{context};
+    auto connection = router.make_connection(group, port, interface);
+    ASSERT_TRUE(connection) << connection.error().message().data();
+
+    auto publisher       = make_publisher(context);
+    auto endpoint        = boost::asio::ip::udp::endpoint{boost::asio::ip::make_address(group), 30001};
+    auto const datagrams = std::array<std::string, 3>{"first", "second", "third"};
+    for (auto const& datagram : datagrams) {
+        publisher.send_to(boost::asio::buffer(datagram), endpoint);
+    }
+
+    auto& receiver  = connection.value();
+    auto const slab = spl::network::client::multicast::batch * spl::network::client::multicast::datagram;
+    ASSERT_EQ(wait_readable(receiver), slab);
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    auto buffer      = spl::network::client::multicast::slab_type{};
+    auto error_code  = spl::network::error_code{};
+    auto const bytes = receiver.read(buffer, error_code);
+    ASSERT_FALSE(error_code) << error_code.message();
+    EXPECT_EQ(std::string_view(reinterpret_cast<char const*>(buffer.data()), bytes), "firstsecondthird");
+    EXPECT_EQ(receiver.bytes_readable().value(), 0);
+}
+
+TEST(MulticastTest, LeaveStopsDelivery) {
+    auto context    = spl::network::context{};
+    auto router     = spl::network::connector::router<spl::network::client::multicast>{context};
+    auto connection = router.make_connection(group, port, interface);
+    ASSERT_TRUE(connection) << connection.error().message().data();
+
+    auto& receiver = connection.value();
+    ASSERT_TRUE(receiver.leave(boost::asio::ip::make_address(group)));
+
+    auto publisher = make_publisher(context);
+    auto endpoint  = boost::asio::ip::udp::endpoint{boost::asio::ip::make_address(group), 30001};
+    publisher.send_to(boost::asio::buffer(std::string("dropped")), endpoint);
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_EQ(receiver.bytes_readable().value(), 0);
+}
@@ -16,3 +16,10 @@ target("network-test")
     add_deps("network")
     add_packages("gtest")
 target_end()
+
+target("network-benchmark")
+    set_kind("binary")
+    add_files("benchmark/deflate_benchmark.cpp")
+    add_deps("network", "exchange-corpus")
+    add_packages("benchmark")
+target_end()
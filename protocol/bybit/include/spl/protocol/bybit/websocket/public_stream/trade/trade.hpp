@@ -1,29 +1,33 @@
 #pragma once
 
+#include <spl/container/small_vector.hpp>
 #include <spl/reflect/reflect.hpp>
 
-#include <string>
+#include <optional>
+#include <string_view>
 
 namespace spl::protocol::bybit::websocket::public_stream::trade {
 
+    // The strings point into the frame and the trades of a message are kept inline, so that decoding a snapshot
+    // does not allocate unless it carries more than 16 trades.
     struct data {
-        std::string i;
+        std::string_view i;
         std::int64_t T;
-        std::string p;
-        std::string v;
-        std::string S;
+        std::string_view p;
+        std::string_view v;
+        std::string_view S;
         std::int64_t seq;
-        std::string s;
+        std::string_view s;
         bool BT;
         bool RPI;
-        std::optional<std::string> L;
+        std::optional<std::string_view> L;
     };
 
     struct trade {
         std::string_view topic;
         std::string_view type;
         std::int64_t ts;
-        std::vector<spl::protocol::bybit::websocket::public_stream::trade::data> data;
+        spl::container::small_vector<spl::protocol::bybit::websocket::public_stream::trade::data, 16> data;
     };
 
 } // namespace spl::protocol::bybit::websocket::public_stream::trade
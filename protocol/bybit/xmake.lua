@@ -2,7 +2,7 @@ target("protocol-bybit")
     set_kind("headeronly")
     add_headerfiles("include/spl/protocol/bybit/**/*.hpp")
     add_includedirs("include", {public = true})
-    add_deps("logger", "reflect", "result", {public = true})
+    add_deps("container", "logger", "reflect", "result", {public = true})
     add_packages("frozen", {public = true})
 target_end()
 
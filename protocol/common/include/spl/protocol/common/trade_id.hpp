@@ -1,8 +1,10 @@
 #pragma once
 
-#include <string>
+#include "spl/container/static_string.hpp"
 
 namespace spl::protocol::common {
 
-    using trade_id = std::string;
+    /// Stored inline, so that building a trade never allocates: 40 characters hold the UUIDs some venues use, and
+    /// match the trade identifier of the multicast wire format.
+    using trade_id = spl::container::static_string<40>;
 }
@@ -24,6 +24,8 @@ namespace spl::protocol::feeder::candlestick {
         spl::protocol::common::timestamp ending;
         spl::protocol::common::sequence sequence;
         spl::protocol::common::timestamp timestamp;
+
+        constexpr auto operator<=>(candlestick const& other) const noexcept = default;
     };
 
 } // namespace spl::protocol::feeder::candlestick
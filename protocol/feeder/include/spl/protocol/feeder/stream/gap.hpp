@@ -0,0 +1,20 @@
+#pragma once
+
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/protocol/common/sequence.hpp"
+#include "spl/protocol/common/timestamp.hpp"
+
+namespace spl::protocol::feeder::stream {
+
+    /**
+     * @brief Raised before the first message following a hole in the feed sequence, [first, last] are the missing
+     * sequences. Handlers use it as the recovery hook: request a snapshot, reset derived state or just account it.
+     */
+    struct gap {
+        spl::protocol::common::exchange_id exchange_id;
+        spl::protocol::common::sequence first;
+        spl::protocol::common::sequence last;
+        spl::protocol::common::timestamp timestamp;
+    };
+
+} // namespace spl::protocol::feeder::stream
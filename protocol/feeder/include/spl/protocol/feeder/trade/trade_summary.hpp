@@ -22,6 +22,7 @@ namespace spl::protocol::feeder::trade {
         spl::protocol::common::trade_condition condition;
         spl::protocol::common::sequence sequence;
         spl::protocol::common::timestamp timestamp;
+        spl::protocol::common::timestamp received;
 
         constexpr auto operator<=>(trade_summary const& other) const noexcept = default;
     };
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "spl/protocol/multicast/frame.hpp"
+#include "spl/protocol/multicast/header.hpp"
+#include "spl/protocol/multicast/metrics.hpp"
+#include "spl/protocol/multicast/trade.hpp"
+#include "spl/types/cursor.hpp"
+
+#include <spl/logger/logger.hpp>
+#include <spl/result/result.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
+
+namespace spl::protocol::multicast {
+
+    /**
+     * @brief Decodes one packet per call: the header is forwarded first, then every known message in order.
+     *
+     * Messages are handed to the handler straight from the receive buffer when it is suitably aligned, which is the
+     * case for the multicast receive slab since every message is a multiple of 8 bytes. Otherwise they are copied
+     * out first. A malformed packet consumes the remaining buffer, there is no way to resynchronize inside a
+     * datagram batch once a length is wrong.
+     */
+    struct decoder {
+        using error_type = spl::result<std::size_t>;
+
+        template <typename BufferT, typename HandlerT>
+        [[nodiscard, gnu::hot]] constexpr auto operator()(BufferT&& buffer, HandlerT&& handler) const noexcept
+            -> error_type {
+            auto const* data = reinterpret_cast<std::byte const*>(std::data(buffer));
+            auto cursor      = spl::types::cursor<std::byte const>{data, std::size(buffer)};
+            if (std::cmp_less(cursor.remaining(), sizeof(header))) [[unlikely]] {
+                logger::warn("Multicast decoder: dropping truncated packet of {} bytes", std::size(buffer));
+                return std::size(buffer);
+            }
+
+            auto const packet = peek<header>(cursor);
+            if (packet.magic != magic or packet.version != version) [[unlikely]] {
+                logger::warn("Multicast decoder: dropping packet with magic={:#x} version={}", packet.magic,
+                             packet.version);
+                return std::size(buffer);
+            }
+            if (packet.length < sizeof(header) or packet.length > std::size(buffer)) [[unlikely]] {
+                logger::warn("Multicast decoder: dropping packet with length={} in {} bytes", packet.length,
+                             std::size(buffer));
+                return std::size(buffer);
+            }
+
+            auto messages = cursor.subcursor(packet.length);
+            err_return(emit<header>(messages, handler));
+            for (auto index = std::uint16_t{0}; index < packet.count; ++index) {
+                if (std::cmp_less(messages.remaining(), sizeof(frame))) [[unlikely]] {
+                    logger::warn("Multicast decoder: packet {} truncated at message {}", packet.sequence, index);
+                    break;
+                }
+                auto const prefix    = peek<frame>(messages);
+                auto const malformed = prefix.length < sizeof(frame) or
+                                       std::cmp_greater(prefix.length, messages.remaining());
+                if (malformed) [[unlikely]] {
+                    logger::warn("Multicast decoder: packet {} has an invalid message length", packet.sequence);
+                    break;
+                }
+                auto payload = messages.consume(prefix.length);
+                payload += sizeof(frame);
+                err_return(decode(prefix, payload, handler));
+            }
+            return packet.length;
+        }
+
+    private:
+        template <typename HandlerT>
+        [[nodiscard, gnu::hot]] constexpr auto decode(frame const& prefix, spl::types::cursor<std::byte const>& payload,
+                                                      HandlerT&& handler) const noexcept -> spl::result<void> {
+            switch (prefix.type) {
+                case message_type::trade:
+                    return emit<trade>(payload, handler);
+                case message_type::metrics:
+                    return emit<metrics>(payload, handler);
+                default:
+                    return spl::success();
+            }
+        }
+
+        template <typename ObjectT, typename HandlerT>
+        [[nodiscard, gnu::hot]] constexpr static auto emit(spl::types::cursor<std::byte const>& cursor,
+                                                           HandlerT&& handler) noexcept -> spl::result<void> {
+            if (std::cmp_less(cursor.remaining(), sizeof(ObjectT))) [[unlikely]] {
+                return spl::success();
+            }
+            if (reinterpret_cast<std::uintptr_t>(cursor.data()) % alignof(ObjectT) == 0) [[likely]] {
+                return handler(*cursor.template reinterpret<ObjectT>());
+            }
+            auto const object = peek<ObjectT>(cursor);
+            cursor += sizeof(ObjectT);
+            return handler(object);
+        }
+
+        template <typename ObjectT>
+        [[nodiscard]] constexpr static auto peek(spl::types::cursor<std::byte const> const& cursor) noexcept
+            -> ObjectT {
+            auto object = ObjectT{};
+            std::memcpy(&object, cursor.data(), sizeof(ObjectT));
+            return object;
+        }
+    };
+
+} // namespace spl::protocol::multicast
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "spl/protocol/multicast/frame.hpp"
+#include "spl/protocol/multicast/header.hpp"
+#include "spl/protocol/multicast/writer.hpp"
+
+#include <spl/result/result.hpp>
+
+#include <span>
+
+namespace spl::protocol::multicast {
+
+    /**
+     * @brief Writes a whole packet (header and framed messages) into the caller's buffer.
+     */
+    struct encoder {
+        using error_type = spl::result<std::size_t>;
+
+        template <typename MessageT>
+        [[nodiscard]] constexpr static auto size(std::size_t count) noexcept -> std::size_t {
+            return sizeof(header) + count * (sizeof(frame) + sizeof(MessageT));
+        }
+
+        template <typename MessageT, std::size_t ExtentV>
+        [[nodiscard, gnu::hot]] constexpr auto operator()(std::uint64_t sequence, std::int64_t timestamp,
+                                                          std::span<MessageT const, ExtentV> messages,
+                                                          std::span<char> buffer) const noexcept -> error_type {
+            auto const length = size<MessageT>(std::size(messages));
+            if (length > std::size(buffer)) [[unlikely]] {
+                return spl::failure("multicast encoder: {} bytes required, {} available", length, std::size(buffer));
+            }
+
+            auto packet = writer{std::as_writable_bytes(buffer)};
+            std::ignore = packet.begin(sequence, timestamp);
+            for (auto const& message : messages) {
+                if (not packet.append(message)) [[unlikely]] {
+                    return spl::failure("multicast encoder: too many messages ({})", std::size(messages));
+                }
+            }
+            return std::size(packet.finish());
+        }
+    };
+
+} // namespace spl::protocol::multicast
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace spl::protocol::multicast {
+
+    enum class message_type : std::uint16_t {
+        trade   = 1,
+        metrics = 2,
+    };
+
+    /**
+     * @brief Prefix of every message inside a packet, so a subscriber can skip the message types it does not know.
+     */
+    struct frame {
+        message_type type;      ///< Type of the message following the frame.
+        std::uint16_t length;   ///< Size of the message in bytes, frame included.
+        std::uint32_t reserved; ///< Padding, always zero.
+    };
+
+    static_assert(sizeof(frame) == 8, "spl::protocol::multicast::frame must be 8 bytes");
+    static_assert(std::is_trivially_copyable_v<frame>, "spl::protocol::multicast::frame must be trivially copyable");
+
+} // namespace spl::protocol::multicast
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace spl::protocol::multicast {
+
+    constexpr auto magic   = std::uint32_t{0x4D4C5053}; ///< "SPLM" read as little-endian.
+    constexpr auto version = std::uint16_t{1};
+
+    /**
+     * @brief Fixed header at the start of every datagram.
+     *
+     * A datagram carries a single packet, so the header sequence is the packet sequence of the channel and a hole in
+     * it means that one or more datagrams were lost on the way. All the fields are in host byte order: publisher and
+     * subscribers are expected to run on the same architecture inside the same network.
+     */
+    struct header {
+        std::uint32_t magic;     ///< Always spl::protocol::multicast::magic.
+        std::uint16_t version;   ///< Wire format version.
+        std::uint16_t count;     ///< Number of messages following the header.
+        std::uint32_t length;    ///< Size of the packet in bytes, header included.
+        std::uint32_t reserved;  ///< Padding, always zero.
+        std::uint64_t sequence;  ///< Packet sequence, increased by one for every datagram sent.
+        std::int64_t timestamp;  ///< Nanoseconds since epoch when the packet was sent.
+    };
+
+    static_assert(sizeof(header) == 32, "spl::protocol::multicast::header must be 32 bytes");
+    static_assert(std::is_trivially_copyable_v<header>, "spl::protocol::multicast::header must be trivially copyable");
+
+} // namespace spl::protocol::multicast
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/protocol/multicast/frame.hpp"
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace spl::protocol::multicast {
+
+    /**
+     * @brief Sliding window statistics of an instrument, the prices are spl::types::price::shifted() mantissas.
+     */
+    struct metrics {
+        constexpr static auto type = spl::protocol::multicast::message_type::metrics;
+
+        std::int64_t minimum;                           ///< Lowest price in the window.
+        std::int64_t maximum;                           ///< Highest price in the window.
+        std::int64_t median;                            ///< Median price in the window.
+        std::int64_t mean;                              ///< Mean price in the window.
+        std::int64_t timestamp;                         ///< Timestamp of the trade that produced the update.
+        spl::protocol::common::exchange_id exchange_id; ///< Venue the window is computed on.
+        std::array<char, 7> reserved;                   ///< Padding, always zero.
+        std::array<char, 24> instrument_id;             ///< Null-padded instrument identifier.
+    };
+
+    static_assert(sizeof(metrics) == 72, "spl::protocol::multicast::metrics must be 72 bytes");
+    static_assert(std::is_trivially_copyable_v<metrics>,
+                  "spl::protocol::multicast::metrics must be trivially copyable");
+
+} // namespace spl::protocol::multicast
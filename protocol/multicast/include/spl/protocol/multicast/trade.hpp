@@ -0,0 +1,50 @@
+#pragma once
+
+#include "spl/protocol/common/aggressor_side.hpp"
+#include "spl/protocol/common/exchange_id.hpp"
+#include "spl/protocol/common/trade_condition.hpp"
+#include "spl/protocol/multicast/frame.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace spl::protocol::multicast {
+
+    /**
+     * @brief Fixed-size trade record, the fixed-point values are the shifted mantissas of spl::types::price and
+     * spl::types::quantity so no conversion happens on either side of the wire.
+     */
+    struct trade {
+        constexpr static auto type = spl::protocol::multicast::message_type::trade;
+
+        std::uint64_t sequence;                            ///< Exchange sequence of the trade.
+        std::int64_t price;                                ///< spl::types::price::shifted().
+        std::int64_t quantity;                             ///< spl::types::quantity::shifted().
+        std::int64_t timestamp;                            ///< Exchange timestamp in nanoseconds since epoch.
+        spl::protocol::common::exchange_id exchange_id;    ///< Venue the trade was printed on.
+        spl::protocol::common::aggressor_side side;        ///< Aggressor side.
+        spl::protocol::common::trade_condition condition;  ///< Trade condition.
+        std::array<char, 5> reserved;                      ///< Padding, always zero.
+        std::array<char, 24> instrument_id;                ///< Null-padded instrument identifier.
+        std::array<char, 40> trade_id;                     ///< Null-padded trade identifier.
+    };
+
+    static_assert(sizeof(trade) == 104, "spl::protocol::multicast::trade must be 104 bytes");
+    static_assert(std::is_trivially_copyable_v<trade>, "spl::protocol::multicast::trade must be trivially copyable");
+
+    template <std::size_t SizeV>
+    [[nodiscard]] constexpr auto to_view(std::array<char, SizeV> const& field) noexcept -> std::string_view {
+        auto const view = std::string_view{std::data(field), SizeV};
+        return view.substr(0, view.find('\0'));
+    }
+
+    template <std::size_t SizeV>
+    constexpr auto to_field(std::string_view value, std::array<char, SizeV>& field) noexcept -> void {
+        auto const length = std::min(std::size(value), SizeV);
+        std::fill(std::copy_n(std::data(value), length, std::begin(field)), std::end(field), '\0');
+    }
+
+} // namespace spl::protocol::multicast
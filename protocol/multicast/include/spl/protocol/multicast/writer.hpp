@@ -0,0 +1,98 @@
+#pragma once
+
+#include "spl/protocol/multicast/frame.hpp"
+#include "spl/protocol/multicast/header.hpp"
+#include "spl/types/cursor.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <utility>
+
+namespace spl::protocol::multicast {
+
+    /**
+     * @brief Builds a packet in place in the caller's buffer: begin() reserves the header, every append() writes a
+     * framed message right after the previous one and finish() patches the header with the final count and length.
+     */
+    class writer {
+    public:
+        constexpr explicit writer(std::span<std::byte> buffer) noexcept :
+            buffer_(buffer), cursor_(std::data(buffer), std::size(buffer)) {}
+
+        [[nodiscard]] constexpr auto begin(std::uint64_t sequence, std::int64_t timestamp) noexcept -> bool {
+            cursor_ = spl::types::cursor<std::byte>{std::data(buffer_), std::size(buffer_)};
+            count_  = 0;
+            if (std::size(buffer_) < sizeof(header)) [[unlikely]] {
+                return false;
+            }
+            header_ = header{
+                .magic     = magic,
+                .version   = version,
+                .count     = 0,
+                .length    = 0,
+                .reserved  = 0,
+                .sequence  = sequence,
+                .timestamp = timestamp,
+            };
+            cursor_ += sizeof(header);
+            return true;
+        }
+
+        template <typename MessageT>
+        [[nodiscard]] constexpr auto fits() const noexcept -> bool {
+            constexpr auto required = sizeof(frame) + sizeof(MessageT);
+            return std::cmp_greater_equal(cursor_.remaining(), required) and
+                   count_ < std::numeric_limits<std::uint16_t>::max();
+        }
+
+        template <typename MessageT>
+        [[nodiscard, gnu::hot]] constexpr auto append(MessageT const& message) noexcept -> bool {
+            if (not fits<MessageT>()) [[unlikely]] {
+                return false;
+            }
+            store(frame{.type = MessageT::type, .length = sizeof(frame) + sizeof(MessageT), .reserved = 0});
+            store(message);
+            ++count_;
+            return true;
+        }
+
+        [[nodiscard, gnu::hot]] constexpr auto finish() noexcept -> std::span<std::byte const> {
+            auto const length = static_cast<std::size_t>(cursor_.data() - std::data(buffer_));
+            header_.count     = count_;
+            header_.length    = static_cast<std::uint32_t>(length);
+            std::memcpy(std::data(buffer_), &header_, sizeof(header));
+            return {std::data(buffer_), length};
+        }
+
+        /**
+         * @brief Same as finish(), stamping the packet with the time it is handed to the socket.
+         */
+        [[nodiscard, gnu::hot]] constexpr auto finish(std::int64_t timestamp) noexcept -> std::span<std::byte const> {
+            header_.timestamp = timestamp;
+            return finish();
+        }
+
+        [[nodiscard]] constexpr auto count() const noexcept -> std::size_t {
+            return count_;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool {
+            return count_ == 0;
+        }
+
+    private:
+        template <typename ObjectT>
+        constexpr auto store(ObjectT const& object) noexcept -> void {
+            std::memcpy(cursor_.data(), &object, sizeof(ObjectT));
+            cursor_ += sizeof(ObjectT);
+        }
+
+        std::span<std::byte> buffer_;
+        spl::types::cursor<std::byte> cursor_;
+        header header_{};
+        std::uint16_t count_{0};
+    };
+
+} // namespace spl::protocol::multicast
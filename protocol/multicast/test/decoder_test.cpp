@@ -0,0 +1,110 @@
+#include "spl/protocol/multicast/decoder.hpp"
+#include "spl/protocol/multicast/encoder.hpp"
+#include "spl/protocol/multicast/writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <variant>
+#include <vector>
+
+using namespace spl::protocol;
+
+namespace {
+
+    auto make(std::uint64_t sequence, std::string_view instrument) -> multicast::trade {
+        auto trade      = multicast::trade{};
+        trade.sequence  = sequence;
+        trade.price     = 100 * static_cast<std::int64_t>(sequence);
+        trade.quantity  = 7;
+        trade.timestamp = 1'700'000'000'000'000'000;
+        trade.side      = common::aggressor_side::sell;
+        multicast::to_field(instrument, trade.instrument_id);
+        multicast::to_field(std::to_string(sequence), trade.trade_id);
+        return trade;
+    }
+
+    using event = std::variant<multicast::header, multicast::trade, multicast::metrics>;
+
+    auto collect(std::span<char const> buffer) -> std::pair<std::vector<event>, std::size_t> {
+        auto events          = std::vector<event>{};
+        auto const processed = multicast::decoder{}(buffer, [&](auto const& decoded) -> spl::result<void> {
+            events.emplace_back(decoded);
+            return spl::success();
+        });
+        return {events, processed.value()};
+    }
+
+} // namespace
+
+TEST(MulticastDecoderTest, RoundTripPacket) {
+    auto const trades = std::array{make(10, "BTCUSDT"), make(11, "ETHUSDT")};
+    auto buffer       = std::array<char, 512>{};
+    auto const bytes  = multicast::encoder{}(42, 1, std::span<multicast::trade const>(trades), std::span<char>(buffer));
+    ASSERT_TRUE(bytes) << bytes.error().message().data();
+    EXPECT_EQ(bytes.value(), multicast::encoder::size<multicast::trade>(2));
+
+    auto const [events, processed] = collect(std::span<char const>(buffer.data(), bytes.value()));
+    EXPECT_EQ(processed, bytes.value());
+    ASSERT_EQ(std::size(events), 3);
+    EXPECT_EQ(std::get<multicast::header>(events[0]).sequence, 42);
+    EXPECT_EQ(std::get<multicast::header>(events[0]).count, 2);
+    EXPECT_EQ(multicast::to_view(std::get<multicast::trade>(events[1]).instrument_id), "BTCUSDT");
+    EXPECT_EQ(std::get<multicast::trade>(events[2]).price, 1100);
+    EXPECT_EQ(multicast::to_view(std::get<multicast::trade>(events[2]).trade_id), "11");
+}
+
+TEST(MulticastDecoderTest, ConsumesOnePacketPerCall) {
+    auto const trades = std::array{make(1, "BTCUSDT")};
+    auto buffer       = std::array<char, 512>{};
+    auto const first  = multicast::encoder{}(1, 0, std::span<multicast::trade const>(trades), std::span<char>(buffer));
+    auto const second = multicast::encoder{}(2, 0, std::span<multicast::trade const>(trades),
+                                             std::span<char>(buffer).subspan(first.value()));
+
+    auto const [events, processed] = collect(std::span<char const>(buffer.data(), first.value() + second.value()));
+    EXPECT_EQ(processed, first.value());
+    EXPECT_EQ(std::size(events), 2);
+}
+
+TEST(MulticastDecoderTest, DropsMalformedPacket) {
+    auto buffer = std::array<char, 64>{};
+    buffer.fill('x');
+
+    auto const [events, processed] = collect(std::span<char const>(buffer.data(), buffer.size()));
+    EXPECT_EQ(processed, buffer.size());
+    EXPECT_TRUE(std::empty(events));
+}
+
+TEST(MulticastEncoderTest, RejectsShortBuffer) {
+    auto const trades = std::array{make(1, "BTCUSDT")};
+    auto buffer       = std::array<char, 64>{};
+    auto const bytes  = multicast::encoder{}(1, 0, std::span<multicast::trade const>(trades), std::span<char>(buffer));
+    EXPECT_FALSE(bytes);
+}
+
+TEST(MulticastWriterTest, MixesMessageTypes) {
+    auto buffer = std::array<std::uint64_t, 64>{};
+    auto packet = multicast::writer{std::as_writable_bytes(std::span(buffer))};
+    ASSERT_TRUE(packet.begin(7, 0));
+    ASSERT_TRUE(packet.append(make(1, "BTCUSDT")));
+    ASSERT_TRUE(packet.append(multicast::metrics{.minimum = 1, .maximum = 3, .median = 2, .mean = 2}));
+    auto const encoded = packet.finish();
+    EXPECT_EQ(std::size(encoded), sizeof(multicast::header) + 2 * sizeof(multicast::frame) +
+                                      sizeof(multicast::trade) + sizeof(multicast::metrics));
+
+    auto const [events, processed] = collect({reinterpret_cast<char const*>(encoded.data()), encoded.size()});
+    EXPECT_EQ(processed, std::size(encoded));
+    ASSERT_EQ(std::size(events), 3);
+    EXPECT_EQ(std::get<multicast::header>(events[0]).count, 2);
+    EXPECT_EQ(std::get<multicast::metrics>(events[2]).maximum, 3);
+}
+
+TEST(MulticastWriterTest, StopsWhenFull) {
+    auto buffer = std::array<std::byte, 256>{};
+    auto packet = multicast::writer{std::span(buffer)};
+    ASSERT_TRUE(packet.begin(1, 0));
+    EXPECT_TRUE(packet.append(make(1, "BTCUSDT")));
+    EXPECT_TRUE(packet.append(make(2, "BTCUSDT")));
+    EXPECT_FALSE(packet.append(make(3, "BTCUSDT")));
+    EXPECT_EQ(packet.count(), 2);
+}
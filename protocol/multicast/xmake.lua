@@ -0,0 +1,14 @@
+target("protocol-multicast")
+    set_kind("headeronly")
+    add_headerfiles("include/spl/protocol/multicast/**/*.hpp")
+    add_includedirs("include", {public = true})
+    add_deps("logger", "result", "types", "protocol-common", {public = true})
+target_end()
+
+target("protocol-multicast-test")
+    set_kind("binary")
+    set_group("test")
+    add_files("test/*.cpp")
+    add_deps("protocol-multicast")
+    add_packages("gtest")
+target_end()
@@ -1,4 +1,5 @@
 includes("bybit")
 includes("coinbase")
 includes("common")
-includes("feeder")
\ No newline at end of file
+includes("feeder")
+includes("multicast")
\ No newline at end of file
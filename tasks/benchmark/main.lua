@@ -0,0 +1,165 @@
+import("core.base.option")
+import("core.base.json")
+import("core.base.task")
+import("core.project.config")
+import("core.project.project")
+
+-- Targets run when --targets is not given
+local DEFAULT_TARGETS = {"metrics-benchmark", "exchange-bybit-benchmark", "exchange-coinbase-benchmark"}
+
+-- Nanoseconds in every time unit google benchmark reports
+local NANOSECONDS = {ns = 1, us = 1e3, ms = 1e6, s = 1e9}
+
+-- Builds and runs a benchmark target, then returns the median time and its coefficient of variation per benchmark
+function _run(name, repetitions, filter)
+    task.run("build", {target = name})
+
+    local target = project.target(name)
+    if not target then
+        raise("unknown benchmark target: %s", name)
+    end
+
+    local output = path.join(config.buildir(), "benchmark", name .. ".json")
+    os.mkdir(path.directory(output))
+
+    local argv = {
+        "--benchmark_repetitions=" .. repetitions,
+        "--benchmark_report_aggregates_only=true",
+        "--benchmark_enable_random_interleaving=true",
+        "--benchmark_out_format=json",
+        "--benchmark_out=" .. output
+    }
+    if filter then
+        table.insert(argv, "--benchmark_filter=" .. filter)
+    end
+    os.execv(target:targetfile(), argv)
+
+    -- A single repetition reports iterations and no aggregates, the iteration is then its own median
+    local results = {}
+    for _, entry in ipairs(json.loadfile(output).benchmarks or {}) do
+        local key    = entry.run_name or entry.name
+        local result = results[key] or {target = name, name = key, time_ns = 0, cv = 0}
+        if entry.run_type == "iteration" or entry.aggregate_name == "median" then
+            result.time_ns = entry.real_time * NANOSECONDS[entry.time_unit or "ns"]
+        elseif entry.aggregate_name == "cv" then
+            result.cv = entry.real_time
+        end
+        results[key] = result
+    end
+    return results
+end
+
+-- Entries sorted by target and name, so that the committed baseline diffs cleanly
+function _sorted(entries)
+    local sorted = {}
+    for _, entry in pairs(entries) do
+        table.insert(sorted, entry)
+    end
+    table.sort(sorted, function (lhs, rhs)
+        if lhs.target ~= rhs.target then
+            return lhs.target < rhs.target
+        end
+        return lhs.name < rhs.name
+    end)
+    return sorted
+end
+
+function _key(entry)
+    return entry.target .. "/" .. entry.name
+end
+
+function _update(file, baseline, current, repetitions)
+    local merged = {}
+    for _, entry in ipairs(baseline and baseline.benchmarks or {}) do
+        merged[_key(entry)] = entry
+    end
+    for _, results in pairs(current) do
+        for _, entry in pairs(results) do
+            merged[_key(entry)] = entry
+        end
+    end
+
+    json.savefile(file, {
+        context = {
+            date        = os.date("%Y-%m-%d"),
+            host        = os.host(),
+            arch        = os.arch(),
+            mode        = config.mode(),
+            repetitions = repetitions
+        },
+        benchmarks = _sorted(merged)
+    }, {indent = true})
+    cprint("${bright green}baseline updated:${clear} %s", file)
+end
+
+-- A benchmark regresses when its median slows down by more than the threshold plus `noise` times the combined
+-- coefficient of variation of both runs, so that a noisy benchmark needs a larger change to fail the gate
+function _compare(baseline, current, threshold, noise, filtered)
+    local regressions = 0
+    local known       = {}
+    for _, reference in ipairs(baseline.benchmarks or {}) do
+        known[_key(reference)] = true
+        local results = current[reference.target]
+        if results then
+            local result = results[reference.name]
+            if not result then
+                if not filtered then
+                    cprint("${yellow}missing${clear}     %s", _key(reference))
+                end
+            else
+                local ratio  = result.time_ns / reference.time_ns
+                local spread = math.sqrt(reference.cv * reference.cv + result.cv * result.cv)
+                local limit  = threshold + noise * spread
+                local line   = string.format("%s %12.0f ns -> %12.0f ns (%+6.1f%%, limit %.1f%%)", _key(reference),
+                                             reference.time_ns, result.time_ns, (ratio - 1) * 100, limit * 100)
+                if ratio > 1 + limit then
+                    regressions = regressions + 1
+                    cprint("${bright red}regression${clear}  %s", line)
+                elseif ratio < 1 - limit then
+                    cprint("${bright green}improvement${clear} %s", line)
+                else
+                    cprint("unchanged   %s", line)
+                end
+            end
+        end
+    end
+
+    for _, results in pairs(current) do
+        for _, result in ipairs(_sorted(results)) do
+            if not known[_key(result)] then
+                cprint("${cyan}new${clear}         %s %12.0f ns", _key(result), result.time_ns)
+            end
+        end
+    end
+    return regressions
+end
+
+function main()
+    config.load()
+
+    local file        = path.absolute(option.get("baseline"), os.projectdir())
+    local threshold   = tonumber(option.get("threshold"))
+    local noise       = tonumber(option.get("noise"))
+    local repetitions = tonumber(option.get("repetitions"))
+    local targets     = option.get("targets") or DEFAULT_TARGETS
+    local baseline    = os.isfile(file) and json.loadfile(file) or nil
+
+    local current = {}
+    for _, name in ipairs(targets) do
+        current[name] = _run(name, repetitions, option.get("filter"))
+    end
+
+    if option.get("update") then
+        return _update(file, baseline, current, repetitions)
+    end
+
+    if not baseline then
+        raise("no baseline at %s, record one with `xmake benchmark --update`", file)
+    end
+
+    local regressions = _compare(baseline, current, threshold, noise, option.get("filter") ~= nil)
+    if regressions > 0 then
+        raise("%d benchmark(s) regressed against %s", regressions, file)
+    end
+    cprint("${bright green}no regression${clear} against %s", file)
+end
@@ -0,0 +1,19 @@
+task("benchmark")
+    set_category("plugin")
+    on_run("main")
+    set_menu {
+        usage = "xmake benchmark [options]",
+        description = "Run the benchmarks and compare them against the committed baseline.",
+        options = {
+            {'b', "baseline",    "kv", "outputs/benchmark.json", "The baseline to compare against or to update."},
+            {'u', "update",      "k",  nil,                      "Record the results as the new baseline instead of comparing."},
+            {'t', "threshold",   "kv", "0.05",                   "Smallest relative slowdown that counts as a regression."},
+            {'n', "noise",       "kv", "2",                      "Coefficients of variation a change must exceed on top of the threshold."},
+            {'r', "repetitions", "kv", "5",                      "Repetitions of every benchmark, their median is compared."},
+            {'f', "filter",      "kv", nil,                      "Only run the benchmarks matching this regular expression."},
+            {nil, "targets",     "vs", nil,                      "The benchmark targets to run.",
+                                                                 "Defaults to metrics-benchmark, exchange-bybit-benchmark and",
+                                                                 "exchange-coinbase-benchmark."}
+        }
+    }
+task_end()
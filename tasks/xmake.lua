@@ -0,0 +1 @@
+includes("benchmark")
\ No newline at end of file
@@ -357,6 +357,35 @@ namespace spl::types {
             return is_negative() ? -1 : (is_positive() ? 1 : 0);
         }
 
+        enum class rounding_mode { half_up, half_down, half_even, truncate, ceiling, floor };
+
+        /**
+         * @brief Divides `value` by `scale` with the given rounding, in any integer width: metrics accumulating
+         * mantissas in 128 bits use it to come back to a single mantissa. Modes other than truncate assume non-negative
+         * values.
+         */
+        template <rounding_mode RoundingModeV, typename NumericT>
+        [[nodiscard]] constexpr static auto round_value(NumericT value, NumericT scale) noexcept -> NumericT {
+            auto const quotient  = static_cast<NumericT>(value / scale);
+            auto const remainder = static_cast<NumericT>(value % scale);
+            if constexpr (RoundingModeV == rounding_mode::half_up) {
+                return (remainder >= scale - remainder) ? quotient + 1 : quotient;
+            } else if constexpr (RoundingModeV == rounding_mode::half_down) {
+                return (remainder > scale - remainder) ? quotient + 1 : quotient;
+            } else if constexpr (RoundingModeV == rounding_mode::half_even) {
+                if (remainder == scale - remainder) {
+                    return (quotient % 2 == 0) ? quotient : quotient + 1;
+                }
+                return (remainder > scale - remainder) ? quotient + 1 : quotient;
+            } else if constexpr (RoundingModeV == rounding_mode::truncate) {
+                return quotient;
+            } else if constexpr (RoundingModeV == rounding_mode::ceiling) {
+                return (remainder != 0) ? quotient + 1 : quotient;
+            } else if constexpr (RoundingModeV == rounding_mode::floor) {
+                return quotient;
+            }
+        }
+
     private:
         template <std::integral IntegerT>
         constexpr explicit decimal(IntegerT value) noexcept : mantissa_(static_cast<mantissa_type>(value)) {}
@@ -444,26 +473,6 @@ namespace spl::types {
             return count;
         }
 
-        enum class rounding_mode { half_up, half_down, half_even, truncate, ceiling, floor };
-
-        template <rounding_mode RoundingModeV, typename NumericT>
-        [[nodiscard]] constexpr auto round_value(NumericT value, NumericT scale) noexcept -> NumericT {
-            if constexpr (RoundingModeV == rounding_mode::half_up) {
-                return (value + (scale / 2)) / scale;
-            } else if constexpr (RoundingModeV == rounding_mode::half_down) {
-                return (value - (scale / 2)) / scale;
-            } else if constexpr (RoundingModeV == rounding_mode::half_even) {
-                auto const rounded = (value + scale / 2) / scale;
-                return (rounded % 2 == 0) ? rounded : rounded + 1;
-            } else if constexpr (RoundingModeV == rounding_mode::truncate) {
-                return value / scale;
-            } else if constexpr (RoundingModeV == rounding_mode::ceiling) {
-                return (value + scale - 1) / scale;
-            } else if constexpr (RoundingModeV == rounding_mode::floor) {
-                return value / scale;
-            }
-        }
-
         mantissa_type mantissa_{0};
     };
 
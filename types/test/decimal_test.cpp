@@ -77,6 +77,28 @@ static_assert(dec6::from("1.100000").to_string() == "1.1");
 static_assert(dec6::zero().to_string() == "0.0");
 static_assert(dec6::one().to_string() == "1.0");
 
+// Rounding tests, on 25/10 and 35/10 (ties), 14/10 and 16/10
+using rounding_mode = dec6::rounding_mode;
+static_assert(dec6::round_value<rounding_mode::half_up>(25, 10) == 3);
+static_assert(dec6::round_value<rounding_mode::half_up>(14, 10) == 1);
+static_assert(dec6::round_value<rounding_mode::half_up>(16, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::half_down>(25, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::half_down>(14, 10) == 1);
+static_assert(dec6::round_value<rounding_mode::half_down>(16, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::half_even>(25, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::half_even>(35, 10) == 4);
+static_assert(dec6::round_value<rounding_mode::half_even>(14, 10) == 1);
+static_assert(dec6::round_value<rounding_mode::half_even>(16, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::half_even>(20, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::truncate>(19, 10) == 1);
+static_assert(dec6::round_value<rounding_mode::truncate>(-19, 10) == -1);
+static_assert(dec6::round_value<rounding_mode::ceiling>(11, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::ceiling>(20, 10) == 2);
+static_assert(dec6::round_value<rounding_mode::floor>(19, 10) == 1);
+static_assert(dec6::round_value<rounding_mode::half_even>(__int128_t{25}, __int128_t{10}) == 2);
+static_assert(dec6::round_value<rounding_mode::half_up>(2, 3) == 1);
+static_assert(dec6::round_value<rounding_mode::half_down>(1, 3) == 0);
+
 auto main() -> int {
     return 0;
 }
@@ -24,6 +24,12 @@ if is_mode("releasedbg") then
     set_strip("none")          
 end
 
+option("telemetry")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Stamp every pipeline stage into per-thread latency histograms")
+option_end()
+
 -- gRPC & Protobuf
 add_requires("protobuf-cpp")
 add_requires("grpc", {system = false})
@@ -65,3 +71,4 @@ includes("math")
 includes("container")
 includes("metrics")
 includes("apps")
+includes("tasks")